@@ -273,6 +273,16 @@
     // NOTE: Image export requires stb_image_write.h library
     #define SUPPORT_IMAGE_EXPORT        1
 #endif
+#ifndef SUPPORT_IMAGE_MMAP
+    // Support image loading from memory-mapped files: LoadImageMapped(), LoadImageRawMapped()
+    // NOTE: Requires platform file mapping support (POSIX mmap() or Win32), loading falls back to file reading otherwise
+    #define SUPPORT_IMAGE_MMAP          1
+#endif
+#ifndef SUPPORT_IMAGE_THREADS
+    // Support multi-threaded image processing: ImageApplyPipeline()
+    // NOTE: Requires platform threads support (POSIX threads or Win32), processing runs on calling thread otherwise
+    #define SUPPORT_IMAGE_THREADS       1
+#endif
 #ifndef SUPPORT_IMAGE_GENERATION
     // Support procedural image generation functionality: gradient, spot, perlin-noise, cellular...
     // NOTE: Perlin noise requires stb_perlin.h library
@@ -350,6 +360,11 @@
 #ifndef SUPPORT_FILEFORMAT_MOD
     #define SUPPORT_FILEFORMAT_MOD      1
 #endif
+#ifndef SUPPORT_MUSIC_STREAM_THREADS
+    // Support music streams decoding on worker threads, UpdateMusicStream() is not required
+    // NOTE: Music streams are decoded on UpdateMusicStream() calls otherwise
+    #define SUPPORT_MUSIC_STREAM_THREADS 0      // Disabled by default
+#endif
 
 // raudio: Configuration values
 // NOTE: Below values are already defined inside [rlgl.h] so there is no need to be
@@ -361,6 +376,12 @@
 //#define AUDIO_DEVICE_SAMPLE_RATE            0    // Device sample rate (device default)
 //#define AUDIO_DEVICE_PERIOD_SIZE_IN_FRAMES  0    // Device period size (controls latency, 0 defaults to 10ms)
 //#define MAX_AUDIO_BUFFER_POOL_CHANNELS     16    // Maximum number of audio pool channels
+//#define MAX_AUDIO_VOICES                   64    // Maximum number of sounds mixed at once, exceeding ones turn virtual
+//#define MAX_AUDIO_BUS_EFFECTS               8    // Maximum effects chained per audio bus
+//#define AUDIO_EFFECT_DELAY_MAX_TIME      2.0f    // Delay effect maximum time in seconds, sets delay line memory
+//#define WAVE_LOAD_THREAD_COUNT              3    // Worker threads decoding waves on LoadWaves(), along with the calling thread
+//#define MUSIC_STREAM_THREAD_COUNT           2    // Worker threads decoding music streams (SUPPORT_MUSIC_STREAM_THREADS)
+//#define MUSIC_STREAM_DECODE_AHEAD           2    // Sub-buffers decoded ahead of playback by music stream workers
 //------------------------------------------------------------------------------------
 #endif // !EXTERNAL_CONFIG_FLAGS
 
@@ -28,6 +28,9 @@
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, #define as 0 in this module or your build system
 *
+*       #define SUPPORT_MUSIC_STREAM_THREADS 0
+*           Music streams are decoded ahead of playback by worker threads, UpdateMusicStream() does nothing
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/mackron/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -179,6 +182,16 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sinf(), cosf(), powf(), logf(), expf(), fabsf() [Used in UpdateSincResamplerTable(), UpdateAudioEffect()]
+
+// Vectorized mixing kernels [MixAudioSamples(), MixStereoAudioSamples(), ProcessDelayLineSamples()]
+#if defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64)
+    #include <emmintrin.h>              // Required for: _mm_loadu_ps(), _mm_mul_ps(), _mm_add_ps()
+    #define RAUDIO_SSE2_ENABLED
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>               // Required for: vld1q_f32(), vmlaq_f32()
+    #define RAUDIO_NEON_ENABLED
+#endif
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -298,10 +311,61 @@ typedef struct tagBITMAPINFOHEADER {
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
 
+#ifndef MAX_AUDIO_VOICES
+    #define MAX_AUDIO_VOICES                  64    // Maximum sounds mixed at once, other playing sounds turn virtual
+#endif
+#ifndef AUDIO_VOICE_AUDIBILITY_MIN
+    #define AUDIO_VOICE_AUDIBILITY_MIN    0.001f    // Sounds with a lower volume (-60 dB) are always virtual
+#endif
+
 #ifndef AUDIO_BUFFER_RESIDUAL_CAPACITY
     #define AUDIO_BUFFER_RESIDUAL_CAPACITY     8    // In PCM frames, for resampling and pitch shifting
 #endif
 
+#ifndef AUDIO_SINC_RESAMPLER_TAPS
+    #define AUDIO_SINC_RESAMPLER_TAPS         16    // Windowed-sinc resampler filter length, in frames (must be even)
+#endif
+#ifndef AUDIO_SINC_RESAMPLER_PHASES
+    #define AUDIO_SINC_RESAMPLER_PHASES       64    // Windowed-sinc resampler filter phases, interpolated (must be a power of two)
+#endif
+
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         512    // Commands queued to the mixer per audio period, must be a power of two
+#endif
+#ifndef AUDIO_COMMAND_WAIT_TIMEOUT
+    #define AUDIO_COMMAND_WAIT_TIMEOUT       100    // Time waiting for the mixer before the program applies the commands, in milliseconds
+#endif
+
+#ifndef MAX_AUDIO_BUS_EFFECTS
+    #define MAX_AUDIO_BUS_EFFECTS              8    // Maximum effects chained per audio bus
+#endif
+#ifndef AUDIO_BUS_BLOCK_SIZE
+    #define AUDIO_BUS_BLOCK_SIZE            1024    // Audio buses sub-mix block size, in frames, longer periods are mixed in several blocks
+#endif
+#ifndef AUDIO_EFFECT_DELAY_MAX_TIME
+    #define AUDIO_EFFECT_DELAY_MAX_TIME     2.0f    // Delay effect maximum time, in seconds, delay line memory is allocated for it
+#endif
+
+#define AUDIO_REVERB_COMB_FILTERS              8    // Reverb parallel comb filters per channel (Freeverb tuning)
+#define AUDIO_REVERB_ALLPASS_FILTERS           4    // Reverb serial all-pass filters per channel (Freeverb tuning)
+
+#ifndef MUSIC_STREAM_SEEK_POINTS
+    #define MUSIC_STREAM_SEEK_POINTS          64    // Seek points indexed per music stream (MP3 and modules)
+#endif
+
+#ifndef WAVE_LOAD_THREAD_COUNT
+    #define WAVE_LOAD_THREAD_COUNT             3    // Worker threads decoding waves on LoadWaves(), along with the calling thread
+#endif
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+#ifndef MUSIC_STREAM_THREAD_COUNT
+    #define MUSIC_STREAM_THREAD_COUNT          2    // Worker threads decoding music streams
+#endif
+#ifndef MUSIC_STREAM_DECODE_AHEAD
+    #define MUSIC_STREAM_DECODE_AHEAD          2    // Sub-buffers decoded ahead of playback by music stream workers
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -353,18 +417,46 @@ struct rAudioBuffer {
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (-1.0f to 1.0f)
+    int resampler;                  // Audio buffer resampler: AudioResampler
+    float mixLevels[2];             // Channel levels used on last mix, ramped towards new volume/pan
+    bool mixLevelsReady;            // Mix levels are valid, reset when playback starts
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    int priority;                   // Voice priority, higher priority sounds are kept mixed first
+    bool isVirtual;                 // Voice not mixed, only its cursor advances (voices limit reached or inaudible)
+    bool isMixed;                   // Voice mixed on last period, it fades out before turning virtual
+
+    volatile ma_bool32 playing;     // Audio buffer state: AUDIO_PLAYING
+    volatile ma_bool32 paused;      // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    volatile ma_bool32 isSubBufferProcessed[2]; // SubBuffer processed (virtual double buffer), released by the mixer
     unsigned int sizeInFrames;      // Total buffer size in frames
-    unsigned int frameCursorPos;    // Frame cursor position
-    unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    volatile ma_uint32 frameCursorPos;  // Frame cursor position
+    volatile ma_uint32 framesProcessed; // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    bool sharedData;                // Data buffer is owned by another audio buffer (sound alias)
+#if SUPPORT_FILEFORMAT_QOA
+    struct rQoaSoundDecoder *qoa;   // QOA compressed sound decoder, data keeps QOA encoded frames
+#endif
+
+    // Program side of the mixer commands queue
+    // NOTE: Commands are applied by the audio thread at the start of the next period,
+    // the queued state is reported back until the mixer has caught up with them
+    unsigned int commandCount;      // Commands queued for this buffer
+    volatile ma_uint32 commandsApplied; // Commands already applied by the mixer
+    unsigned int subBufferCommand[2];   // Command that submitted every sub-buffer data
+    unsigned int resetCommand;      // Last command discarding the streamed sub-buffers (play, stop or seek)
+    bool queuedPlaying;             // Playing state once queued commands are applied
+    bool queuedPaused;              // Paused state once queued commands are applied
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+    struct rMusicDecoder *decoder;  // Music stream decoder running on a worker thread
+#endif
+    struct rMusicSeekIndex *seekIndex; // Music stream seek index, only used by the music decoding side
+    Music offlineMusic;             // Music stream refilled on every period by RenderAudioToWave(), set on UpdateMusicStream()
+    rAudioBus *bus;                 // Audio bus mixed into, NULL for master mix
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -378,15 +470,163 @@ struct rAudioProcessor {
     rAudioProcessor *prev;          // Previous audio processor on the list
 };
 
+// Audio effect delay line, used by delay and reverb effects
+typedef struct rAudioDelayLine {
+    float *samples;                 // Line samples, ring buffer
+    unsigned int length;            // Line length in samples
+    unsigned int cursor;            // Next sample to read and write
+    float store;                    // Comb filter damping state
+} rAudioDelayLine;
+
+// Audio effect, processes an audio bus sub-mix in place
+// NOTE: Effects are allocated by the program, their parameters are updated by the mixer
+typedef struct rAudioEffect {
+    int type;                       // Effect type: AudioEffect
+    float params[3];                // Effect parameters, as set by the program
+    unsigned int channels;          // Channels processed
+    unsigned int sampleRate;        // Sample rate processed
+    unsigned int tailFrames;        // Frames the effect keeps sounding once its input is silent
+    float coeffs[5];                // Coefficients computed from parameters, depend on effect type
+    float *state;                   // Biquad filters state (2 per channel) or limiter gain
+    rAudioDelayLine *lines;         // Delay lines: one for delay, combs and all-passes per channel for reverb
+    unsigned int lineCount;         // Number of delay lines
+} rAudioEffect;
+
+// Audio bus struct, sub-mix processed by an effects chain before being mixed into its output
+// NOTE: Buses list and routing are only modified by the mixer, as audio buffers
+struct rAudioBus {
+    float *frames;                  // Sub-mix block, AUDIO_BUS_BLOCK_SIZE frames in device format
+    bool isMixed;                   // Sub-mix received audio on current block
+    unsigned int tailLength;        // Frames processed once input is silent, effects tails added
+    unsigned int tailFrames;        // Frames left to process before the bus is skipped
+
+    float volume;                   // Audio bus volume
+    float mixVolume;                // Volume used on last block, ramped towards new volume
+
+    rAudioEffect *effects[MAX_AUDIO_BUS_EFFECTS]; // Effects chain, slots are filled by the program before queuing them
+    unsigned int effectCount;       // Effects processed by the mixer
+    unsigned int queuedEffectCount; // Effects added by the program, including the ones not yet applied
+
+    rAudioBus *output;              // Audio bus mixed into, NULL for master mix
+    int depth;                      // Buses between this bus and master mix
+    rAudioBus *next;                // Next audio bus on the list, deeper buses first
+};
+
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+#if SUPPORT_MUSIC_STREAM_THREADS
+// Music stream decoder, refills the music stream from a worker thread
+// NOTE: Decoder lock is shared by the worker and the program, never by the audio thread
+typedef struct rMusicDecoder {
+    Music music;                    // Music stream decoded
+    ma_mutex lock;                  // Decoder access lock
+    volatile ma_bool32 looping;     // Music looping, as set by the program
+    bool playing;                   // Decoding enabled, music has been started
+    unsigned int framesDecoded;     // Frames decoded since the start of the music, including queued ones
+    unsigned char *queue;           // Decoded sub-buffers waiting to be submitted to the stream
+    unsigned int queueFrames[MUSIC_STREAM_DECODE_AHEAD]; // Frames decoded on every queued sub-buffer
+    unsigned int queueHead;         // Next queued sub-buffer to submit
+    unsigned int queueCount;        // Number of queued sub-buffers
+    int worker;                     // Worker thread running this decoder
+    struct rMusicDecoder *next;     // Next decoder on the worker list
+} rMusicDecoder;
+#endif
+
+#if SUPPORT_FILEFORMAT_QOA
+// QOA compressed sound decoder, every sound and sound alias decodes its own frames while mixing
+typedef struct rQoaSoundDecoder {
+    qoa_desc desc;                  // QOA description, LMS state is updated on every frame decoded
+    unsigned int dataSize;          // QOA encoded data size in bytes
+    int frameIndex;                 // QOA frame decoded into samples, -1 if none
+    unsigned int frameLen;          // QOA frame decoded length, in frames
+    short *samples;                 // QOA frame decoded samples (interleaved)
+} rQoaSoundDecoder;
+#endif
+
+// Windowed-sinc resampler state, used as miniaudio custom resampling backend
+// NOTE: Input history is duplicated so the filter always reads a contiguous window
+typedef struct rSincResampler {
+    ma_uint32 channels;             // Channels, samples are always 32 bit float
+    ma_uint32 sampleRateIn;         // Input sample rate
+    ma_uint32 sampleRateOut;        // Output sample rate
+    ma_uint64 step;                 // Input frames advanced per output frame, 32.32 fixed point
+    ma_uint64 time;                 // Input frames to consume before next output frame, 32.32 fixed point
+    ma_uint32 historyPos;           // Oldest input frame in history window
+    float cutoff;                   // Filter cutoff, relative to input Nyquist frequency
+    float table[(AUDIO_SINC_RESAMPLER_PHASES + 1)*AUDIO_SINC_RESAMPLER_TAPS]; // Filter coefficients per phase
+    float *history;                 // Input history, 2*AUDIO_SINC_RESAMPLER_TAPS frames per channel
+} rSincResampler;
+
+// Music stream seek index, seek points are placed at regular intervals
+// NOTE: Seek points keep the decoder state, recorded as decoding reaches every point for the first time
+typedef struct rMusicSeekIndex {
+    unsigned int interval;          // Frames between seek points
+    unsigned int pointCount;        // Seek points recorded
+    unsigned int pointSize;         // Seek point size in bytes (decoder state)
+    unsigned int position;          // Frames decoded from start, up to music frame count
+    unsigned char *points;          // Seek points data
+} rMusicSeekIndex;
+
+// Waves batch shared by the threads loading it, every wave is claimed by a single thread
+typedef struct rWaveBatch {
+    const char **fileNames;         // Wave file names
+    Wave *waves;                    // Waves loaded
+    ma_uint32 count;                // Number of waves
+    bool deviceFormat;              // Convert waves to audio device format
+    volatile ma_uint32 next;        // Next wave to be claimed
+    volatile ma_uint32 loaded;      // Waves loaded (or failed)
+} rWaveBatch;
+
+// Mixer command type
+typedef enum {
+    AUDIO_COMMAND_TRACK = 0,        // Add buffer to the mixer list
+    AUDIO_COMMAND_UNTRACK,          // Remove buffer from the mixer list
+    AUDIO_COMMAND_RELEASE,          // Remove buffer from the mixer list and hand it back to be freed
+    AUDIO_COMMAND_PLAY,             // Play buffer from the start
+    AUDIO_COMMAND_STOP,             // Stop buffer
+    AUDIO_COMMAND_PAUSE,            // Pause buffer
+    AUDIO_COMMAND_RESUME,           // Resume paused buffer
+    AUDIO_COMMAND_VOLUME,           // Set buffer volume
+    AUDIO_COMMAND_PITCH,            // Set buffer pitch
+    AUDIO_COMMAND_PAN,              // Set buffer pan
+    AUDIO_COMMAND_PRIORITY,         // Set buffer voice priority
+    AUDIO_COMMAND_RESAMPLER,        // Replace buffer converter, using a new resampler
+    AUDIO_COMMAND_SEEK,             // Discard the streamed sub-buffers, new data is submitted from the seek position
+    AUDIO_COMMAND_SUBMIT,           // Hand a filled stream sub-buffer to the mixer
+    AUDIO_COMMAND_CALLBACK,         // Set buffer callback
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Add processor to buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_DETACH_PROCESSOR, // Remove processors from buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_ROUTE,            // Set audio bus buffer is mixed into
+    AUDIO_COMMAND_BUS_TRACK,        // Add bus to the mixer list
+    AUDIO_COMMAND_BUS_RELEASE,      // Remove bus from the mixer list and hand it back to be freed
+    AUDIO_COMMAND_BUS_OUTPUT,       // Set audio bus a bus is mixed into
+    AUDIO_COMMAND_BUS_VOLUME,       // Set bus volume
+    AUDIO_COMMAND_BUS_ADD_EFFECT,   // Add effect to the end of bus chain
+    AUDIO_COMMAND_BUS_SET_EFFECT    // Set bus effect parameters
+} AudioCommandType;
+
+// Mixer command, queued by the program and applied by the audio thread
+typedef struct rAudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Target audio buffer, NULL for mixed output processors
+    float value;                    // Volume, pitch, pan, priority or resampler value
+    int subBuffer;                  // Sub-buffer index to submit
+    AudioCallback callback;         // Buffer callback or processor callback to detach
+    rAudioProcessor *processor;     // Processor to attach
+    void *heap;                     // Converter heap, preallocated by the program
+    rAudioBus *bus;                 // Target audio bus
+    rAudioBus *output;              // Audio bus to mix buffer or bus into, NULL for master mix
+    rAudioEffect *effect;           // Bus effect to add or update
+    float params[3];                // Bus effect parameters
+} rAudioCommand;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // Audio device without output, mixed by the program on RenderAudioToWave()
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
@@ -395,6 +635,35 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        rAudioCommand queue[AUDIO_COMMAND_QUEUE_SIZE]; // Single producer, single consumer commands ring
+        volatile ma_uint32 head;    // Next command to write, advanced by the program
+        volatile ma_uint32 tail;    // Next command to apply, advanced by the audio thread
+        ma_spinlock lock;           // Serializes producers, never taken by the audio thread
+        volatile ma_uint32 consumer; // Set while the queue is applied, by the mixer or by the program if the mixer stalls
+        void *releasedBuffers;      // Buffers removed by the mixer, waiting to be freed
+        void *releasedProcessors;   // Processors removed by the mixer, waiting to be freed
+        void *releasedHeaps;        // Converter heaps replaced by the mixer, waiting to be freed
+        void *releasedBuses;        // Buses removed by the mixer, waiting to be freed
+    } Command;
+    struct {
+        rAudioBus *first;           // Pointer to first AudioBus in the list
+    } Bus;
+    struct {
+        AudioBuffer *real[MAX_AUDIO_VOICES]; // Sounds selected to be mixed, min-heap by priority and audibility
+        volatile ma_uint32 limit;   // Maximum sounds mixed at once, 0 for no limit
+        volatile ma_uint32 realCount;       // Sounds mixed on last period
+        volatile ma_uint32 virtualCount;    // Sounds playing but not mixed on last period
+    } Voices;
+#if SUPPORT_MUSIC_STREAM_THREADS
+    struct {
+        ma_thread thread[MUSIC_STREAM_THREAD_COUNT]; // Worker threads
+        ma_mutex lock[MUSIC_STREAM_THREAD_COUNT];    // Worker decoders list lock
+        rMusicDecoder *first[MUSIC_STREAM_THREAD_COUNT]; // Worker decoders list
+        int decoderCount[MUSIC_STREAM_THREAD_COUNT]; // Worker decoders count
+        volatile ma_bool32 running;  // Worker threads running
+    } MusicThreads;
+#endif
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -408,6 +677,7 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, increase this number
     .Buffer.defaultSize = 0,
+    .Voices.limit = MAX_AUDIO_VOICES,
     .mixedProcessor = NULL
 };
 
@@ -421,11 +691,68 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
+static void MixAudioBlock(float *framesOut, ma_uint32 frameCount);  // Mix buffers and buses into an output block, up to AUDIO_BUS_BLOCK_SIZE frames
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gain, float gainStep); // Accumulate samples with a linear gain ramp
+static void MixStereoAudioSamples(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *gain, const float *gainStep); // Accumulate stereo frames with linear left/right gain ramps
+
+static void PushAudioCommand(rAudioCommand command);              // Queue command to the mixer (program thread)
+static bool ProcessStalledAudioCommands(int waitTime);            // Apply the queued commands from the program if the mixer stalls
+static void ProcessAudioCommands(void);                             // Apply queued commands (audio thread)
+static void ApplyAudioCommand(const rAudioCommand *command);        // Apply one command to the mixer state
+static void FreeReleasedAudioData(void);                            // Free buffers, processors and buses handed back by the mixer
+static void SyncAudioBufferState(AudioBuffer *buffer);              // Refresh queued state once the mixer caught up
+static void WaitAudioBufferCommands(AudioBuffer *buffer);           // Wait for the mixer to apply the buffer queued commands
+static bool IsSubBufferAvailable(AudioBuffer *buffer, int index);   // Check if a stream sub-buffer can be written by the program
+static void StopAudioBufferInMixer(AudioBuffer *buffer);
+
+static void UpdateAudioVoices(void);                                // Select the sounds to be mixed, the rest turn virtual
+static bool IsAudioVoiceKept(const AudioBuffer *voice, const AudioBuffer *other); // Check if voice is kept over other when voices limit is reached
+static void UpdateVirtualAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount); // Advance virtual voice cursor without mixing
+
+static float *StartAudioBusMix(rAudioBus *bus, ma_uint32 frameCount); // Get bus sub-mix block, cleared on first use per block
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount);  // Process buses effects and mix them into their outputs, silent buses skipped
+static void SortAudioBuses(void);                                   // Sort buses list so every bus is processed before its output
+static rAudioEffect *LoadAudioEffect(int type, unsigned int channels, unsigned int sampleRate); // Load audio effect, delay lines included
+static void UnloadAudioEffect(rAudioEffect *effect);                // Unload audio effect
+static void UpdateAudioEffect(rAudioEffect *effect, const float *params); // Compute audio effect coefficients and tail from its parameters
+static void ProcessAudioEffect(rAudioEffect *effect, float *frames, ma_uint32 frameCount); // Process audio effect in place
+static void ProcessDelayLineSamples(float *samples, float *line, ma_uint32 sampleCount, float feedback, float dry, float wet); // Mix delayed samples, line keeps input plus feedback
+
+#if SUPPORT_FILEFORMAT_QOA
+static rQoaSoundDecoder *LoadQoaSoundDecoder(qoa_desc desc, unsigned int dataSize); // Load QOA sound decoder, frame samples are allocated with it
+static void DecodeQoaSoundFrames(AudioBuffer *buffer, short *framesOut, ma_uint32 frameCount); // Decode QOA sound frames from buffer cursor position
+#endif
 
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+static ma_data_converter_config GetAudioConverterConfig(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, int resampler); // Get audio buffer data converter config
+static ma_result GetSincResamplerHeapSize(void *userData, const ma_resampler_config *config, size_t *heapSize);
+static ma_result InitSincResampler(void *userData, const ma_resampler_config *config, void *heap, ma_resampling_backend **backend);
+static void UninitSincResampler(void *userData, ma_resampling_backend *backend, const ma_allocation_callbacks *allocationCallbacks);
+static ma_result ProcessSincResampler(void *userData, ma_resampling_backend *backend, const void *framesIn, ma_uint64 *frameCountIn, void *framesOut, ma_uint64 *frameCountOut);
+static ma_result SetSincResamplerRate(void *userData, ma_resampling_backend *backend, ma_uint32 sampleRateIn, ma_uint32 sampleRateOut);
+static ma_result GetSincResamplerRequiredInput(void *userData, const ma_resampling_backend *backend, ma_uint64 outputFrameCount, ma_uint64 *inputFrameCount);
+static ma_result GetSincResamplerExpectedOutput(void *userData, const ma_resampling_backend *backend, ma_uint64 inputFrameCount, ma_uint64 *outputFrameCount);
+static ma_result ResetSincResampler(void *userData, ma_resampling_backend *backend);
+static void UpdateSincResamplerTable(rSincResampler *resampler);   // Compute filter coefficients for current cutoff
+
+static ma_uint32 LoadWaveBatchItems(rWaveBatch *batch, LoadWavesCallback callback); // Claim and load waves from batch until no one is left
+static ma_thread_result MA_THREADCALL WaveBatchWorker(void *data);  // Waves batch worker thread
+
+static void RewindMusicStream(Music music);                         // Rewind music stream decoding to the start
+static void DecodeMusicStreamFrames(Music music, void *pcmBuffer, unsigned int frameCount); // Decode music stream frames into a PCM buffer
+static void ReadMusicStreamFrames(Music music, void *pcmBuffer, unsigned int frameCount); // Read music stream frames from decoder into a PCM buffer
+static void LoadMusicSeekIndex(Music music);                        // Load music stream seek index (MP3 and modules)
+static void SeekMusicStreamIndexed(Music music, unsigned int position); // Seek indexed music stream from the nearest seek point
+static void SaveMusicSeekPoint(Music music, unsigned char *state);  // Save music decoder state as seek point
+static void LoadMusicSeekPoint(Music music, const unsigned char *state); // Restore music decoder state from seek point
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+static void LoadMusicDecoder(Music music);                          // Load music stream decoder and add it to a worker thread
+static void UnloadMusicDecoder(Music music);                        // Remove music stream decoder from its worker thread and unload it
+static void StopMusicThreads(void);                                 // Stop worker threads and unload remaining decoders
+static bool UpdateMusicDecoder(rMusicDecoder *decoder);             // Decode ahead and refill music stream, called by worker threads
+static ma_thread_result MA_THREADCALL MusicThreadWorker(void *data);  // Music stream worker thread
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -453,6 +780,9 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority);
+void SetAudioBufferResampler(AudioBuffer *buffer, int resampler);
+void SetAudioBufferBus(AudioBuffer *buffer, rAudioBus *bus);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -496,15 +826,9 @@ void InitAudioDevice(void)
     }
 
     // Mixing happens on a separate thread which means synchronization is needed
-    // A mutex is used here to make things simple, but may want to look at something
-    // a bit smarter later on to keep everything real-time, if that's necessary
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
-    {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
-    }
+    // To keep the mixer real-time it never waits on the program: state changes are
+    // queued into a lock-free commands ring that is applied at the start of every period,
+    // the list of audio buffers is only modified by the audio thread
 
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
@@ -527,16 +851,57 @@ void InitAudioDevice(void)
     AUDIO.System.isReady = true;
 }
 
+// Initialize audio device without output, audio is only mixed on RenderAudioToWave() calls
+// NOTE: No audio backend is required, mixing runs on the program thread and commands
+// are applied directly, music streams must be updated between renders
+void InitAudioDeviceOffline(int sampleRate)
+{
+    if (AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Device already initialized");
+        return;
+    }
+
+    if (sampleRate <= 0) sampleRate = (AUDIO_DEVICE_SAMPLE_RATE > 0)? AUDIO_DEVICE_SAMPLE_RATE : 48000;
+
+    // Only the device parameters required for mixing are defined, device is never started
+    memset(&AUDIO.System.device, 0, sizeof(ma_device));
+    AUDIO.System.device.sampleRate = sampleRate;
+    AUDIO.System.device.playback.format = AUDIO_DEVICE_FORMAT;
+    AUDIO.System.device.playback.channels = AUDIO_DEVICE_CHANNELS;
+    AUDIO.System.device.playback.internalPeriodSizeInFrames = (AUDIO_DEVICE_PERIOD_SIZE_IN_FRAMES > 0)? AUDIO_DEVICE_PERIOD_SIZE_IN_FRAMES : sampleRate/100;
+    ma_device_set_master_volume(&AUDIO.System.device, 1.0f);
+
+    TRACELOG(LOG_INFO, "AUDIO: Offline device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Format:        %s", ma_get_format_name(AUDIO.System.device.playback.format));
+    TRACELOG(LOG_INFO, "    > Channels:      %d", AUDIO.System.device.playback.channels);
+    TRACELOG(LOG_INFO, "    > Sample rate:   %d", AUDIO.System.device.sampleRate);
+
+    AUDIO.System.isReady = true;
+    AUDIO.System.isOffline = true;
+}
+
 // Close the audio device for all contexts
 void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
+#if SUPPORT_MUSIC_STREAM_THREADS
+        StopMusicThreads();
+#endif
+        if (!AUDIO.System.isOffline)
+        {
+            ma_device_uninit(&AUDIO.System.device);
+            ma_context_uninit(&AUDIO.System.context);
+        }
 
+        // Audio thread is stopped, apply any command left in the queue,
+        // from now on commands are applied directly by the program
+        ProcessAudioCommands();
         AUDIO.System.isReady = false;
+        AUDIO.System.isOffline = false;
+        FreeReleasedAudioData();
+
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -566,6 +931,78 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Set maximum number of sounds mixed at once, 0 for no limit
+// NOTE: Exceeding sounds turn virtual, they keep playing but are not mixed
+void SetAudioVoiceLimit(int maxVoices)
+{
+    if ((maxVoices < 0) || (maxVoices > MAX_AUDIO_VOICES))
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Voices limit out of range, limited to %i", MAX_AUDIO_VOICES);
+        maxVoices = (maxVoices < 0)? 0 : MAX_AUDIO_VOICES;
+    }
+
+    ma_atomic_store_32(&AUDIO.Voices.limit, (ma_uint32)maxVoices);
+}
+
+// Get number of sounds mixed on last audio period
+int GetAudioVoiceCount(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Voices.realCount);
+}
+
+// Get number of sounds playing but not mixed (virtual) on last audio period
+int GetAudioVirtualVoiceCount(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Voices.virtualCount);
+}
+
+// Render audio mix into a new wave, as fast as possible (requires offline audio device)
+// NOTE: Mixing runs in device periods, buffers and processors are updated as with an output device,
+// music streams updated by the program are refilled on every period, render length is not limited by their buffers
+Wave RenderAudioToWave(int frameCount)
+{
+    Wave wave = { 0 };
+
+    if (!AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Audio can only be rendered with an offline device");
+        return wave;
+    }
+
+    if (frameCount <= 0) return wave;
+
+    ma_uint32 channels = AUDIO.System.device.playback.channels;
+    ma_uint32 periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    float *frames = (float *)RL_MALLOC(frameCount*channels*sizeof(float));
+
+    for (ma_uint32 frame = 0; frame < (ma_uint32)frameCount; frame += periodSize)
+    {
+        ma_uint32 framesToMix = ((ma_uint32)frameCount - frame < periodSize)? (ma_uint32)frameCount - frame : periodSize;
+
+        for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+        {
+            if (buffer->offlineMusic.stream.buffer != NULL) UpdateMusicStream(buffer->offlineMusic);
+        }
+
+        OnSendAudioDataToDevice(&AUDIO.System.device, frames + frame*channels, NULL, framesToMix);
+    }
+
+    // Master volume is applied by miniaudio on the output device
+    float volume = GetMasterVolume();
+    if (volume != 1.0f)
+    {
+        for (int i = 0; i < frameCount*(int)channels; i++) frames[i] *= volume;
+    }
+
+    wave.frameCount = frameCount;
+    wave.sampleRate = AUDIO.System.device.sampleRate;
+    wave.sampleSize = 32;
+    wave.channels = channels;
+    wave.data = frames;
+
+    return wave;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -584,8 +1021,7 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     if (sizeInFrames > 0) audioBuffer->data = (unsigned char *)RL_CALLOC(sizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
 
     // Audio data runs through a format converter
-    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
-    converterConfig.allowDynamicSampleRate = true;
+    ma_data_converter_config converterConfig = GetAudioConverterConfig(format, channels, sampleRate, AUDIO_RESAMPLER_LINEAR);
 
     ma_result result = ma_data_converter_init(&converterConfig, NULL, &audioBuffer->converter);
 
@@ -634,25 +1070,25 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Buffer memory is freed once the mixer has removed it from the playing list
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->converterResidual);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
-    }
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_RELEASE, .buffer = buffer });
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing, considering the commands not yet applied by the mixer
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        ma_spinlock_lock(&AUDIO.Command.lock);
+        SyncAudioBufferState(buffer);
+        result = (buffer->queuedPlaying && !buffer->queuedPaused);
+        ma_spinlock_unlock(&AUDIO.Command.lock);
+    }
+
     return result;
 }
 
@@ -661,76 +1097,37 @@ bool IsAudioBufferPlaying(AudioBuffer *buffer)
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        buffer->framesProcessed = 0;
-        buffer->isSubBufferProcessed[0] = true;
-        buffer->isSubBufferProcessed[1] = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer });
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (IsAudioBufferPlaying(buffer)) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer });
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_PAUSE, .buffer = buffer });
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_RESUME, .buffer = buffer });
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume });
 }
 
 // Set pitch for an audio buffer
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
-    if ((buffer != NULL) && (pitch > 0.0f))
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)AUDIO.System.device.sampleRate/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if ((buffer != NULL) && (pitch > 0.0f)) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch });
 }
 
 // Set pan for an audio buffer
@@ -739,46 +1136,63 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < -1.0f) pan = -1.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL)
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan });
+}
+
+// Set voice priority for an audio buffer
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority)
+{
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_PRIORITY, .buffer = buffer, .value = (float)priority });
+}
+
+// Set resampler for an audio buffer
+// NOTE: Converter is replaced by the mixer, its memory is allocated here to keep the mixer real-time
+void SetAudioBufferResampler(AudioBuffer *buffer, int resampler)
+{
+    if (buffer == NULL) return;
+
+    if ((resampler < AUDIO_RESAMPLER_LINEAR) || (resampler > AUDIO_RESAMPLER_SINC))
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Resampler not supported");
+        return;
+    }
+
+    ma_data_converter_config config = GetAudioConverterConfig(buffer->converter.formatIn, buffer->converter.channelsIn, buffer->converter.sampleRateIn, resampler);
+
+    size_t heapSize = 0;
+    void *heap = NULL;
+    if (ma_data_converter_get_heap_size(&config, &heapSize) == MA_SUCCESS) heap = ma_malloc((heapSize > sizeof(void *))? heapSize : sizeof(void *), NULL);
+
+    if (heap == NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate resampler");
+        return;
     }
+
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_RESAMPLER, .buffer = buffer, .value = (float)resampler, .heap = heap });
+
+    // Converter is read by following calls, wait until it has been replaced
+    WaitAudioBufferCommands(buffer);
+}
+
+// Set audio bus an audio buffer is mixed into, NULL for master mix
+void SetAudioBufferBus(AudioBuffer *buffer, rAudioBus *bus)
+{
+    if (buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_ROUTE, .buffer = buffer, .output = bus });
 }
 
 // Track audio buffer to linked list next position
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_TRACK, .buffer = buffer });
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Waits for the mixer to remove the buffer, so it can be freed by the caller
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer });
+    WaitAudioBufferCommands(buffer);
 }
 
 //----------------------------------------------------------------------------------
@@ -802,6 +1216,67 @@ Wave LoadWave(const char *fileName)
     return wave;
 }
 
+// Load multiple waves from files, decoded in parallel by worker threads
+// NOTE: Progress callback is called from the calling thread, failed waves are returned empty,
+// deviceFormat converts waves to audio device format so LoadSoundFromWave() copies them as is
+Wave *LoadWaves(const char **fileNames, int count, bool deviceFormat, LoadWavesCallback callback)
+{
+    if ((fileNames == NULL) || (count <= 0)) return NULL;
+
+    rWaveBatch batch = { 0 };
+    batch.fileNames = fileNames;
+    batch.waves = (Wave *)RL_CALLOC(count, sizeof(Wave));
+    batch.count = (ma_uint32)count;
+    batch.deviceFormat = deviceFormat;
+
+    if (deviceFormat && !AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "WAVE: Audio device not ready, waves loaded in file format");
+        batch.deviceFormat = false;
+    }
+
+    // Calling thread also loads waves, no thread is started for a single wave
+    ma_thread threads[WAVE_LOAD_THREAD_COUNT];
+    int threadCount = 0;
+
+    for (int i = 0; (i < WAVE_LOAD_THREAD_COUNT) && (i < count - 1); i++)
+    {
+        if (ma_thread_create(&threads[threadCount], ma_thread_priority_default, 0, WaveBatchWorker, &batch, NULL) == MA_SUCCESS) threadCount++;
+        else TRACELOG(LOG_WARNING, "WAVE: Failed to create wave loading thread");
+    }
+
+    ma_uint32 loaded = LoadWaveBatchItems(&batch, callback);
+
+    // Keep reporting progress until the waves loading on worker threads are done
+    while (loaded < batch.count)
+    {
+        ma_uint32 current = ma_atomic_load_32(&batch.loaded);
+
+        if (current != loaded)
+        {
+            if (callback != NULL) callback((int)current, count);
+            loaded = current;
+        }
+        else ma_sleep(1);
+    }
+
+    for (int i = 0; i < threadCount; i++) ma_thread_wait(&threads[i]);
+
+    TRACELOG(LOG_INFO, "WAVE: Loaded %i waves using %i threads", count, threadCount + 1);
+
+    return batch.waves;
+}
+
+// Unload waves loaded with LoadWaves()
+void UnloadWaves(Wave *waves, int count)
+{
+    if (waves == NULL) return;
+
+    for (int i = 0; i < count; i++) UnloadWave(waves[i]);
+
+    RL_FREE(waves);
+}
+
 // Load wave from memory buffer, fileType refers to extension: i.e. ".wav"
 // WARNING: File extension must be provided in lower-case
 Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
@@ -965,7 +1440,12 @@ Sound LoadSoundFromWave(Wave wave)
         AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
         if (audioBuffer != NULL)
         {
-            frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            // Waves already in device format (i.e. loaded by LoadWaves()) are just copied
+            if ((formatIn == AUDIO_DEVICE_FORMAT) && (wave.channels == AUDIO_DEVICE_CHANNELS) && (wave.sampleRate == AUDIO.System.device.sampleRate))
+            {
+                memcpy(audioBuffer->data, wave.data, frameCountIn*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS));
+            }
+            else frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
             if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
 
             sound.frameCount = frameCount;
@@ -980,6 +1460,77 @@ Sound LoadSoundFromWave(Wave wave)
     return sound;
 }
 
+// Load sound from wave data, defining how sound data is stored in memory
+// NOTE: SOUND_STORAGE_S16 and SOUND_STORAGE_QOA keep wave sample rate and channels,
+// sound data is converted to device format (and decoded) by the mixer while playing
+Sound LoadSoundFromWaveEx(Wave wave, int storage)
+{
+    Sound sound = { 0 };
+
+    if (storage == SOUND_STORAGE_DEVICE) return LoadSoundFromWave(wave);
+
+    if (wave.data != NULL)
+    {
+        Wave waveS16 = wave;
+
+        if (wave.sampleSize != 16)
+        {
+            waveS16 = WaveCopy(wave);
+            WaveFormat(&waveS16, wave.sampleRate, 16, wave.channels);
+        }
+
+        AudioBuffer *audioBuffer = NULL;
+
+#if SUPPORT_FILEFORMAT_QOA
+        if ((storage == SOUND_STORAGE_QOA) && (wave.channels <= QOA_MAX_CHANNELS))
+        {
+            qoa_desc desc = { 0 };
+            desc.channels = wave.channels;
+            desc.samplerate = wave.sampleRate;
+            desc.samples = wave.frameCount;
+
+            unsigned int dataSize = 0;
+            unsigned char *data = (unsigned char *)qoa_encode((const short *)waveS16.data, &desc, &dataSize);
+
+            if (data != NULL)
+            {
+                audioBuffer = LoadAudioBuffer(ma_format_s16, wave.channels, wave.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+                if (audioBuffer != NULL)
+                {
+                    audioBuffer->sizeInFrames = wave.frameCount;
+                    audioBuffer->data = data;
+                    audioBuffer->qoa = LoadQoaSoundDecoder(desc, dataSize);
+                }
+                else RL_FREE(data);
+            }
+            else TRACELOG(LOG_WARNING, "SOUND: Failed to encode QOA data");
+        }
+        else
+#endif
+        {
+            if (storage == SOUND_STORAGE_QOA) TRACELOG(LOG_WARNING, "SOUND: QOA storage not supported, using 16 bit storage");
+
+            audioBuffer = LoadAudioBuffer(ma_format_s16, wave.channels, wave.sampleRate, wave.frameCount, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer != NULL) memcpy(audioBuffer->data, waveS16.data, wave.frameCount*wave.channels*sizeof(short));
+        }
+
+        if (audioBuffer != NULL)
+        {
+            sound.frameCount = wave.frameCount;
+            sound.stream.sampleRate = wave.sampleRate;
+            sound.stream.sampleSize = 16;
+            sound.stream.channels = wave.channels;
+            sound.stream.buffer = audioBuffer;
+        }
+        else TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+
+        if (waveS16.data != wave.data) UnloadWave(waveS16);
+    }
+
+    return sound;
+}
+
 // Clone sound from existing sound data, clone does not own wave data
 // NOTE: Wave data must be unallocated manually and will be shared across all clones
 Sound LoadSoundAlias(Sound source)
@@ -988,12 +1539,18 @@ Sound LoadSoundAlias(Sound source)
 
     if (source.stream.buffer->data != NULL)
     {
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        // NOTE: Alias keeps source sound storage format
+        ma_format format = (source.stream.sampleSize == 16)? ma_format_s16 : AUDIO_DEVICE_FORMAT;
+        AudioBuffer *audioBuffer = LoadAudioBuffer(format, source.stream.channels, source.stream.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
 
         if (audioBuffer != NULL)
         {
             audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
             audioBuffer->data = source.stream.buffer->data;
+            audioBuffer->sharedData = true;
+#if SUPPORT_FILEFORMAT_QOA
+            if (source.stream.buffer->qoa != NULL) audioBuffer->qoa = LoadQoaSoundDecoder(source.stream.buffer->qoa->desc, source.stream.buffer->qoa->dataSize);
+#endif
 
             // Initalize the buffer as if it was new
             audioBuffer->volume = 1.0f;
@@ -1001,9 +1558,9 @@ Sound LoadSoundAlias(Sound source)
             audioBuffer->pan = 0.0f; // Center
 
             sound.frameCount = source.frameCount;
-            sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-            sound.stream.sampleSize = 32;
-            sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+            sound.stream.sampleRate = source.stream.sampleRate;
+            sound.stream.sampleSize = source.stream.sampleSize;
+            sound.stream.channels = source.stream.channels;
             sound.stream.buffer = audioBuffer;
         }
         else TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
@@ -1042,13 +1599,8 @@ void UnloadSound(Sound sound)
 
 void UnloadSoundAlias(Sound alias)
 {
-    // Untrack and unload the sound buffer, not the sample data, it is shared with the source for the alias
-    if (alias.stream.buffer != NULL)
-    {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
-    }
+    // Unload the sound buffer, not the sample data, it is shared with the source for the alias
+    UnloadAudioBuffer(alias.stream.buffer);
 }
 
 // Update sound buffer with new data
@@ -1058,7 +1610,15 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
+#if SUPPORT_FILEFORMAT_QOA
+        if (sound.stream.buffer->qoa != NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: QOA compressed sound data can not be updated");
+            return;
+        }
+#endif
         StopAudioBuffer(sound.stream.buffer);
+        WaitAudioBufferCommands(sound.stream.buffer);   // Mixer must stop reading before data is replaced
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
     }
@@ -1241,6 +1801,24 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set resampler for a sound, used on sample rate conversion and pitch
+void SetSoundResampler(Sound sound, int resampler)
+{
+    SetAudioBufferResampler(sound.stream.buffer, resampler);
+}
+
+// Set priority for a sound, higher priority sounds are kept mixed first when voices limit is reached
+void SetSoundPriority(Sound sound, int priority)
+{
+    SetAudioBufferPriority(sound.stream.buffer, priority);
+}
+
+// Set audio bus a sound is mixed into, empty bus for master mix
+void SetSoundBus(Sound sound, AudioBus bus)
+{
+    SetAudioBufferBus(sound.stream.buffer, bus.mix);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1530,6 +2108,12 @@ Music LoadMusicStream(const char *fileName)
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+        LoadMusicSeekIndex(music);
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+        LoadMusicDecoder(music);
+#endif
     }
 
     return music;
@@ -1744,6 +2328,12 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+        LoadMusicSeekIndex(music);
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+        LoadMusicDecoder(music);
+#endif
     }
 
     return music;
@@ -1764,6 +2354,10 @@ void UnloadMusicStream(Music music)
 {
     if (IsMusicStreamPlaying(music)) StopMusicStream(music);
 
+#if SUPPORT_MUSIC_STREAM_THREADS
+    UnloadMusicDecoder(music);
+#endif
+    if (music.stream.buffer != NULL) RL_FREE(music.stream.buffer->seekIndex);
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1796,8 +2390,23 @@ void UnloadMusicStream(Music music)
 // Start music playing (open stream) from beginning
 void PlayMusicStream(Music music)
 {
-    PlayAudioStream(music.stream);
-}
+#if SUPPORT_MUSIC_STREAM_THREADS
+    rMusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL)
+    {
+        // Sub-buffers already decoded are kept, playback continues from the decoder position
+        ma_mutex_lock(&decoder->lock);
+        PlayAudioStream(music.stream);
+        ma_atomic_store_32(&decoder->looping, music.looping);
+        decoder->playing = true;
+        ma_mutex_unlock(&decoder->lock);
+        return;
+    }
+#endif
+
+    PlayAudioStream(music.stream);
+}
 
 // Pause music playing
 void PauseMusicStream(Music music)
@@ -1814,50 +2423,49 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
-    StopAudioStream(music.stream);
+#if SUPPORT_MUSIC_STREAM_THREADS
+    rMusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
 
-    switch (music.ctxType)
+    if (decoder != NULL)
     {
-#if SUPPORT_FILEFORMAT_WAV
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if SUPPORT_FILEFORMAT_OGG
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if SUPPORT_FILEFORMAT_MP3
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if SUPPORT_FILEFORMAT_QOA
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if SUPPORT_FILEFORMAT_FLAC
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if SUPPORT_FILEFORMAT_XM
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+        ma_mutex_lock(&decoder->lock);
+        decoder->playing = false;
+        decoder->framesDecoded = 0;
+        decoder->queueCount = 0;
+    }
 #endif
-#if SUPPORT_FILEFORMAT_MOD
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+
+    StopAudioStream(music.stream);
+    RewindMusicStream(music);
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+    if (decoder != NULL) ma_mutex_unlock(&decoder->lock);
 #endif
-        default: break;
-    }
 }
 
 // Seek music to a certain position (in seconds)
 void SeekMusicStream(Music music, float position)
 {
-    // Seeking is not supported in module formats
-    if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD)) return;
+    if (music.stream.buffer == NULL) return;
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
+    if (positionInFrames >= music.frameCount) positionInFrames = music.frameCount - 1;
 
-    switch (music.ctxType)
+#if SUPPORT_MUSIC_STREAM_THREADS
+    rMusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL) ma_mutex_lock(&decoder->lock);
+#endif
+
+    // Seek index restores the decoder state from the nearest seek point (MP3 and modules)
+    if (music.stream.buffer->seekIndex != NULL) SeekMusicStreamIndexed(music, positionInFrames);
+    else switch (music.ctxType)
     {
 #if SUPPORT_FILEFORMAT_WAV
         case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
 #endif
 #if SUPPORT_FILEFORMAT_OGG
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek((stb_vorbis *)music.ctxData, positionInFrames); break;
 #endif
 #if SUPPORT_FILEFORMAT_MP3
         case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
@@ -1878,20 +2486,43 @@ void SeekMusicStream(Music music, float position)
         default: break;
     }
 
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    music.stream.buffer->isSubBufferProcessed[0] = true;
-    music.stream.buffer->isSubBufferProcessed[1] = true;
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_atomic_store_32(&music.stream.buffer->framesProcessed, positionInFrames);
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_SEEK, .buffer = music.stream.buffer });
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+    if (decoder != NULL)
+    {
+        // Sub-buffers decoded before seeking are discarded
+        decoder->framesDecoded = positionInFrames;
+        decoder->queueCount = 0;
+        ma_mutex_unlock(&decoder->lock);
+    }
+#endif
 }
 
 // Update (re-fill) music buffers if data already processed
 void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
-    if (!music.stream.buffer->playing) return;
 
-    ma_mutex_lock(&AUDIO.System.lock);
+#if SUPPORT_MUSIC_STREAM_THREADS
+    // Music is decoded by a worker thread, only the looping state is required
+    if (music.stream.buffer->decoder != NULL)
+    {
+        ma_atomic_store_32(&music.stream.buffer->decoder->looping, music.looping);
+        return;
+    }
+#endif
+
+    // Offline rendering keeps refilling the music between periods, with the last state updated by the program
+    if (AUDIO.System.isOffline) music.stream.buffer->offlineMusic = music;
+
+    ma_spinlock_lock(&AUDIO.Command.lock);
+    SyncAudioBufferState(music.stream.buffer);
+    bool playing = music.stream.buffer->queuedPlaying;
+    ma_spinlock_unlock(&AUDIO.Command.lock);
+
+    if (!playing) return;
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
@@ -1918,134 +2549,17 @@ void UpdateMusicStream(Music music)
         if (framesToStream == 0)
         {
             // Check if both buffers have been processed
-            if (music.stream.buffer->isSubBufferProcessed[0] && music.stream.buffer->isSubBufferProcessed[1])
-            {
-                ma_mutex_unlock(&AUDIO.System.lock);
-                StopMusicStream(music);
-                return;
-            }
+            if (IsSubBufferAvailable(music.stream.buffer, 0) && IsSubBufferAvailable(music.stream.buffer, 1)) StopMusicStream(music);
 
-            ma_mutex_unlock(&AUDIO.System.lock);
             return;
         }
 
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
-
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if SUPPORT_FILEFORMAT_WAV
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if SUPPORT_FILEFORMAT_OGG
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if SUPPORT_FILEFORMAT_MP3
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if SUPPORT_FILEFORMAT_QOA
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if SUPPORT_FILEFORMAT_FLAC
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if SUPPORT_FILEFORMAT_XM
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally considering 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if SUPPORT_FILEFORMAT_MOD
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples desired, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+        if (!IsSubBufferAvailable(music.stream.buffer, i)) continue; // No refilling required, move to next sub-buffer
 
-            } break;
-        #endif
-            default: break;
-        }
+        DecodeMusicStreamFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
-        UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+        UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Check if any music is playing
@@ -2072,6 +2586,18 @@ void SetMusicPan(Music music, float pan)
     SetAudioBufferPan(music.stream.buffer, pan);
 }
 
+// Set resampler for music, used on sample rate conversion and pitch
+void SetMusicResampler(Music music, int resampler)
+{
+    SetAudioBufferResampler(music.stream.buffer, resampler);
+}
+
+// Set audio bus a music is mixed into, empty bus for master mix
+void SetMusicBus(Music music, AudioBus bus)
+{
+    SetAudioBufferBus(music.stream.buffer, bus.mix);
+}
+
 // Get music time length (in seconds)
 float GetMusicTimeLength(Music music)
 {
@@ -2086,32 +2612,62 @@ float GetMusicTimeLength(Music music)
 float GetMusicTimePlayed(Music music)
 {
     float secondsPlayed = 0.0f;
-    if (music.stream.buffer != NULL)
+    AudioBuffer *buffer = music.stream.buffer;
+
+    if (buffer == NULL) return secondsPlayed;
+
+    // Queued state and sub-buffers commands are also updated by music decoder threads,
+    // they are read locked (same as IsAudioBufferPlaying())
+    int subBufferSize = (int)buffer->sizeInFrames/2;
+    int framesProcessed = 0;
+    int framesInBuffers = 0;
+
+    ma_spinlock_lock(&AUDIO.Command.lock);
+    SyncAudioBufferState(buffer);
+    bool playing = buffer->queuedPlaying;
+
+    // Sub-buffers submitted before a pending play, stop or seek are discarded by the mixer,
+    // they are considered empty as framesProcessed has already been reset by the program
+    bool resetPending = ((int)(ma_atomic_load_32(&buffer->commandsApplied) - buffer->resetCommand) < 0);
+
+    if (playing)
+    {
+        framesProcessed = (int)ma_atomic_load_32(&buffer->framesProcessed);
+
+        for (int i = 0; i < 2; i++)
+        {
+            bool discarded = resetPending && ((int)(buffer->subBufferCommand[i] - buffer->resetCommand) < 0);
+            if (!discarded && !IsSubBufferAvailable(buffer, i)) framesInBuffers += subBufferSize;
+        }
+    }
+    ma_spinlock_unlock(&AUDIO.Command.lock);
+
+    // Time played is computed from the state queued by the program, a stopped music has not played yet
+    if (playing)
     {
 #if SUPPORT_FILEFORMAT_XM
         if (music.ctxType == MUSIC_MODULE_XM)
         {
             uint64_t framesPlayed = 0;
 
+#if SUPPORT_MUSIC_STREAM_THREADS
+            if (buffer->decoder != NULL) ma_mutex_lock(&buffer->decoder->lock);
+#endif
             jar_xm_get_position((jar_xm_context_t *)music.ctxData, NULL, NULL, NULL, &framesPlayed);
+#if SUPPORT_MUSIC_STREAM_THREADS
+            if (buffer->decoder != NULL) ma_mutex_unlock(&buffer->decoder->lock);
+#endif
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
         }
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
-            int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesInBuffers = framesInFirstBuffer + framesInSecondBuffer;
             if (((unsigned int)framesInBuffers > music.frameCount) && !music.looping) framesInBuffers = music.frameCount;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesSentToMix = resetPending? 0 : (int)(ma_atomic_load_32(&buffer->frameCursorPos)%subBufferSize);
             int framesPlayed = (framesProcessed - framesInBuffers + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
         }
     }
 
@@ -2176,9 +2732,42 @@ void UnloadAudioStream(AudioStream stream)
 // NOTE 2: To dequeue a buffer it needs to be processed: IsAudioStreamProcessed()
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (stream.buffer != NULL)
+    {
+        bool isSubBufferAvailable[2] = { IsSubBufferAvailable(stream.buffer, 0), IsSubBufferAvailable(stream.buffer, 1) };
+
+        if (isSubBufferAvailable[0] || isSubBufferAvailable[1])
+        {
+            // Update the first sub-buffer if both are available, the mixer moves
+            // its cursor to the submitted sub-buffer when there is nothing left to play
+            ma_uint32 subBufferToUpdate = (isSubBufferAvailable[0])? 0 : 1;
+
+            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
+            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+
+            // Does this API expect a whole buffer to be updated in one go?
+            // Assuming so, but if not will need to change this logic
+            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            {
+                ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, frameCount);
+
+                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+
+                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+                memcpy(subBuffer, data, bytesToWrite);
+
+                // Any leftover frames should be filled with zeros
+                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+                // Sub-buffer belongs to the mixer from now on, until it is processed again
+                PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_SUBMIT, .buffer = stream.buffer, .subBuffer = (int)subBufferToUpdate });
+            }
+            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
 }
 
 // Check if any audio stream buffers requires refill
@@ -2186,12 +2775,7 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     bool result = false;
 
-    if (stream.buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (stream.buffer != NULL) result = IsSubBufferAvailable(stream.buffer, 0) || IsSubBufferAvailable(stream.buffer, 1);
 
     return result;
 }
@@ -2244,6 +2828,18 @@ void SetAudioStreamPan(AudioStream stream, float pan)
     SetAudioBufferPan(stream.buffer, pan);
 }
 
+// Set resampler for audio stream, used on sample rate conversion and pitch
+void SetAudioStreamResampler(AudioStream stream, int resampler)
+{
+    SetAudioBufferResampler(stream.buffer, resampler);
+}
+
+// Set audio bus an audio stream is mixed into, empty bus for master mix
+void SetAudioStreamBus(AudioStream stream, AudioBus bus)
+{
+    SetAudioBufferBus(stream.buffer, bus.mix);
+}
+
 // Default size for new audio streams
 void SetAudioStreamBufferSizeDefault(int size)
 {
@@ -2253,12 +2849,7 @@ void SetAudioStreamBufferSizeDefault(int size)
 // Audio thread callback to request new data
 void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
-    if (stream.buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (stream.buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback });
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
@@ -2266,105 +2857,165 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 // a given stream, iterate through the list to find the end. That way there is no need to keep a pointer to the last element
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer != NULL)
+    {
+        rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+        processor->process = process;
+
+        PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor });
+    }
+}
+
+// Remove processor from audio stream
+void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
+{
+    if (stream.buffer != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .callback = process });
+}
 
+// Add processor to audio pipeline. Order of processors is important
+// Works the same way as {Attach,Detach}AudioStreamProcessor() functions, except
+// these two work on the already mixed output before sending it to the sound hardware
+void AttachAudioMixedProcessor(AudioCallback process)
+{
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor });
+}
+
+// Remove processor from audio pipeline
+void DetachAudioMixedProcessor(AudioCallback process)
+{
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .callback = process });
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Audio buses and effects
+//----------------------------------------------------------------------------------
+
+// Load audio bus, a sub-mix processed by an effects chain
+// NOTE: Sounds, music and streams mixed into the bus share its effects, processed once per block,
+// bus is mixed into master mix until a different output is set
+AudioBus LoadAudioBus(void)
+{
+    AudioBus bus = { 0 };
 
-    while (last && last->next)
+    if (!AUDIO.System.isReady)
     {
-        last = last->next;
+        TRACELOG(LOG_WARNING, "BUS: Audio device not initialized, bus could not be created");
+        return bus;
     }
-    if (last)
+
+    rAudioBus *mix = (rAudioBus *)RL_CALLOC(1, sizeof(rAudioBus));
+    if (mix != NULL) mix->frames = (float *)RL_CALLOC(AUDIO_BUS_BLOCK_SIZE*AUDIO.System.device.playback.channels, sizeof(float));
+
+    if ((mix == NULL) || (mix->frames == NULL))
     {
-        processor->prev = last;
-        last->next = processor;
+        TRACELOG(LOG_WARNING, "BUS: Failed to allocate memory for bus");
+        RL_FREE(mix);
+        return bus;
     }
-    else stream.buffer->processor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    mix->volume = 1.0f;
+    mix->mixVolume = 1.0f;
+
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_BUS_TRACK, .bus = mix });
+
+    bus.mix = mix;
+    TRACELOG(LOG_INFO, "BUS: Initialized successfully");
+
+    return bus;
 }
 
-// Remove processor from audio stream
-void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
+// Checks if an audio bus is valid
+bool IsAudioBusValid(AudioBus bus)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    return (bus.mix != NULL);
+}
 
-    rAudioProcessor *processor = stream.buffer->processor;
+// Unload audio bus, audio mixed into it is mixed into the bus output from now on
+// NOTE: Bus memory is freed once the mixer has removed it from the buses list
+void UnloadAudioBus(AudioBus bus)
+{
+    if (bus.mix == NULL) return;
 
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_BUS_RELEASE, .bus = bus.mix });
 
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+    TRACELOG(LOG_INFO, "BUS: Unloaded audio bus data from RAM");
+}
 
-            RL_FREE(processor);
-        }
+// Set audio bus output, empty bus for master mix
+// NOTE: Output that would mix the bus into itself is ignored
+void SetAudioBusOutput(AudioBus bus, AudioBus output)
+{
+    if (bus.mix == NULL) return;
 
-        processor = next;
+    if (output.mix == bus.mix)
+    {
+        TRACELOG(LOG_WARNING, "BUS: Audio bus can not be mixed into itself");
+        return;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_BUS_OUTPUT, .bus = bus.mix, .output = output.mix });
 }
 
-// Add processor to audio pipeline. Order of processors is important
-// Works the same way as {Attach,Detach}AudioStreamProcessor() functions, except
-// these two work on the already mixed output before sending it to the sound hardware
-void AttachAudioMixedProcessor(AudioCallback process)
+// Set volume for audio bus (1.0 is base level)
+void SetAudioBusVolume(AudioBus bus, float volume)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
-    processor->process = process;
+    if (bus.mix != NULL) PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_BUS_VOLUME, .bus = bus.mix, .value = volume });
+}
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
+// Add effect to the end of audio bus effects chain, returns effect index or -1 on failure
+// NOTE: Effect memory is allocated here to keep the mixer real-time
+int AddAudioBusEffect(AudioBus bus, int effect, float param1, float param2, float param3)
+{
+    if (bus.mix == NULL) return -1;
 
-    while (last && last->next)
+    if ((effect < AUDIO_EFFECT_LOWPASS) || (effect > AUDIO_EFFECT_LIMITER))
     {
-        last = last->next;
+        TRACELOG(LOG_WARNING, "BUS: Effect not supported");
+        return -1;
     }
-    if (last)
+
+    if (bus.mix->queuedEffectCount >= MAX_AUDIO_BUS_EFFECTS)
     {
-        processor->prev = last;
-        last->next = processor;
+        TRACELOG(LOG_WARNING, "BUS: Maximum number of effects reached (%i)", MAX_AUDIO_BUS_EFFECTS);
+        return -1;
     }
-    else AUDIO.mixedProcessor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
-}
+    rAudioEffect *audioEffect = LoadAudioEffect(effect, AUDIO.System.device.playback.channels, AUDIO.System.device.sampleRate);
 
-// Remove processor from audio pipeline
-void DetachAudioMixedProcessor(AudioCallback process)
-{
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (audioEffect == NULL)
+    {
+        TRACELOG(LOG_WARNING, "BUS: Failed to allocate memory for effect");
+        return -1;
+    }
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    const float params[3] = { param1, param2, param3 };
+    UpdateAudioEffect(audioEffect, params);
 
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+    // Effect slot is filled before queuing, the mixer only processes the slots it has been told about
+    int index = bus.mix->queuedEffectCount;
+    bus.mix->effects[index] = audioEffect;
+    bus.mix->queuedEffectCount++;
 
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_BUS_ADD_EFFECT, .bus = bus.mix, .effect = audioEffect });
 
-            RL_FREE(processor);
-        }
+    return index;
+}
 
-        processor = next;
+// Set parameters of an audio bus effect
+void SetAudioBusEffect(AudioBus bus, int index, float param1, float param2, float param3)
+{
+    if (bus.mix == NULL) return;
+
+    if ((index < 0) || (index >= (int)bus.mix->queuedEffectCount))
+    {
+        TRACELOG(LOG_WARNING, "BUS: Effect index out of range");
+        return;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((rAudioCommand){ .type = AUDIO_COMMAND_BUS_SET_EFFECT, .bus = bus.mix, .effect = bus.mix->effects[index], .params = { param1, param2, param3 } });
 }
 
 //----------------------------------------------------------------------------------
@@ -2386,7 +3037,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, frameCount);
 
         return frameCount;
     }
@@ -2396,8 +3047,8 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 
     if (currentSubBufferIndex > 1) return 0;
 
-    // Another thread can update the processed state of buffers, so
-    // take a copy here to try and avoid potential synchronization problems
+    // Sub-buffers are only handed to the mixer by queued commands, so the processed
+    // state can not change while reading, but a local copy keeps the loop simple
     bool isSubBufferProcessed[2] = { 0 };
     isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
     isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
@@ -2438,14 +3089,19 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         ma_uint32 framesToRead = totalFramesRemaining;
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
+#if SUPPORT_FILEFORMAT_QOA
+        if (audioBuffer->qoa != NULL) DecodeQoaSoundFrames(audioBuffer, (short *)((unsigned char *)framesOut + (framesRead*frameSizeInBytes)), framesToRead);
+        else
+#endif
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
         // If the end of the buffer is read, mark it as processed
+        // NOTE: Sub-buffer data is released to the program, it can be refilled from now on
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_store_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], MA_TRUE);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -2453,7 +3109,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // Break from this loop if looping not enabled
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                StopAudioBufferInMixer(audioBuffer);
                 break;
             }
         }
@@ -2480,21 +3136,65 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // NOTE: Continuously converting data from the AudioBuffer's internal format to the mixing format,
     // which should be defined by the output format of the data converter
     // This is done until frameCount frames have been output
+
     ma_uint32 bpf = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
-    ma_uint8 inputBuffer[4096] = { 0 };
-    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/bpf;
+    ma_uint8 inputBuffer[4096];
 
-    ma_uint32 totalOutputFramesProcessed = 0;
-    while (totalOutputFramesProcessed < frameCount)
+    // No resampling required (same sample rate and no pitch), converter can be skipped
+    // NOTE: Converter residual frames must be consumed first, they could remain after a pitch change
+    if ((audioBuffer->converter.resampler.sampleRateIn == audioBuffer->converter.resampler.sampleRateOut) &&
+        (audioBuffer->converterResidualCount == 0))
     {
-        float *runningFramesOut = framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut);
-        ma_uint64 outputFramesToProcessThisIteration = frameCount - totalOutputFramesProcessed;
-        //ma_uint64 inputFramesToProcessThisIteration = 0;
+        // Data already in mixing format, read directly
+        if ((audioBuffer->converter.formatIn == ma_format_f32) && (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut))
+        {
+            return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+        }
 
-        // Process any residual input frames from the previous read first
-        if (audioBuffer->converterResidualCount > 0)
+        // Only format and channels conversion required
+        float channelsBuffer[1024];
+        ma_uint32 framesCap = sizeof(channelsBuffer)/sizeof(float)/audioBuffer->converter.channelsIn;
+        if (framesCap > sizeof(inputBuffer)/bpf) framesCap = sizeof(inputBuffer)/bpf;
+
+        ma_uint32 totalFramesRead = 0;
+        while (totalFramesRead < frameCount)
         {
-            ma_uint64 inputFramesProcessedThisIteration = audioBuffer->converterResidualCount;
+            float *runningFramesOut = framesOut + (totalFramesRead*audioBuffer->converter.channelsOut);
+            ma_uint32 framesToRead = frameCount - totalFramesRead;
+            if (framesToRead > framesCap) framesToRead = framesCap;
+
+            ma_uint32 framesRead = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, framesToRead);
+
+            if (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut)
+            {
+                ma_pcm_convert(runningFramesOut, ma_format_f32, inputBuffer, audioBuffer->converter.formatIn, framesRead*audioBuffer->converter.channelsIn, ma_dither_mode_none);
+            }
+            else
+            {
+                ma_pcm_convert(channelsBuffer, ma_format_f32, inputBuffer, audioBuffer->converter.formatIn, framesRead*audioBuffer->converter.channelsIn, ma_dither_mode_none);
+                ma_channel_converter_process_pcm_frames(&audioBuffer->converter.channelConverter, runningFramesOut, channelsBuffer, framesRead);
+            }
+
+            totalFramesRead += framesRead;
+
+            if (framesRead < framesToRead) break;   // Reached the end of the sound
+        }
+
+        return totalFramesRead;
+    }
+    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/bpf;
+
+    ma_uint32 totalOutputFramesProcessed = 0;
+    while (totalOutputFramesProcessed < frameCount)
+    {
+        float *runningFramesOut = framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut);
+        ma_uint64 outputFramesToProcessThisIteration = frameCount - totalOutputFramesProcessed;
+        //ma_uint64 inputFramesToProcessThisIteration = 0;
+
+        // Process any residual input frames from the previous read first
+        if (audioBuffer->converterResidualCount > 0)
+        {
+            ma_uint64 inputFramesProcessedThisIteration = audioBuffer->converterResidualCount;
             ma_uint64 outputFramesProcessedThisIteration = outputFramesToProcessThisIteration;
             ma_data_converter_process_pcm_frames(&audioBuffer->converter, audioBuffer->converterResidual, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
 
@@ -2503,6 +3203,8 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
             audioBuffer->converterResidualCount -= (ma_uint32)inputFramesProcessedThisIteration; // Safe cast
 
             totalOutputFramesProcessed += (ma_uint32)outputFramesProcessedThisIteration; // Safe cast
+
+            if ((inputFramesProcessedThisIteration == 0) && (outputFramesProcessedThisIteration == 0)) break;   // Converter not progressing, avoid spinning the mixer
         }
         else
         {
@@ -2545,6 +3247,8 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
                 audioBuffer->converterResidualCount = (unsigned int)residualFrameCount;
             }
 
+            if ((inputFramesProcessedThisIteration == 0) && (outputFramesProcessedThisIteration == 0)) break;   // Converter not progressing, avoid spinning the mixer
+
             if (inputFramesInInternalFormatCount < estimatedInputFrameCount) break;  // Reached the end of the sound
         }
     }
@@ -2562,93 +3266,123 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     // Mixing is basically an accumulation, need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but it can be reconsidered
-    ma_mutex_lock(&AUDIO.System.lock);
+    // The program is applying the queued commands itself because the device stalled,
+    // the mixer never waits on the program so this period is left silent
+    ma_uint32 expected = 0;
+    if (!ma_atomic_compare_exchange_strong_32(&AUDIO.Command.consumer, &expected, 1)) return;
+
+    // Apply the state changes queued by the program since the previous period,
+    // the mixer never waits on the program so this stays real-time
+    ProcessAudioCommands();
+    UpdateAudioVoices();
+
+    // Audio is mixed in blocks, audio buses process their sub-mix a block at a time
+    for (ma_uint32 frame = 0; frame < frameCount; frame += AUDIO_BUS_BLOCK_SIZE)
+    {
+        ma_uint32 blockSize = ((frameCount - frame) < AUDIO_BUS_BLOCK_SIZE)? (frameCount - frame) : AUDIO_BUS_BLOCK_SIZE;
+        MixAudioBlock((float *)pFramesOut + frame*pDevice->playback.channels, blockSize);
+    }
+
+    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    while (processor)
+    {
+        processor->process(pFramesOut, frameCount);
+        processor = processor->next;
+    }
+
+    ma_atomic_store_32(&AUDIO.Command.consumer, 0);
+}
+
+// Mix playing buffers into an output block, buffers routed to a bus are mixed into its sub-mix
+// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+static void MixAudioBlock(float *framesOut, ma_uint32 frameCount)
+{
+    for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        // Ignore stopped or paused sounds
+        if (!audioBuffer->playing || audioBuffer->paused) continue;
+
+        // Virtual voices are not mixed, they fade out on the period they turn virtual
+        // and fade in again from silence once they are selected to be mixed
+        if (audioBuffer->isVirtual && !audioBuffer->isMixed)
+        {
+            UpdateVirtualAudioVoice(audioBuffer, frameCount);
+            continue;
+        }
+
+        audioBuffer->isMixed = !audioBuffer->isVirtual;
+
+        float *mixOut = (audioBuffer->bus != NULL)? StartAudioBusMix(audioBuffer->bus, frameCount) : framesOut;
+        ma_uint32 framesRead = 0;
+
+        while (1)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            if (framesRead >= frameCount) break;
 
-            ma_uint32 framesRead = 0;
+            // Read as much data as possible from the stream
+            ma_uint32 framesToRead = (frameCount - framesRead);
 
-            while (1)
+            while (framesToRead > 0)
             {
-                if (framesRead >= frameCount) break;
+                float tempBuffer[1024];     // Frames for stereo, only frames read are used
 
-                // Read as much data as possible from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+                ma_uint32 framesToReadRightNow = framesToRead;
+                if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                {
+                    framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                }
 
-                while (framesToRead > 0)
+                ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+                if (framesJustRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float *framesMixed = mixOut + (framesRead*AUDIO.System.device.playback.channels);
+                    float *framesIn = tempBuffer;
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                    // Apply processors chain if defined
+                    rAudioProcessor *processor = audioBuffer->processor;
+                    while (processor)
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        processor->process(framesIn, framesJustRead);
+                        processor = processor->next;
                     }
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
-
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+                    MixAudioFrames(framesMixed, framesIn, framesJustRead, audioBuffer);
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+                    framesToRead -= framesJustRead;
+                    framesRead += framesJustRead;
+                }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+                if (!audioBuffer->playing)
+                {
+                    framesRead = frameCount;
+                    break;
+                }
 
-                    if (!audioBuffer->playing)
+                // If all the frames requested can't be read, break
+                if (framesJustRead < framesToReadRightNow)
+                {
+                    if (!audioBuffer->looping)
                     {
-                        framesRead = frameCount;
+                        StopAudioBufferInMixer(audioBuffer);
                         break;
                     }
-
-                    // If all the frames requested can't be read, break
-                    if (framesJustRead < framesToReadRightNow)
+                    else
                     {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        // Should never get here, but for safety,
+                        // move the cursor position back to the start and continue the loop
+                        ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
+                        continue;
                     }
                 }
-
-                // If for some reason is not possible to read every frame, the loop needs to be broken
-                // Not doing this could theoretically eend up into an infinite loop
-                if (framesToRead > 0) break;
             }
-        }
-    }
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-    while (processor)
-    {
-        processor->process(pFramesOut, frameCount);
-        processor = processor->next;
+            // If for some reason is not possible to read every frame, the loop needs to be broken
+            // Not doing this could theoretically eend up into an infinite loop
+            if (framesToRead > 0) break;
+        }
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    MixAudioBuses(framesOut, frameCount);
 }
 
 // Main mixing function, pretty simple in this project, only an accumulation
@@ -2658,118 +3392,1937 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
     const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
 
-    if (channels == 2)  // Consider panning
+    float levels[2] = { localVolume, localVolume };
+
+    if (buffer->isVirtual) levels[0] = levels[1] = 0.0f;    // Voice turning virtual, fade out
+    else if (channels == 2)  // Consider panning
     {
         const float right = (buffer->pan + 1.0f)/2.0f; // Normalize: [-1..1] -> [0..1]
         const float left = 1.0f - right;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        levels[0] = localVolume*0.5f*left*(3.0f - left*left);
+        levels[1] = localVolume*0.5f*right*(3.0f - right*right);
+    }
+
+    // Volume and pan changes are ramped linearly across the frames mixed to avoid clicks,
+    // playback starts directly at the requested levels
+    if (!buffer->mixLevelsReady)
+    {
+        buffer->mixLevels[0] = levels[0];
+        buffer->mixLevels[1] = levels[1];
+        buffer->mixLevelsReady = true;
+    }
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    const float levelSteps[2] = { (levels[0] - buffer->mixLevels[0])/frameCount, (levels[1] - buffer->mixLevels[1])/frameCount };
+
+    if (channels == 2) MixStereoAudioSamples(framesOut, framesIn, frameCount, buffer->mixLevels, levelSteps);
+    else if ((channels == 1) || (levelSteps[0] == 0.0f)) MixAudioSamples(framesOut, framesIn, frameCount*channels, buffer->mixLevels[0], levelSteps[0]);
+    else
+    {
+        // Multichannel ramp, the gain steps once per frame
+        float gain = buffer->mixLevels[0];
 
         for (ma_uint32 frame = 0; frame < frameCount; frame++)
         {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
-
-            frameOut += 2;
-            frameIn += 2;
+            MixAudioSamples(framesOut + frame*channels, framesIn + frame*channels, channels, gain, 0.0f);
+            gain += levelSteps[0];
         }
     }
-    else  // Do not consider panning
+
+    buffer->mixLevels[0] = levels[0];
+    buffer->mixLevels[1] = levels[1];
+}
+
+// Accumulate samples multiplied by gain into the output, gain increases by gainStep on every sample
+// NOTE: Used for mono output and for any channels count when gain is constant (gainStep = 0.0f)
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gain, float gainStep)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SSE2_ENABLED)
+    __m128 gains = _mm_setr_ps(gain, gain + gainStep, gain + 2.0f*gainStep, gain + 3.0f*gainStep);
+    const __m128 steps = _mm_set1_ps(4.0f*gainStep);
+
+    for (; i + 4 <= sampleCount; i += 4)
+    {
+        __m128 mixed = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gains));
+        _mm_storeu_ps(samplesOut + i, mixed);
+        gains = _mm_add_ps(gains, steps);
+    }
+#elif defined(RAUDIO_NEON_ENABLED)
+    const float initGains[4] = { gain, gain + gainStep, gain + 2.0f*gainStep, gain + 3.0f*gainStep };
+    float32x4_t gains = vld1q_f32(initGains);
+    const float32x4_t steps = vdupq_n_f32(4.0f*gainStep);
+
+    for (; i + 4 <= sampleCount; i += 4)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        vst1q_f32(samplesOut + i, vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), gains));
+        gains = vaddq_f32(gains, steps);
+    }
+#endif
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    gain += i*gainStep;
+
+    for (; i < sampleCount; i++)
+    {
+        samplesOut[i] += (samplesIn[i]*gain);
+        gain += gainStep;
     }
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+// Accumulate stereo frames multiplied by left/right gains into the output, gains increase by gainStep on every frame
+static void MixStereoAudioSamples(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *gain, const float *gainStep)
 {
-    bool result = false;
+    ma_uint32 frame = 0;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+#if defined(RAUDIO_SSE2_ENABLED)
+    // Two stereo frames processed per vector: L0 R0 L1 R1
+    __m128 gains = _mm_setr_ps(gain[0], gain[1], gain[0] + gainStep[0], gain[1] + gainStep[1]);
+    const __m128 steps = _mm_setr_ps(2.0f*gainStep[0], 2.0f*gainStep[1], 2.0f*gainStep[0], 2.0f*gainStep[1]);
 
-    return result;
+    for (; frame + 2 <= frameCount; frame += 2)
+    {
+        __m128 mixed = _mm_add_ps(_mm_loadu_ps(framesOut + frame*2), _mm_mul_ps(_mm_loadu_ps(framesIn + frame*2), gains));
+        _mm_storeu_ps(framesOut + frame*2, mixed);
+        gains = _mm_add_ps(gains, steps);
+    }
+#elif defined(RAUDIO_NEON_ENABLED)
+    const float initGains[4] = { gain[0], gain[1], gain[0] + gainStep[0], gain[1] + gainStep[1] };
+    const float initSteps[4] = { 2.0f*gainStep[0], 2.0f*gainStep[1], 2.0f*gainStep[0], 2.0f*gainStep[1] };
+    float32x4_t gains = vld1q_f32(initGains);
+    const float32x4_t steps = vld1q_f32(initSteps);
+
+    for (; frame + 2 <= frameCount; frame += 2)
+    {
+        vst1q_f32(framesOut + frame*2, vmlaq_f32(vld1q_f32(framesOut + frame*2), vld1q_f32(framesIn + frame*2), gains));
+        gains = vaddq_f32(gains, steps);
+    }
+#endif
+
+    float left = gain[0] + frame*gainStep[0];
+    float right = gain[1] + frame*gainStep[1];
+
+    for (; frame < frameCount; frame++)
+    {
+        framesOut[frame*2] += (framesIn[frame*2]*left);
+        framesOut[frame*2 + 1] += (framesIn[frame*2 + 1]*right);
+
+        left += gainStep[0];
+        right += gainStep[1];
+    }
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+// Queue a command to be applied by the mixer at the start of the next audio period
+// NOTE: Without a running audio device the command is applied directly
+static void PushAudioCommand(rAudioCommand command)
 {
+    AudioBuffer *buffer = command.buffer;
+    bool queued = (AUDIO.System.isReady && !AUDIO.System.isOffline);
+
+    ma_spinlock_lock(&AUDIO.Command.lock);
+
+    if (queued)
+    {
+        // Wait for the mixer to make room, it only happens if many commands are queued in a single period,
+        // the lock is released while sleeping so other producers are not blocked behind this one
+        for (int waitTime = 0; (AUDIO.Command.head - ma_atomic_load_32(&AUDIO.Command.tail)) >= AUDIO_COMMAND_QUEUE_SIZE; waitTime++)
+        {
+            if (ProcessStalledAudioCommands(waitTime)) break;
+
+            ma_spinlock_unlock(&AUDIO.Command.lock);
+            ma_sleep(1);
+            ma_spinlock_lock(&AUDIO.Command.lock);
+        }
+    }
+
     if (buffer != NULL)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        // Keep track of the state the buffer will have once the command is applied
+        SyncAudioBufferState(buffer);
+
+        switch (command.type)
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            case AUDIO_COMMAND_PLAY:
+            {
+                buffer->queuedPlaying = true;
+                buffer->queuedPaused = false;
+                ma_atomic_store_32(&buffer->framesProcessed, 0);
+            } break;
+            case AUDIO_COMMAND_STOP:
+            {
+                buffer->queuedPlaying = false;
+                buffer->queuedPaused = false;
+                ma_atomic_store_32(&buffer->framesProcessed, 0);
+            } break;
+            case AUDIO_COMMAND_PAUSE: buffer->queuedPaused = true; break;
+            case AUDIO_COMMAND_RESUME: buffer->queuedPaused = false; break;
+            default: break;
         }
+
+        buffer->commandCount++;
+        if (command.type == AUDIO_COMMAND_SUBMIT) buffer->subBufferCommand[command.subBuffer] = buffer->commandCount;
+        else if ((command.type == AUDIO_COMMAND_PLAY) || (command.type == AUDIO_COMMAND_STOP) || (command.type == AUDIO_COMMAND_SEEK)) buffer->resetCommand = buffer->commandCount;
+    }
+
+    if (queued)
+    {
+        AUDIO.Command.queue[AUDIO.Command.head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+        ma_atomic_store_32(&AUDIO.Command.head, AUDIO.Command.head + 1);
     }
+    else ApplyAudioCommand(&command);
+
+    ma_spinlock_unlock(&AUDIO.Command.lock);
+
+    FreeReleasedAudioData();
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+// Apply all the commands queued by the program, called by the audio thread
+static void ProcessAudioCommands(void)
 {
-    if (stream.buffer != NULL)
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Command.head);
+    ma_uint32 tail = AUDIO.Command.tail;
+
+    for (; tail != head; tail++) ApplyAudioCommand(&AUDIO.Command.queue[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)]);
+
+    ma_atomic_store_32(&AUDIO.Command.tail, tail);
+}
+
+// Apply the queued commands from the program thread if the mixer stopped applying them,
+// the device is not started or it did not call back for AUDIO_COMMAND_WAIT_TIMEOUT milliseconds
+// NOTE: Returns false if the mixer is running, it keeps applying the commands itself
+static bool ProcessStalledAudioCommands(int waitTime)
+{
+    if ((ma_device_get_state(&AUDIO.System.device) == ma_device_state_started) && (waitTime < AUDIO_COMMAND_WAIT_TIMEOUT)) return false;
+
+    ma_uint32 expected = 0;
+    if (!ma_atomic_compare_exchange_strong_32(&AUDIO.Command.consumer, &expected, 1)) return false;
+
+    ProcessAudioCommands();
+    ma_atomic_store_32(&AUDIO.Command.consumer, 0);
+
+    return true;
+}
+
+// Apply a command to the mixer state
+// NOTE: Only the mixer modifies the list of audio buffers and their playback state
+static void ApplyAudioCommand(const rAudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        case AUDIO_COMMAND_TRACK:
+        {
+            if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+            else
+            {
+                AUDIO.Buffer.last->next = buffer;
+                buffer->prev = AUDIO.Buffer.last;
+            }
+
+            AUDIO.Buffer.last = buffer;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        case AUDIO_COMMAND_RELEASE:
         {
-            ma_uint32 subBufferToUpdate = 0;
+            if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+            else buffer->prev->next = buffer->next;
+
+            if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+            else buffer->next->prev = buffer->prev;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            buffer->prev = NULL;
+            buffer->next = NULL;
+
+            if (command->type == AUDIO_COMMAND_RELEASE)
             {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+                // Hand the buffer back to the program to be freed, it can not be accessed anymore
+                void *released = ma_atomic_load_ptr(&AUDIO.Command.releasedBuffers);
+                do
+                {
+                    buffer->next = (AudioBuffer *)released;
+                } while (!ma_atomic_compare_exchange_weak_ptr(&AUDIO.Command.releasedBuffers, &released, buffer));
+
+                return;
             }
-            else
+        } break;
+        case AUDIO_COMMAND_PLAY:
+        {
+            ma_atomic_store_32(&buffer->playing, MA_TRUE);
+            ma_atomic_store_32(&buffer->paused, MA_FALSE);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], MA_TRUE);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], MA_TRUE);
+            buffer->mixLevelsReady = false;
+        } break;
+        case AUDIO_COMMAND_STOP: StopAudioBufferInMixer(buffer); break;
+        case AUDIO_COMMAND_PAUSE: ma_atomic_store_32(&buffer->paused, MA_TRUE); break;
+        case AUDIO_COMMAND_RESUME: ma_atomic_store_32(&buffer->paused, MA_FALSE); break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            // Pitching is an adjustment of the sample rate
+            // Note that this changes the duration of the sound:
+            //  - higher pitches will make the sound faster
+            //  - lower pitches make it slower
+            ma_uint32 outputSampleRate = (ma_uint32)((float)AUDIO.System.device.sampleRate/command->value);
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command->value;
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+        case AUDIO_COMMAND_PRIORITY: buffer->priority = (int)command->value; break;
+        case AUDIO_COMMAND_RESAMPLER:
+        {
+            // Converter is initialized again on the heap allocated by the program,
+            // previous heap is handed back to the program to be freed
+            ma_data_converter_config config = GetAudioConverterConfig(buffer->converter.formatIn, buffer->converter.channelsIn, buffer->converter.sampleRateIn, (int)command->value);
+            void *heap = buffer->converter._pHeap;
+
+            buffer->converter._ownsHeap = MA_FALSE;
+            ma_data_converter_uninit(&buffer->converter, NULL);
+            ma_data_converter_init_preallocated(&config, command->heap, &buffer->converter);
+            buffer->converter._ownsHeap = MA_TRUE;     // Heap allocated with ma_malloc(), freed on unloading
+
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, (ma_uint32)((float)AUDIO.System.device.sampleRate/buffer->pitch));
+            buffer->converterResidualCount = 0;
+            buffer->resampler = (int)command->value;
+
+            if (heap != NULL)
             {
-                // Update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                void *released = ma_atomic_load_ptr(&AUDIO.Command.releasedHeaps);
+                do
+                {
+                    *(void **)heap = released;
+                } while (!ma_atomic_compare_exchange_weak_ptr(&AUDIO.Command.releasedHeaps, &released, heap));
             }
+        } break;
+        case AUDIO_COMMAND_SEEK:
+        {
+            // Data streamed before seeking is discarded, sub-buffers are released to be refilled
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], MA_TRUE);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], MA_TRUE);
+        } break;
+        case AUDIO_COMMAND_SUBMIT:
+        {
+            // If the cursor is waiting on a processed sub-buffer there is nothing left
+            // to play, so playback continues from the start of the submitted one
+            ma_uint32 subBufferSizeInFrames = buffer->sizeInFrames/2;
+            ma_uint32 currentSubBufferIndex = buffer->frameCursorPos/subBufferSizeInFrames;
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+            if ((currentSubBufferIndex > 1) || buffer->isSubBufferProcessed[currentSubBufferIndex])
+            {
+                ma_atomic_store_32(&buffer->frameCursorPos, subBufferSizeInFrames*command->subBuffer);
+            }
 
-            stream.buffer->framesProcessed += frameCount;
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[command->subBuffer], MA_FALSE);
+        } break;
+        case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+        case AUDIO_COMMAND_ATTACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *last = *first;
 
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            while (last && last->next) last = last->next;
+
+            if (last)
             {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+                command->processor->prev = last;
+                last->next = command->processor;
+            }
+            else *first = command->processor;
+        } break;
+        case AUDIO_COMMAND_DETACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *processor = *first;
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                rAudioProcessor *prev = processor->prev;
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+                if (processor->process == command->callback)
+                {
+                    if (*first == processor) *first = next;
+                    if (prev) prev->next = next;
+                    if (next) next->prev = prev;
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+                    // Hand the processor back to the program to be freed
+                    void *released = ma_atomic_load_ptr(&AUDIO.Command.releasedProcessors);
+                    do
+                    {
+                        processor->next = (rAudioProcessor *)released;
+                    } while (!ma_atomic_compare_exchange_weak_ptr(&AUDIO.Command.releasedProcessors, &released, processor));
+                }
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+                processor = next;
             }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
-        }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+        } break;
+        case AUDIO_COMMAND_ROUTE: buffer->bus = command->output; break;
+        case AUDIO_COMMAND_BUS_TRACK:
+        {
+            command->bus->next = AUDIO.Bus.first;
+            AUDIO.Bus.first = command->bus;
+            SortAudioBuses();
+        } break;
+        case AUDIO_COMMAND_BUS_RELEASE:
+        {
+            rAudioBus *bus = command->bus;
+
+            // Audio mixed into the bus is mixed into the bus output from now on
+            for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+            {
+                if (audioBuffer->bus == bus) audioBuffer->bus = bus->output;
+            }
+
+            for (rAudioBus *other = AUDIO.Bus.first; other != NULL; other = other->next)
+            {
+                if (other->output == bus) other->output = bus->output;
+            }
+
+            rAudioBus **link = &AUDIO.Bus.first;
+            while (*link != bus) link = &(*link)->next;
+            *link = bus->next;
+
+            SortAudioBuses();
+
+            // Hand the bus back to the program to be freed
+            void *released = ma_atomic_load_ptr(&AUDIO.Command.releasedBuses);
+            do
+            {
+                bus->next = (rAudioBus *)released;
+            } while (!ma_atomic_compare_exchange_weak_ptr(&AUDIO.Command.releasedBuses, &released, bus));
+        } break;
+        case AUDIO_COMMAND_BUS_OUTPUT:
+        {
+            // Routing a bus into itself, directly or through other buses, is ignored
+            rAudioBus *output = command->output;
+            while ((output != NULL) && (output != command->bus)) output = output->output;
+
+            if (output == NULL)
+            {
+                command->bus->output = command->output;
+                SortAudioBuses();
+            }
+        } break;
+        case AUDIO_COMMAND_BUS_VOLUME: command->bus->volume = command->value; break;
+        case AUDIO_COMMAND_BUS_ADD_EFFECT:
+        case AUDIO_COMMAND_BUS_SET_EFFECT:
+        {
+            rAudioBus *bus = command->bus;
+
+            if (command->type == AUDIO_COMMAND_BUS_ADD_EFFECT) bus->effectCount++;
+            else UpdateAudioEffect(command->effect, command->params);
+
+            // Bus keeps being processed after its input turns silent, until effects tails fade out
+            bus->tailLength = 0;
+            for (unsigned int i = 0; i < bus->effectCount; i++) bus->tailLength += bus->effects[i]->tailFrames;
+        } break;
+        default: break;
+    }
+
+    // Report the command as applied, once its effect is visible
+    if (buffer != NULL) ma_atomic_store_32(&buffer->commandsApplied, buffer->commandsApplied + 1);
+}
+
+// Free the buffers, processors and buses handed back by the mixer
+static void FreeReleasedAudioData(void)
+{
+    AudioBuffer *buffer = (AudioBuffer *)ma_atomic_exchange_ptr(&AUDIO.Command.releasedBuffers, NULL);
+
+    while (buffer != NULL)
+    {
+        AudioBuffer *next = buffer->next;
+
+        ma_data_converter_uninit(&buffer->converter, NULL);
+        RL_FREE(buffer->converterResidual);
+        if (!buffer->sharedData) RL_FREE(buffer->data);
+#if SUPPORT_FILEFORMAT_QOA
+        RL_FREE(buffer->qoa);
+#endif
+        RL_FREE(buffer);
+
+        buffer = next;
+    }
+
+    void *heap = ma_atomic_exchange_ptr(&AUDIO.Command.releasedHeaps, NULL);
+
+    while (heap != NULL)
+    {
+        void *next = *(void **)heap;
+        ma_free(heap, NULL);
+        heap = next;
+    }
+
+    rAudioProcessor *processor = (rAudioProcessor *)ma_atomic_exchange_ptr(&AUDIO.Command.releasedProcessors, NULL);
+
+    while (processor != NULL)
+    {
+        rAudioProcessor *next = processor->next;
+        RL_FREE(processor);
+        processor = next;
+    }
+
+    rAudioBus *bus = (rAudioBus *)ma_atomic_exchange_ptr(&AUDIO.Command.releasedBuses, NULL);
+
+    while (bus != NULL)
+    {
+        rAudioBus *next = bus->next;
+
+        for (unsigned int i = 0; i < bus->queuedEffectCount; i++) UnloadAudioEffect(bus->effects[i]);
+        RL_FREE(bus->frames);
+        RL_FREE(bus);
+
+        bus = next;
+    }
+}
+
+// Refresh the buffer queued state from the mixer state, once all its commands are applied
+static void SyncAudioBufferState(AudioBuffer *buffer)
+{
+    if (ma_atomic_load_32(&buffer->commandsApplied) == buffer->commandCount)
+    {
+        buffer->queuedPlaying = ma_atomic_load_32(&buffer->playing);
+        buffer->queuedPaused = ma_atomic_load_32(&buffer->paused);
     }
 }
 
+// Wait for the mixer to apply all the commands queued for a buffer
+// NOTE: It takes one audio period at most, no wait is required if there are no commands pending,
+// if the device stalls the commands are applied by the program after AUDIO_COMMAND_WAIT_TIMEOUT
+static void WaitAudioBufferCommands(AudioBuffer *buffer)
+{
+    for (int waitTime = 0; AUDIO.System.isReady && (ma_atomic_load_32(&buffer->commandsApplied) != buffer->commandCount); waitTime++)
+    {
+        // Commands are applied by the program if the device stops calling back
+        if (ProcessStalledAudioCommands(waitTime)) break;
+
+        ma_sleep(1);
+    }
+}
+
+// Check if a stream sub-buffer has been processed by the mixer and its data can be refilled
+// NOTE: Submitted sub-buffers are not available until the mixer receives and processes them
+static bool IsSubBufferAvailable(AudioBuffer *buffer, int index)
+{
+    bool submitted = ((int)(ma_atomic_load_32(&buffer->commandsApplied) - buffer->subBufferCommand[index]) < 0);
+
+    return (!submitted && ma_atomic_load_32(&buffer->isSubBufferProcessed[index]));
+}
+
+// Stop an audio buffer from the mixer, called by the audio thread
+static void StopAudioBufferInMixer(AudioBuffer *buffer)
+{
+    if (buffer->playing && !buffer->paused)
+    {
+        ma_atomic_store_32(&buffer->playing, MA_FALSE);
+        ma_atomic_store_32(&buffer->paused, MA_FALSE);
+        ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[0], MA_TRUE);
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[1], MA_TRUE);
+    }
+}
+
+// Select the sounds to be mixed on current period, called by the audio thread
+// NOTE: Only sounds are managed as voices, audio streams are always mixed
+static void UpdateAudioVoices(void)
+{
+    ma_uint32 limit = ma_atomic_load_32(&AUDIO.Voices.limit);
+    ma_uint32 voiceCount = 0;       // Sounds playing
+    ma_uint32 realCount = 0;        // Sounds selected to be mixed
+    ma_uint32 heapCount = 0;        // Sounds selected when limited, heap root is the first one to be discarded
+    AudioBuffer **heap = AUDIO.Voices.real;
+
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        if (!buffer->playing || buffer->paused || (buffer->usage != AUDIO_BUFFER_USAGE_STATIC)) continue;
+
+        voiceCount++;
+        buffer->isVirtual = true;
+
+        // Audibility only considers sound volume, any distance attenuation is expected to be applied on it
+        if (buffer->volume < AUDIO_VOICE_AUDIBILITY_MIN) continue;
+
+        if (limit == 0)
+        {
+            buffer->isVirtual = false;
+            realCount++;
+        }
+        else if (heapCount < limit)
+        {
+            // Add voice to the heap, sift it up
+            ma_uint32 i = heapCount++;
+            while ((i > 0) && IsAudioVoiceKept(heap[(i - 1)/2], buffer))
+            {
+                heap[i] = heap[(i - 1)/2];
+                i = (i - 1)/2;
+            }
+            heap[i] = buffer;
+        }
+        else if (IsAudioVoiceKept(buffer, heap[0]))
+        {
+            // Replace the least important voice selected, sift the new one down
+            ma_uint32 i = 0;
+            while (true)
+            {
+                ma_uint32 child = 2*i + 1;
+                if (child >= heapCount) break;
+                if ((child + 1 < heapCount) && IsAudioVoiceKept(heap[child], heap[child + 1])) child++;
+                if (IsAudioVoiceKept(heap[child], buffer)) break;
+
+                heap[i] = heap[child];
+                i = child;
+            }
+            heap[i] = buffer;
+        }
+    }
+
+    for (ma_uint32 i = 0; i < heapCount; i++) heap[i]->isVirtual = false;
+    realCount += heapCount;
+
+    ma_atomic_store_32(&AUDIO.Voices.realCount, realCount);
+    ma_atomic_store_32(&AUDIO.Voices.virtualCount, voiceCount - realCount);
+}
+
+// Check if voice is kept over other voice when voices limit is reached,
+// priority is considered first and audibility (volume) after it
+static bool IsAudioVoiceKept(const AudioBuffer *voice, const AudioBuffer *other)
+{
+    if (voice->priority != other->priority) return (voice->priority > other->priority);
+
+    return (voice->volume > other->volume);
+}
+
+// Advance virtual voice cursor as if it was mixed, stop it at the end if not looping
+static void UpdateVirtualAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    // Frames consumed from the buffer, considering sample rate conversion and pitch
+    ma_uint32 framesToSkip = (ma_uint32)((ma_uint64)frameCount*buffer->converter.resampler.sampleRateIn/buffer->converter.resampler.sampleRateOut);
+    ma_uint32 frameCursorPos = buffer->frameCursorPos + framesToSkip;
+
+    buffer->converterResidualCount = 0;
+
+    // Mixing is resumed from silence
+    buffer->mixLevels[0] = 0.0f;
+    buffer->mixLevels[1] = 0.0f;
+    buffer->mixLevelsReady = true;
+
+    if (frameCursorPos >= buffer->sizeInFrames)
+    {
+        if (buffer->looping) frameCursorPos %= buffer->sizeInFrames;
+        else
+        {
+            StopAudioBufferInMixer(buffer);
+            return;
+        }
+    }
+
+    ma_atomic_store_32(&buffer->frameCursorPos, frameCursorPos);
+}
+
+// Get audio bus sub-mix block to mix into, called by the audio thread
+// NOTE: Block is only cleared when the bus receives audio, silent buses are not touched
+static float *StartAudioBusMix(rAudioBus *bus, ma_uint32 frameCount)
+{
+    if (!bus->isMixed)
+    {
+        memset(bus->frames, 0, frameCount*AUDIO.System.device.playback.channels*sizeof(float));
+        bus->isMixed = true;
+    }
+
+    return bus->frames;
+}
+
+// Process buses effects chains and mix them into their outputs, called by the audio thread
+// NOTE: Buses without input are skipped once their effects tails have faded out
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    // Buses are sorted so every bus is mixed into its output before the output is processed
+    for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next)
+    {
+        if (bus->isMixed) bus->tailFrames = bus->tailLength;
+        else if (bus->tailFrames > 0)
+        {
+            // Input turned silent, effects keep running on silence until their tail fades out
+            memset(bus->frames, 0, frameCount*channels*sizeof(float));
+            bus->tailFrames = (bus->tailFrames > frameCount)? (bus->tailFrames - frameCount) : 0;
+        }
+        else
+        {
+            // Silent sub-mix, effects and mixing are skipped, volume changes apply directly
+            bus->mixVolume = bus->volume;
+            continue;
+        }
+
+        for (unsigned int i = 0; i < bus->effectCount; i++) ProcessAudioEffect(bus->effects[i], bus->frames, frameCount);
+
+        // Volume changes are ramped linearly across the block to avoid clicks
+        float *mixOut = (bus->output != NULL)? StartAudioBusMix(bus->output, frameCount) : framesOut;
+        const float volumeStep = (bus->volume - bus->mixVolume)/frameCount;
+
+        if (channels == 2)
+        {
+            const float gain[2] = { bus->mixVolume, bus->mixVolume };
+            const float gainStep[2] = { volumeStep, volumeStep };
+
+            MixStereoAudioSamples(mixOut, bus->frames, frameCount, gain, gainStep);
+        }
+        else MixAudioSamples(mixOut, bus->frames, frameCount*channels, bus->mixVolume, volumeStep/channels);
+
+        bus->mixVolume = bus->volume;
+        bus->isMixed = false;
+    }
+}
+
+// Sort buses list by depth, deeper buses first, called by the audio thread
+// NOTE: Only required when buses routing changes, bus chains are expected to be short
+static void SortAudioBuses(void)
+{
+    rAudioBus *sorted = NULL;
+    rAudioBus *bus = AUDIO.Bus.first;
+
+    while (bus != NULL)
+    {
+        rAudioBus *next = bus->next;
+
+        bus->depth = 0;
+        for (rAudioBus *output = bus->output; output != NULL; output = output->output) bus->depth++;
+
+        rAudioBus **link = &sorted;
+        while ((*link != NULL) && ((*link)->depth >= bus->depth)) link = &(*link)->next;
+
+        bus->next = *link;
+        *link = bus;
+
+        bus = next;
+    }
+
+    AUDIO.Bus.first = sorted;
+}
+
+// Load audio effect, state and delay lines are allocated with it
+// NOTE: Delay lines are sized for the maximum delay time, parameters can change while mixing
+static rAudioEffect *LoadAudioEffect(int type, unsigned int channels, unsigned int sampleRate)
+{
+    // Freeverb comb and all-pass filters lengths, in frames at 44100 Hz, channels spread apart
+    static const unsigned int combTuning[AUDIO_REVERB_COMB_FILTERS] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+    static const unsigned int allpassTuning[AUDIO_REVERB_ALLPASS_FILTERS] = { 556, 441, 341, 225 };
+    const unsigned int stereoSpread = 23;
+
+    rAudioEffect *effect = (rAudioEffect *)RL_CALLOC(1, sizeof(rAudioEffect));
+    if (effect == NULL) return NULL;
+
+    effect->type = type;
+    effect->channels = channels;
+    effect->sampleRate = sampleRate;
+    effect->state = (float *)RL_CALLOC(2*channels, sizeof(float));
+
+    if (type == AUDIO_EFFECT_DELAY) effect->lineCount = 1;
+    else if (type == AUDIO_EFFECT_REVERB) effect->lineCount = (AUDIO_REVERB_COMB_FILTERS + AUDIO_REVERB_ALLPASS_FILTERS)*channels;
+    else if (type == AUDIO_EFFECT_LIMITER) effect->state[0] = 1.0f;    // Limiter gain
+
+    if (effect->lineCount > 0)
+    {
+        effect->lines = (rAudioDelayLine *)RL_CALLOC(effect->lineCount, sizeof(rAudioDelayLine));
+
+        if (type == AUDIO_EFFECT_DELAY) effect->lines[0].length = (unsigned int)(AUDIO_EFFECT_DELAY_MAX_TIME*sampleRate)*channels;
+        else
+        {
+            for (unsigned int channel = 0; channel < channels; channel++)
+            {
+                rAudioDelayLine *lines = effect->lines + channel*(AUDIO_REVERB_COMB_FILTERS + AUDIO_REVERB_ALLPASS_FILTERS);
+
+                for (int i = 0; i < AUDIO_REVERB_COMB_FILTERS; i++) lines[i].length = (combTuning[i] + channel*stereoSpread)*sampleRate/44100;
+                for (int i = 0; i < AUDIO_REVERB_ALLPASS_FILTERS; i++) lines[AUDIO_REVERB_COMB_FILTERS + i].length = (allpassTuning[i] + channel*stereoSpread)*sampleRate/44100;
+            }
+        }
+
+        // All lines share a single allocation
+        unsigned int sampleCount = 0;
+        for (unsigned int i = 0; i < effect->lineCount; i++) sampleCount += effect->lines[i].length;
+
+        float *samples = (float *)RL_CALLOC(sampleCount, sizeof(float));
+
+        if (samples == NULL)
+        {
+            UnloadAudioEffect(effect);
+            return NULL;
+        }
+
+        for (unsigned int i = 0; i < effect->lineCount; i++)
+        {
+            effect->lines[i].samples = samples;
+            samples += effect->lines[i].length;
+        }
+    }
+
+    return effect;
+}
+
+// Unload audio effect
+static void UnloadAudioEffect(rAudioEffect *effect)
+{
+    if (effect == NULL) return;
+
+    if (effect->lines != NULL) RL_FREE(effect->lines[0].samples);
+    RL_FREE(effect->lines);
+    RL_FREE(effect->state);
+    RL_FREE(effect);
+}
+
+// Compute audio effect coefficients and tail length from its parameters
+// NOTE: Called by the program when the effect is added and by the audio thread when parameters change
+static void UpdateAudioEffect(rAudioEffect *effect, const float *params)
+{
+    const float pi = 3.14159265358979323846f;
+    const float sampleRate = (float)effect->sampleRate;
+    const float silence = 0.0001f;     // Tails end once they fade out below -80 dB
+
+    for (int i = 0; i < 3; i++) effect->params[i] = params[i];
+
+    switch (effect->type)
+    {
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
+        case AUDIO_EFFECT_BANDPASS:
+        case AUDIO_EFFECT_PEAKING:
+        {
+            // Biquad coefficients, from Audio EQ Cookbook (Robert Bristow-Johnson)
+            float frequency = params[0];
+            if (frequency < 10.0f) frequency = 10.0f;
+            else if (frequency > 0.49f*sampleRate) frequency = 0.49f*sampleRate;
+
+            float q = (params[1] > 0.0f)? params[1] : 0.7071f;
+            if (q > 100.0f) q = 100.0f;
+
+            float w = 2.0f*pi*frequency/sampleRate;
+            float cosw = cosf(w);
+            float alpha = sinf(w)/(2.0f*q);
+            float gain = powf(10.0f, params[2]/40.0f);
+
+            float b[3] = { 0 };
+            float a[3] = { 1.0f + alpha, -2.0f*cosw, 1.0f - alpha };
+
+            if (effect->type == AUDIO_EFFECT_LOWPASS)
+            {
+                b[0] = (1.0f - cosw)/2.0f;
+                b[1] = 1.0f - cosw;
+                b[2] = b[0];
+            }
+            else if (effect->type == AUDIO_EFFECT_HIGHPASS)
+            {
+                b[0] = (1.0f + cosw)/2.0f;
+                b[1] = -(1.0f + cosw);
+                b[2] = b[0];
+            }
+            else if (effect->type == AUDIO_EFFECT_BANDPASS)
+            {
+                b[0] = alpha;
+                b[1] = 0.0f;
+                b[2] = -alpha;
+            }
+            else
+            {
+                b[0] = 1.0f + alpha*gain;
+                b[1] = -2.0f*cosw;
+                b[2] = 1.0f - alpha*gain;
+                a[0] = 1.0f + alpha/gain;
+                a[2] = 1.0f - alpha/gain;
+            }
+
+            effect->coeffs[0] = b[0]/a[0];
+            effect->coeffs[1] = b[1]/a[0];
+            effect->coeffs[2] = b[2]/a[0];
+            effect->coeffs[3] = a[1]/a[0];
+            effect->coeffs[4] = a[2]/a[0];
+
+            // Filter ringing decays by exp(-w/(2*Q)) per frame
+            effect->tailFrames = (unsigned int)(-logf(silence)*2.0f*((q > 0.5f)? q : 0.5f)/w) + 1;
+        } break;
+        case AUDIO_EFFECT_DELAY:
+        {
+            unsigned int maxFrames = (unsigned int)(AUDIO_EFFECT_DELAY_MAX_TIME*sampleRate);
+            unsigned int frames = (params[0] > 0.0f)? (unsigned int)(params[0]*sampleRate) : 1;
+            if (frames < 1) frames = 1;
+            else if (frames > maxFrames) frames = maxFrames;
+
+            float feedback = (params[1] < 0.0f)? 0.0f : ((params[1] > 0.98f)? 0.98f : params[1]);
+            float mix = (params[2] < 0.0f)? 0.0f : ((params[2] > 1.0f)? 1.0f : params[2]);
+
+            // Delay line length follows delay time, cursor is kept when possible
+            effect->lines[0].length = frames*effect->channels;
+            if (effect->lines[0].cursor >= effect->lines[0].length) effect->lines[0].cursor = 0;
+
+            effect->coeffs[0] = feedback;
+            effect->coeffs[1] = 1.0f - mix;
+            effect->coeffs[2] = mix;
+
+            // Echoes repeat every delay time, until they fade out
+            unsigned int repeats = (feedback > 0.0f)? (unsigned int)(logf(silence)/logf(feedback)) + 1 : 1;
+            effect->tailFrames = frames*repeats;
+        } break;
+        case AUDIO_EFFECT_REVERB:
+        {
+            float roomSize = (params[0] < 0.0f)? 0.0f : ((params[0] > 1.0f)? 1.0f : params[0]);
+            float damping = (params[1] < 0.0f)? 0.0f : ((params[1] > 1.0f)? 1.0f : params[1]);
+            float mix = (params[2] < 0.0f)? 0.0f : ((params[2] > 1.0f)? 1.0f : params[2]);
+
+            // Freeverb scaling: room size sets comb filters feedback
+            effect->coeffs[0] = 0.7f + roomSize*0.28f;
+            effect->coeffs[1] = damping*0.4f;
+            effect->coeffs[2] = 1.0f - mix;
+            effect->coeffs[3] = mix*3.0f;
+
+            // Longest comb filter sets the reverb decay time
+            unsigned int combFrames = 0;
+            for (unsigned int i = 0; i < effect->lineCount; i++)
+            {
+                if (effect->lines[i].length > combFrames) combFrames = effect->lines[i].length;
+            }
+
+            effect->tailFrames = combFrames*((unsigned int)(logf(silence)/logf(effect->coeffs[0])) + 1);
+        } break;
+        case AUDIO_EFFECT_LIMITER:
+        {
+            float release = (params[1] > 0.0f)? params[1] : 0.1f;
+
+            effect->coeffs[0] = (params[0] > 0.0f)? params[0] : 1.0f;
+            effect->coeffs[1] = expf(-1.0f/(release*sampleRate));
+            effect->tailFrames = 0;
+        } break;
+        default: break;
+    }
+}
+
+// Process audio effect in place on a block of frames, called by the audio thread
+static void ProcessAudioEffect(rAudioEffect *effect, float *frames, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = effect->channels;
+    const float *coeffs = effect->coeffs;
+
+    switch (effect->type)
+    {
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
+        case AUDIO_EFFECT_BANDPASS:
+        case AUDIO_EFFECT_PEAKING:
+        {
+            // Biquad filter, transposed direct form II
+            for (ma_uint32 channel = 0; channel < channels; channel++)
+            {
+                float z1 = effect->state[channel*2];
+                float z2 = effect->state[channel*2 + 1];
+
+                for (ma_uint32 frame = 0; frame < frameCount; frame++)
+                {
+                    float x = frames[frame*channels + channel];
+                    float y = coeffs[0]*x + z1;
+
+                    z1 = coeffs[1]*x - coeffs[3]*y + z2;
+                    z2 = coeffs[2]*x - coeffs[4]*y;
+                    frames[frame*channels + channel] = y;
+                }
+
+                // Filter state decays into denormals on silence, slowing down processing
+                effect->state[channel*2] = (fabsf(z1) < 1e-15f)? 0.0f : z1;
+                effect->state[channel*2 + 1] = (fabsf(z2) < 1e-15f)? 0.0f : z2;
+            }
+        } break;
+        case AUDIO_EFFECT_DELAY:
+        {
+            rAudioDelayLine *line = &effect->lines[0];
+            ma_uint32 sampleCount = frameCount*channels;
+
+            // Line is processed in spans up to its end, every line sample is read before being written
+            for (ma_uint32 sample = 0; sample < sampleCount; )
+            {
+                ma_uint32 span = line->length - line->cursor;
+                if (span > (sampleCount - sample)) span = sampleCount - sample;
+
+                ProcessDelayLineSamples(frames + sample, line->samples + line->cursor, span, coeffs[0], coeffs[1], coeffs[2]);
+
+                sample += span;
+                line->cursor += span;
+                if (line->cursor >= line->length) line->cursor = 0;
+            }
+        } break;
+        case AUDIO_EFFECT_REVERB:
+        {
+            // Freeverb: all channels feed parallel comb filters followed by serial all-pass filters, per channel
+            const float feedback = coeffs[0];
+            const float damping = coeffs[1];
+
+            for (ma_uint32 frame = 0; frame < frameCount; frame++)
+            {
+                float *samples = frames + frame*channels;
+                float input = 0.0f;
+
+                for (ma_uint32 channel = 0; channel < channels; channel++) input += samples[channel];
+                input *= 0.015f;
+
+                for (ma_uint32 channel = 0; channel < channels; channel++)
+                {
+                    rAudioDelayLine *comb = effect->lines + channel*(AUDIO_REVERB_COMB_FILTERS + AUDIO_REVERB_ALLPASS_FILTERS);
+                    rAudioDelayLine *allpass = comb + AUDIO_REVERB_COMB_FILTERS;
+                    float output = 0.0f;
+
+                    for (int i = 0; i < AUDIO_REVERB_COMB_FILTERS; i++)
+                    {
+                        float delayed = comb[i].samples[comb[i].cursor];
+
+                        comb[i].store = delayed*(1.0f - damping) + comb[i].store*damping;
+                        comb[i].samples[comb[i].cursor] = input + comb[i].store*feedback;
+                        if (++comb[i].cursor >= comb[i].length) comb[i].cursor = 0;
+
+                        output += delayed;
+                    }
+
+                    for (int i = 0; i < AUDIO_REVERB_ALLPASS_FILTERS; i++)
+                    {
+                        float delayed = allpass[i].samples[allpass[i].cursor];
+
+                        allpass[i].samples[allpass[i].cursor] = output + delayed*0.5f;
+                        if (++allpass[i].cursor >= allpass[i].length) allpass[i].cursor = 0;
+
+                        output = delayed - output;
+                    }
+
+                    samples[channel] = samples[channel]*coeffs[2] + output*coeffs[3];
+                }
+            }
+
+            for (unsigned int i = 0; i < effect->lineCount; i++)
+            {
+                if (fabsf(effect->lines[i].store) < 1e-15f) effect->lines[i].store = 0.0f;
+            }
+        } break;
+        case AUDIO_EFFECT_LIMITER:
+        {
+            // Gain drops instantly to keep peaks under threshold, then recovers smoothly
+            const float threshold = coeffs[0];
+            const float release = coeffs[1];
+            float gain = effect->state[0];
+
+            for (ma_uint32 frame = 0; frame < frameCount; frame++)
+            {
+                float *samples = frames + frame*channels;
+                float peak = 0.0f;
+
+                for (ma_uint32 channel = 0; channel < channels; channel++)
+                {
+                    if (fabsf(samples[channel]) > peak) peak = fabsf(samples[channel]);
+                }
+
+                float target = (peak > threshold)? threshold/peak : 1.0f;
+                gain = (target < gain)? target : target + (gain - target)*release;
+
+                for (ma_uint32 channel = 0; channel < channels; channel++) samples[channel] *= gain;
+            }
+
+            effect->state[0] = gain;
+        } break;
+        default: break;
+    }
+}
+
+// Process delay line samples: delayed samples are mixed with input, line keeps input plus delayed feedback
+// NOTE: Every line sample is read before being written, so samples are independent and vectorized
+static void ProcessDelayLineSamples(float *samples, float *line, ma_uint32 sampleCount, float feedback, float dry, float wet)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SSE2_ENABLED)
+    const __m128 feedbacks = _mm_set1_ps(feedback);
+    const __m128 dryGains = _mm_set1_ps(dry);
+    const __m128 wetGains = _mm_set1_ps(wet);
+
+    for (; i + 4 <= sampleCount; i += 4)
+    {
+        __m128 input = _mm_loadu_ps(samples + i);
+        __m128 delayed = _mm_loadu_ps(line + i);
+
+        _mm_storeu_ps(line + i, _mm_add_ps(input, _mm_mul_ps(delayed, feedbacks)));
+        _mm_storeu_ps(samples + i, _mm_add_ps(_mm_mul_ps(input, dryGains), _mm_mul_ps(delayed, wetGains)));
+    }
+#elif defined(RAUDIO_NEON_ENABLED)
+    const float32x4_t feedbacks = vdupq_n_f32(feedback);
+    const float32x4_t dryGains = vdupq_n_f32(dry);
+    const float32x4_t wetGains = vdupq_n_f32(wet);
+
+    for (; i + 4 <= sampleCount; i += 4)
+    {
+        float32x4_t input = vld1q_f32(samples + i);
+        float32x4_t delayed = vld1q_f32(line + i);
+
+        vst1q_f32(line + i, vmlaq_f32(input, delayed, feedbacks));
+        vst1q_f32(samples + i, vmlaq_f32(vmulq_f32(input, dryGains), delayed, wetGains));
+    }
+#endif
+
+    for (; i < sampleCount; i++)
+    {
+        float input = samples[i];
+        float delayed = line[i];
+
+        line[i] = input + delayed*feedback;
+        samples[i] = input*dry + delayed*wet;
+    }
+}
+
+#if SUPPORT_FILEFORMAT_QOA
+// Load QOA sound decoder, frame samples are allocated with it
+static rQoaSoundDecoder *LoadQoaSoundDecoder(qoa_desc desc, unsigned int dataSize)
+{
+    rQoaSoundDecoder *decoder = (rQoaSoundDecoder *)RL_MALLOC(sizeof(rQoaSoundDecoder) + QOA_FRAME_LEN*desc.channels*sizeof(short));
+
+    if (decoder != NULL)
+    {
+        decoder->desc = desc;
+        decoder->dataSize = dataSize;
+        decoder->frameIndex = -1;
+        decoder->frameLen = 0;
+        decoder->samples = (short *)(decoder + 1);
+    }
+
+    return decoder;
+}
+
+// Decode QOA sound frames from buffer cursor position, called by the audio thread
+// NOTE: QOA frames are decoded one at a time when reached by the cursor, they all have
+// the same encoded size except the last one, so any frame can be located directly
+static void DecodeQoaSoundFrames(AudioBuffer *buffer, short *framesOut, ma_uint32 frameCount)
+{
+    rQoaSoundDecoder *decoder = buffer->qoa;
+    unsigned int channels = decoder->desc.channels;
+    ma_uint32 frameCursorPos = buffer->frameCursorPos;
+
+    while (frameCount > 0)
+    {
+        int frameIndex = frameCursorPos/QOA_FRAME_LEN;
+
+        if (frameIndex != decoder->frameIndex)
+        {
+            unsigned int offset = 8 + frameIndex*qoa_max_frame_size(&decoder->desc);   // QOA file header is 8 bytes
+
+            decoder->frameIndex = frameIndex;
+            decoder->frameLen = 0;
+            if (offset < decoder->dataSize) qoa_decode_frame(buffer->data + offset, decoder->dataSize - offset, &decoder->desc, decoder->samples, &decoder->frameLen);
+        }
+
+        ma_uint32 frameOffset = frameCursorPos%QOA_FRAME_LEN;
+
+        if (frameOffset >= decoder->frameLen)
+        {
+            // Corrupted or missing frame, silence the rest
+            memset(framesOut, 0, frameCount*channels*sizeof(short));
+            break;
+        }
+
+        ma_uint32 framesToCopy = decoder->frameLen - frameOffset;
+        if (framesToCopy > frameCount) framesToCopy = frameCount;
+
+        memcpy(framesOut, decoder->samples + frameOffset*channels, framesToCopy*channels*sizeof(short));
+
+        framesOut += framesToCopy*channels;
+        frameCursorPos += framesToCopy;
+        frameCount -= framesToCopy;
+    }
+}
+#endif
+
+// Get audio buffer data converter config, from buffer data format to mixing format
+// NOTE: Sample rate can always be changed later for pitch shifting
+static ma_data_converter_config GetAudioConverterConfig(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, int resampler)
+{
+    static ma_resampling_backend_vtable sincResamplerVTable = {
+        GetSincResamplerHeapSize,
+        InitSincResampler,
+        UninitSincResampler,
+        ProcessSincResampler,
+        SetSincResamplerRate,
+        NULL,                       // Input latency not reported
+        NULL,                       // Output latency not reported
+        GetSincResamplerRequiredInput,
+        GetSincResamplerExpectedOutput,
+        ResetSincResampler
+    };
+
+    ma_data_converter_config config = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
+    config.allowDynamicSampleRate = true;
+
+    switch (resampler)
+    {
+        case AUDIO_RESAMPLER_FAST: config.resampling.linear.lpfOrder = 0; break;
+        case AUDIO_RESAMPLER_SINC:
+        {
+            config.resampling.algorithm = ma_resample_algorithm_custom;
+            config.resampling.pBackendVTable = &sincResamplerVTable;
+        } break;
+        default: break;     // Linear resampler, with miniaudio default low-pass filter
+    }
+
+    return config;
+}
+
+// Get windowed-sinc resampler memory requirements, state and history are allocated by miniaudio
+static ma_result GetSincResamplerHeapSize(void *userData, const ma_resampler_config *config, size_t *heapSize)
+{
+    if (config->format != ma_format_f32) return MA_INVALID_ARGS;
+
+    *heapSize = sizeof(rSincResampler) + 2*AUDIO_SINC_RESAMPLER_TAPS*config->channels*sizeof(float);
+
+    return MA_SUCCESS;
+}
+
+// Init windowed-sinc resampler on provided memory
+static ma_result InitSincResampler(void *userData, const ma_resampler_config *config, void *heap, ma_resampling_backend **backend)
+{
+    if (config->format != ma_format_f32) return MA_INVALID_ARGS;
+
+    rSincResampler *resampler = (rSincResampler *)heap;
+    memset(resampler, 0, sizeof(rSincResampler));
+
+    resampler->channels = config->channels;
+    resampler->history = (float *)(resampler + 1);
+    resampler->cutoff = -1.0f;      // Filter coefficients not computed yet
+
+    ResetSincResampler(userData, resampler);
+    SetSincResamplerRate(userData, resampler, config->sampleRateIn, config->sampleRateOut);
+
+    *backend = resampler;
+
+    return MA_SUCCESS;
+}
+
+// Uninit windowed-sinc resampler, memory is freed by miniaudio
+static void UninitSincResampler(void *userData, ma_resampling_backend *backend, const ma_allocation_callbacks *allocationCallbacks)
+{
+    (void)backend;
+}
+
+// Resample frames with windowed-sinc resampler
+// NOTE: Output frame position lies between the two central frames of history window,
+// coefficients are interpolated between the two closest filter phases
+static ma_result ProcessSincResampler(void *userData, ma_resampling_backend *backend, const void *framesIn, ma_uint64 *frameCountIn, void *framesOut, ma_uint64 *frameCountOut)
+{
+    rSincResampler *resampler = (rSincResampler *)backend;
+    const ma_uint32 channels = resampler->channels;
+    const float *input = (const float *)framesIn;
+    float *output = (float *)framesOut;
+
+    ma_uint64 inputCount = (frameCountIn != NULL)? *frameCountIn : 0;
+    ma_uint64 outputCount = (frameCountOut != NULL)? *frameCountOut : 0;
+    ma_uint64 inputUsed = 0;
+    ma_uint64 outputUsed = 0;
+
+    float coefs[AUDIO_SINC_RESAMPLER_TAPS];
+
+    while (outputUsed < outputCount)
+    {
+        // Consume input frames until output frame position is inside history window
+        while ((resampler->time >= ((ma_uint64)1 << 32)) && (inputUsed < inputCount))
+        {
+            for (ma_uint32 c = 0; c < channels; c++)
+            {
+                float sample = (input != NULL)? input[inputUsed*channels + c] : 0.0f;
+                float *history = resampler->history + c*2*AUDIO_SINC_RESAMPLER_TAPS;
+
+                history[resampler->historyPos] = sample;
+                history[resampler->historyPos + AUDIO_SINC_RESAMPLER_TAPS] = sample;
+            }
+
+            resampler->historyPos = (resampler->historyPos + 1)%AUDIO_SINC_RESAMPLER_TAPS;
+            resampler->time -= ((ma_uint64)1 << 32);
+            inputUsed++;
+        }
+
+        if (resampler->time >= ((ma_uint64)1 << 32)) break;   // More input frames required
+
+        // Interpolate filter coefficients for output frame position
+        ma_uint32 position = (ma_uint32)resampler->time;
+        ma_uint32 phase = position/(0xffffffffu/AUDIO_SINC_RESAMPLER_PHASES + 1);
+        float amount = (float)(position%(0xffffffffu/AUDIO_SINC_RESAMPLER_PHASES + 1))/(float)(0xffffffffu/AUDIO_SINC_RESAMPLER_PHASES + 1);
+        const float *coefs0 = resampler->table + phase*AUDIO_SINC_RESAMPLER_TAPS;
+        const float *coefs1 = coefs0 + AUDIO_SINC_RESAMPLER_TAPS;
+
+        for (int i = 0; i < AUDIO_SINC_RESAMPLER_TAPS; i++) coefs[i] = coefs0[i] + amount*(coefs1[i] - coefs0[i]);
+
+        for (ma_uint32 c = 0; c < channels; c++)
+        {
+            const float *history = resampler->history + c*2*AUDIO_SINC_RESAMPLER_TAPS + resampler->historyPos;
+            float sample = 0.0f;
+
+            for (int i = 0; i < AUDIO_SINC_RESAMPLER_TAPS; i++) sample += history[i]*coefs[i];
+
+            output[outputUsed*channels + c] = sample;
+        }
+
+        resampler->time += resampler->step;
+        outputUsed++;
+    }
+
+    if (frameCountIn != NULL) *frameCountIn = inputUsed;
+    if (frameCountOut != NULL) *frameCountOut = outputUsed;
+
+    return MA_SUCCESS;
+}
+
+// Set windowed-sinc resampler rates, filter cutoff is lowered when downsampling to avoid aliasing
+static ma_result SetSincResamplerRate(void *userData, ma_resampling_backend *backend, ma_uint32 sampleRateIn, ma_uint32 sampleRateOut)
+{
+    rSincResampler *resampler = (rSincResampler *)backend;
+
+    if ((sampleRateIn == 0) || (sampleRateOut == 0)) return MA_INVALID_ARGS;
+
+    resampler->sampleRateIn = sampleRateIn;
+    resampler->sampleRateOut = sampleRateOut;
+    resampler->step = ((ma_uint64)sampleRateIn << 32)/sampleRateOut;
+
+    float cutoff = (sampleRateOut < sampleRateIn)? (float)sampleRateOut/sampleRateIn : 1.0f;
+
+    if (cutoff != resampler->cutoff)
+    {
+        resampler->cutoff = cutoff;
+        UpdateSincResamplerTable(resampler);
+    }
+
+    return MA_SUCCESS;
+}
+
+// Get input frames required by windowed-sinc resampler to output the provided frames
+// NOTE: Input is consumed until every output frame position lies inside the history window,
+// miniaudio guess from sample rates can be 0 frames when upsampling, stalling the converter
+static ma_result GetSincResamplerRequiredInput(void *userData, const ma_resampling_backend *backend, ma_uint64 outputFrameCount, ma_uint64 *inputFrameCount)
+{
+    const rSincResampler *resampler = (const rSincResampler *)backend;
+
+    *inputFrameCount = 0;
+    if (outputFrameCount > 0) *inputFrameCount = (resampler->time + (outputFrameCount - 1)*resampler->step) >> 32;
+
+    return MA_SUCCESS;
+}
+
+// Get output frames produced by windowed-sinc resampler from the provided input frames
+static ma_result GetSincResamplerExpectedOutput(void *userData, const ma_resampling_backend *backend, ma_uint64 inputFrameCount, ma_uint64 *outputFrameCount)
+{
+    const rSincResampler *resampler = (const rSincResampler *)backend;
+
+    // Output frame k is produced once (time + k*step) is below the end of the input provided
+    if (inputFrameCount > 0xffffffff) inputFrameCount = 0xffffffff;
+    ma_uint64 inputEnd = (inputFrameCount + 1) << 32;
+
+    *outputFrameCount = 0;
+    if (inputEnd > resampler->time) *outputFrameCount = (inputEnd - resampler->time + resampler->step - 1)/resampler->step;
+
+    return MA_SUCCESS;
+}
+
+// Reset windowed-sinc resampler history
+static ma_result ResetSincResampler(void *userData, ma_resampling_backend *backend)
+{
+    rSincResampler *resampler = (rSincResampler *)backend;
+
+    memset(resampler->history, 0, 2*AUDIO_SINC_RESAMPLER_TAPS*resampler->channels*sizeof(float));
+    resampler->historyPos = 0;
+    resampler->time = (ma_uint64)1 << 32;
+
+    return MA_SUCCESS;
+}
+
+// Compute windowed-sinc resampler filter coefficients for current cutoff, Blackman window is used
+// NOTE: Coefficients of every phase are normalized to keep a unity gain
+static void UpdateSincResamplerTable(rSincResampler *resampler)
+{
+    const float pi = 3.14159265358979323846f;
+    const float halfTaps = AUDIO_SINC_RESAMPLER_TAPS/2;
+    const float cutoff = resampler->cutoff*0.95f;   // Keep some room for the filter transition band
+
+    for (int phase = 0; phase <= AUDIO_SINC_RESAMPLER_PHASES; phase++)
+    {
+        float *coefs = resampler->table + phase*AUDIO_SINC_RESAMPLER_TAPS;
+        float sum = 0.0f;
+
+        for (int i = 0; i < AUDIO_SINC_RESAMPLER_TAPS; i++)
+        {
+            // Distance from output frame position, in input frames
+            float x = (float)i - (halfTaps - 1.0f) - (float)phase/AUDIO_SINC_RESAMPLER_PHASES;
+            float sinc = (x == 0.0f)? 1.0f : sinf(pi*cutoff*x)/(pi*cutoff*x);
+            float window = 0.42f + 0.5f*cosf(pi*x/halfTaps) + 0.08f*cosf(2.0f*pi*x/halfTaps);
+
+            coefs[i] = sinc*window;
+            sum += coefs[i];
+        }
+
+        for (int i = 0; i < AUDIO_SINC_RESAMPLER_TAPS; i++) coefs[i] /= sum;
+    }
+}
+
+// Claim and load waves from batch until no one is left, returns waves loaded after the last one claimed
+// NOTE: Progress callback is only provided on the calling thread
+static ma_uint32 LoadWaveBatchItems(rWaveBatch *batch, LoadWavesCallback callback)
+{
+    ma_uint32 loaded = 0;
+    ma_uint32 index = ma_atomic_fetch_add_32(&batch->next, 1);
+
+    while (index < batch->count)
+    {
+        Wave wave = LoadWave(batch->fileNames[index]);
+
+        if (batch->deviceFormat && (wave.data != NULL)) WaveFormat(&wave, AUDIO.System.device.sampleRate, 32, AUDIO_DEVICE_CHANNELS);
+
+        batch->waves[index] = wave;
+
+        loaded = ma_atomic_fetch_add_32(&batch->loaded, 1) + 1;
+        if (callback != NULL) callback((int)loaded, (int)batch->count);
+
+        index = ma_atomic_fetch_add_32(&batch->next, 1);
+    }
+
+    return loaded;
+}
+
+// Waves batch worker thread
+static ma_thread_result MA_THREADCALL WaveBatchWorker(void *data)
+{
+    LoadWaveBatchItems((rWaveBatch *)data, NULL);
+
+    return (ma_thread_result)0;
+}
+
+// Rewind music stream decoding to the start
+static void RewindMusicStream(Music music)
+{
+    // Indexed music restarts from the decoder starting state, recorded as first seek point
+    rMusicSeekIndex *index = (music.stream.buffer != NULL)? music.stream.buffer->seekIndex : NULL;
+
+    if (index != NULL)
+    {
+        LoadMusicSeekPoint(music, index->points);
+        index->position = 0;
+        return;
+    }
+
+    switch (music.ctxType)
+    {
+#if SUPPORT_FILEFORMAT_WAV
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if SUPPORT_FILEFORMAT_OGG
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if SUPPORT_FILEFORMAT_MP3
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if SUPPORT_FILEFORMAT_QOA
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if SUPPORT_FILEFORMAT_FLAC
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if SUPPORT_FILEFORMAT_XM
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if SUPPORT_FILEFORMAT_MOD
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+// Decode music stream frames into a PCM buffer, in the music stream format
+// NOTE: Decoding stops on every seek point not recorded yet, to save decoder state into seek index
+static void DecodeMusicStreamFrames(Music music, void *pcmBuffer, unsigned int frameCount)
+{
+    rMusicSeekIndex *index = (music.stream.buffer != NULL)? music.stream.buffer->seekIndex : NULL;
+
+    if (index == NULL)
+    {
+        ReadMusicStreamFrames(music, pcmBuffer, frameCount);
+        return;
+    }
+
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+
+    while (frameCount > 0)
+    {
+        unsigned int framesToDecode = frameCount;
+        bool recordPoint = false;
+
+        if (index->pointCount < MUSIC_STREAM_SEEK_POINTS)
+        {
+            unsigned int pointPosition = index->pointCount*index->interval;
+
+            if ((index->position < pointPosition) && (pointPosition < music.frameCount) && (pointPosition - index->position <= framesToDecode))
+            {
+                framesToDecode = pointPosition - index->position;
+                recordPoint = true;
+            }
+        }
+
+        ReadMusicStreamFrames(music, pcmBuffer, framesToDecode);
+
+        pcmBuffer = (unsigned char *)pcmBuffer + framesToDecode*frameSize;
+        frameCount -= framesToDecode;
+
+        // NOTE: Position stops at the end, decoding after looping is not indexed
+        index->position = (framesToDecode < music.frameCount - index->position)? index->position + framesToDecode : music.frameCount;
+
+        if (recordPoint)
+        {
+            SaveMusicSeekPoint(music, index->points + index->pointCount*index->pointSize);
+            index->pointCount++;
+        }
+    }
+}
+
+// Read music stream frames from decoder into a PCM buffer, in the music stream format
+// NOTE: Looping music restarts decoding from the start when the end is reached
+static void ReadMusicStreamFrames(Music music, void *pcmBuffer, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if SUPPORT_FILEFORMAT_WAV
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcmBuffer + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcmBuffer + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_OGG
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_MP3
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcmBuffer + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_QOA
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)pcmBuffer, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_FLAC
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcmBuffer + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_XM
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally considering 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)pcmBuffer, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcmBuffer, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)pcmBuffer, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_MOD
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples desired, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcmBuffer, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+// Load music stream seek index (MP3 and modules)
+// NOTE: Other formats already seek without decoding from the start (WAV, FLAC, QOA, OGG pages bisection)
+static void LoadMusicSeekIndex(Music music)
+{
+    unsigned int pointSize = 0;
+
+    switch (music.ctxType)
+    {
+    #if SUPPORT_FILEFORMAT_MP3
+        case MUSIC_AUDIO_MP3: pointSize = sizeof(drmp3); break;
+    #endif
+    #if SUPPORT_FILEFORMAT_XM
+        case MUSIC_MODULE_XM: pointSize = sizeof(jar_xm_context_t) + jar_xm_get_number_of_channels((jar_xm_context_t *)music.ctxData)*sizeof(jar_xm_channel_context_t); break;
+    #endif
+    #if SUPPORT_FILEFORMAT_MOD
+        case MUSIC_MODULE_MOD: pointSize = sizeof(jar_mod_context_t); break;
+    #endif
+        default: break;
+    }
+
+    if ((pointSize == 0) || (music.stream.buffer == NULL)) return;
+
+    // NOTE: Seek points data is allocated along with the index
+    rMusicSeekIndex *index = (rMusicSeekIndex *)RL_CALLOC(1, sizeof(rMusicSeekIndex) + MUSIC_STREAM_SEEK_POINTS*pointSize);
+    index->interval = music.frameCount/MUSIC_STREAM_SEEK_POINTS + 1;
+    index->pointSize = pointSize;
+    index->points = (unsigned char *)(index + 1);
+
+    // Decoder starting state is the first seek point, the others are recorded while decoding
+    SaveMusicSeekPoint(music, index->points);
+    index->pointCount = 1;
+
+    music.stream.buffer->seekIndex = index;
+}
+
+// Seek indexed music stream to frame position, starting from the nearest seek point
+// NOTE: Frames from seek point to position are decoded and discarded, at most one seek interval
+// unless position has not been indexed yet, seek points are recorded on the way
+static void SeekMusicStreamIndexed(Music music, unsigned int position)
+{
+    rMusicSeekIndex *index = music.stream.buffer->seekIndex;
+
+    unsigned int point = position/index->interval;
+    if (point >= index->pointCount) point = index->pointCount - 1;
+
+    // Decoding continues from current position if it is already closer
+    unsigned int pointPosition = point*index->interval;
+    if ((index->position > position) || (index->position < pointPosition))
+    {
+        LoadMusicSeekPoint(music, index->points + point*index->pointSize);
+        index->position = pointPosition;
+    }
+
+    float frames[1024];
+    unsigned int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    unsigned int framesCapacity = sizeof(frames)/frameSize;
+
+    while (index->position < position)
+    {
+        unsigned int framesToDecode = ((position - index->position) < framesCapacity)? (position - index->position) : framesCapacity;
+        DecodeMusicStreamFrames(music, frames, framesToDecode);
+    }
+}
+
+// Save music decoder state as seek point
+// NOTE: Only the decoding state is saved, module data and decoder buffers are not modified by decoding
+static void SaveMusicSeekPoint(Music music, unsigned char *state)
+{
+    switch (music.ctxType)
+    {
+    #if SUPPORT_FILEFORMAT_MP3
+        case MUSIC_AUDIO_MP3:
+        {
+            drmp3 *mp3 = (drmp3 *)music.ctxData;
+
+            memcpy(state, mp3, sizeof(drmp3));
+
+            // File data buffered by decoder is not saved, only the file position of data not consumed yet
+            // NOTE: Music file is opened with drmp3_init_file(), streamCursor is not reliable after init
+            if (mp3->memory.pData == NULL) ((drmp3 *)state)->streamCursor = (drmp3_uint64)ftell((FILE *)mp3->pUserData) - mp3->dataSize;
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_XM
+        case MUSIC_MODULE_XM:
+        {
+            jar_xm_context_t *ctx = (jar_xm_context_t *)music.ctxData;
+
+            memcpy(state, ctx, sizeof(jar_xm_context_t));
+            memcpy(state + sizeof(jar_xm_context_t), ctx->channels, ctx->module.num_channels*sizeof(jar_xm_channel_context_t));
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_MOD
+        case MUSIC_MODULE_MOD: memcpy(state, music.ctxData, sizeof(jar_mod_context_t)); break;
+    #endif
+        default: break;
+    }
+}
+
+// Restore music decoder state from seek point
+static void LoadMusicSeekPoint(Music music, const unsigned char *state)
+{
+    switch (music.ctxType)
+    {
+    #if SUPPORT_FILEFORMAT_MP3
+        case MUSIC_AUDIO_MP3:
+        {
+            drmp3 *mp3 = (drmp3 *)music.ctxData;
+            drmp3_uint8 *data = mp3->pData;
+            size_t dataCapacity = mp3->dataCapacity;
+
+            memcpy(mp3, state, sizeof(drmp3));
+
+            // File data buffered on seek point is read again from the file, decoder keeps its current buffer
+            if (mp3->memory.pData == NULL)
+            {
+                mp3->pData = data;
+                mp3->dataCapacity = dataCapacity;
+                mp3->dataSize = 0;
+                mp3->dataConsumed = 0;
+                drmp3__on_seek_64(mp3, mp3->streamCursor, DRMP3_SEEK_SET);
+            }
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_XM
+        case MUSIC_MODULE_XM:
+        {
+            jar_xm_context_t *ctx = (jar_xm_context_t *)music.ctxData;
+
+            memcpy(ctx, state, sizeof(jar_xm_context_t));
+            memcpy(ctx->channels, state + sizeof(jar_xm_context_t), ctx->module.num_channels*sizeof(jar_xm_channel_context_t));
+        } break;
+    #endif
+    #if SUPPORT_FILEFORMAT_MOD
+        case MUSIC_MODULE_MOD: memcpy(music.ctxData, state, sizeof(jar_mod_context_t)); break;
+    #endif
+        default: break;
+    }
+}
+
+#if SUPPORT_MUSIC_STREAM_THREADS
+// Load music stream decoder and add it to the worker thread with less decoders
+// NOTE: Worker threads are started on first music stream loaded
+static void LoadMusicDecoder(Music music)
+{
+    if (!AUDIO.System.isReady || AUDIO.System.isOffline || (music.stream.buffer == NULL)) return;
+
+    if (!AUDIO.MusicThreads.running)
+    {
+        ma_atomic_store_32(&AUDIO.MusicThreads.running, MA_TRUE);
+
+        for (int i = 0; i < MUSIC_STREAM_THREAD_COUNT; i++)
+        {
+            ma_mutex_init(&AUDIO.MusicThreads.lock[i]);
+            AUDIO.MusicThreads.first[i] = NULL;
+            AUDIO.MusicThreads.decoderCount[i] = 0;
+
+            if (ma_thread_create(&AUDIO.MusicThreads.thread[i], ma_thread_priority_default, 0, MusicThreadWorker, (void *)(size_t)i, NULL) != MA_SUCCESS)
+            {
+                TRACELOG(LOG_WARNING, "STREAM: Failed to create music stream worker thread");
+                ma_mutex_uninit(&AUDIO.MusicThreads.lock[i]);
+
+                // Stop the threads already created, music streams are decoded on UpdateMusicStream()
+                ma_atomic_store_32(&AUDIO.MusicThreads.running, MA_FALSE);
+                for (int j = 0; j < i; j++)
+                {
+                    ma_thread_wait(&AUDIO.MusicThreads.thread[j]);
+                    ma_mutex_uninit(&AUDIO.MusicThreads.lock[j]);
+                }
+
+                return;
+            }
+        }
+
+        TRACELOG(LOG_INFO, "STREAM: Music stream worker threads started (%i)", MUSIC_STREAM_THREAD_COUNT);
+    }
+
+    unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
+    unsigned int frameSize = music.stream.channels*music.stream.sampleSize/8;
+
+    rMusicDecoder *decoder = (rMusicDecoder *)RL_CALLOC(1, sizeof(rMusicDecoder));
+    decoder->music = music;
+    decoder->looping = music.looping;
+    decoder->queue = (unsigned char *)RL_MALLOC(MUSIC_STREAM_DECODE_AHEAD*subBufferSizeInFrames*frameSize);
+    ma_mutex_init(&decoder->lock);
+
+    for (int i = 1; i < MUSIC_STREAM_THREAD_COUNT; i++)
+    {
+        if (AUDIO.MusicThreads.decoderCount[i] < AUDIO.MusicThreads.decoderCount[decoder->worker]) decoder->worker = i;
+    }
+
+    ma_mutex_lock(&AUDIO.MusicThreads.lock[decoder->worker]);
+    decoder->next = AUDIO.MusicThreads.first[decoder->worker];
+    AUDIO.MusicThreads.first[decoder->worker] = decoder;
+    AUDIO.MusicThreads.decoderCount[decoder->worker]++;
+    ma_mutex_unlock(&AUDIO.MusicThreads.lock[decoder->worker]);
+
+    music.stream.buffer->decoder = decoder;
+}
+
+// Remove music stream decoder from its worker thread and unload it
+static void UnloadMusicDecoder(Music music)
+{
+    if ((music.stream.buffer == NULL) || (music.stream.buffer->decoder == NULL)) return;
+
+    rMusicDecoder *decoder = music.stream.buffer->decoder;
+
+    // NOTE: Worker keeps the list locked while decoding, decoder is not in use once removed
+    ma_mutex_lock(&AUDIO.MusicThreads.lock[decoder->worker]);
+    rMusicDecoder **link = &AUDIO.MusicThreads.first[decoder->worker];
+    while (*link != decoder) link = &(*link)->next;
+    *link = decoder->next;
+    AUDIO.MusicThreads.decoderCount[decoder->worker]--;
+    ma_mutex_unlock(&AUDIO.MusicThreads.lock[decoder->worker]);
+
+    ma_mutex_uninit(&decoder->lock);
+    RL_FREE(decoder->queue);
+    RL_FREE(decoder);
+
+    music.stream.buffer->decoder = NULL;
+}
+
+// Stop worker threads and unload remaining decoders
+// NOTE: Music streams still loaded are decoded on UpdateMusicStream() from now on
+static void StopMusicThreads(void)
+{
+    if (!AUDIO.MusicThreads.running) return;
+
+    ma_atomic_store_32(&AUDIO.MusicThreads.running, MA_FALSE);
+
+    for (int i = 0; i < MUSIC_STREAM_THREAD_COUNT; i++)
+    {
+        ma_thread_wait(&AUDIO.MusicThreads.thread[i]);
+
+        while (AUDIO.MusicThreads.first[i] != NULL) UnloadMusicDecoder(AUDIO.MusicThreads.first[i]->music);
+
+        ma_mutex_uninit(&AUDIO.MusicThreads.lock[i]);
+    }
+}
+
+// Decode ahead and refill music stream, called by worker threads
+// NOTE: Returns true if some work has been done, false if decoder is idle
+static bool UpdateMusicDecoder(rMusicDecoder *decoder)
+{
+    bool updated = false;
+
+    ma_mutex_lock(&decoder->lock);
+
+    if (decoder->playing)
+    {
+        Music music = decoder->music;
+        music.looping = ma_atomic_load_32(&decoder->looping);
+
+        unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
+        unsigned int frameSize = music.stream.channels*music.stream.sampleSize/8;
+
+        unsigned int framesLeft = music.frameCount - decoder->framesDecoded;  // Frames left to be decoded
+        unsigned int framesToStream = 0;
+
+        if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
+        else framesToStream = framesLeft;
+
+        // Submit decoded sub-buffers as soon as the mixer releases them
+        if ((decoder->queueCount > 0) && (IsSubBufferAvailable(music.stream.buffer, 0) || IsSubBufferAvailable(music.stream.buffer, 1)))
+        {
+            UpdateAudioStream(music.stream, decoder->queue + decoder->queueHead*subBufferSizeInFrames*frameSize, decoder->queueFrames[decoder->queueHead]);
+
+            decoder->queueHead = (decoder->queueHead + 1)%MUSIC_STREAM_DECODE_AHEAD;
+            decoder->queueCount--;
+            updated = true;
+        }
+
+        // Keep decoding ahead of playback until the queue is full or music end is reached
+        if ((decoder->queueCount < MUSIC_STREAM_DECODE_AHEAD) && (framesToStream > 0))
+        {
+            unsigned int index = (decoder->queueHead + decoder->queueCount)%MUSIC_STREAM_DECODE_AHEAD;
+
+            DecodeMusicStreamFrames(music, decoder->queue + index*subBufferSizeInFrames*frameSize, framesToStream);
+
+            decoder->queueFrames[index] = framesToStream;
+            decoder->queueCount++;
+            decoder->framesDecoded += framesToStream;
+            updated = true;
+        }
+        else if ((decoder->queueCount == 0) && (framesToStream == 0) &&
+                 IsSubBufferAvailable(music.stream.buffer, 0) && IsSubBufferAvailable(music.stream.buffer, 1))
+        {
+            // Music end reached and all sub-buffers played, stop it
+            decoder->playing = false;
+            decoder->framesDecoded = 0;
+
+            StopAudioStream(music.stream);
+            RewindMusicStream(music);
+        }
+    }
+
+    ma_mutex_unlock(&decoder->lock);
+
+    return updated;
+}
+
+// Music stream worker thread, refills the music streams assigned to it
+static ma_thread_result MA_THREADCALL MusicThreadWorker(void *data)
+{
+    int worker = (int)(size_t)data;
+
+    // Check streams a few times per device period, sub-buffers are at least one period long
+    ma_uint32 interval = AUDIO.System.device.playback.internalPeriodSizeInFrames*1000/AUDIO.System.device.sampleRate/4;
+    if (interval < 1) interval = 1;
+
+    while (ma_atomic_load_32(&AUDIO.MusicThreads.running))
+    {
+        bool updated = false;
+
+        ma_mutex_lock(&AUDIO.MusicThreads.lock[worker]);
+        for (rMusicDecoder *decoder = AUDIO.MusicThreads.first[worker]; decoder != NULL; decoder = decoder->next)
+        {
+            if (UpdateMusicDecoder(decoder)) updated = true;
+        }
+        ma_mutex_unlock(&AUDIO.MusicThreads.lock[worker]);
+
+        if (!updated) ma_sleep(interval);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
@@ -267,6 +267,26 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageStream, image file opened for region-based decoding (bounded memory)
+typedef struct ImageStream {
+    int width;              // Image base width
+    int height;             // Image base height
+    int format;             // Data format (PixelFormat type)
+
+    int ctxType;            // Type of image stream context (image filetype)
+    void *ctxData;          // Image stream context data, depends on type
+} ImageStream;
+
+// ImagePipeline, per-pixel image operations recorded to be applied in a single pass
+typedef struct ImagePipeline {
+    int width;              // Output width, image width kept if 0
+    int height;             // Output height, image height kept if 0
+    int format;             // Output data format (PixelFormat type), image format kept if 0
+
+    int opCount;            // Number of operations recorded
+    void *ops;              // Operations data (internal)
+} ImagePipeline;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -311,16 +331,56 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtext module
+typedef struct rGlyphLookup rGlyphLookup;
+typedef struct rTextFlowData rTextFlowData;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
     int glyphCount;         // Number of glyph characters
     int glyphPadding;       // Padding around the glyph characters
-    Texture2D texture;      // Texture atlas containing the glyphs
+    Texture2D texture;      // Texture atlas containing the glyphs (first page only, use GetFontGlyphTexture())
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphLookup *glyphLookup; // Glyphs lookup table by codepoint (internal, built on font loading)
 } Font;
 
+// TextLayout, precomputed glyphs placement for text drawing
+typedef struct TextLayout {
+    Font font;              // Font used for layout (not owned)
+    float fontSize;         // Font size used for layout
+    float spacing;          // Glyphs spacing used for layout
+    Vector2 size;           // Layout size, same as MeasureTextEx()
+    int lineCount;          // Number of text lines
+    int glyphCount;         // Number of glyphs to draw (spaces and line-breaks not included)
+    int *codepoints;        // Glyphs codepoints
+    int *glyphs;            // Glyphs indices in font
+    Vector2 *positions;     // Glyphs positions, relative to layout position
+} TextLayout;
+
+// TextFlow, word-wrapped text buffer, reflowed incrementally on updates
+typedef struct TextFlow {
+    Font font;              // Font used for layout (not owned)
+    float fontSize;         // Font size used for layout
+    float spacing;          // Glyphs spacing used for layout
+    float width;            // Wrapping width, 0 for no wrapping
+    int alignment;          // Lines alignment (TextAlignment)
+    char *text;             // Text buffer (UTF-8, NULL terminated)
+    int length;             // Text length in bytes
+    int lineCount;          // Number of wrapped lines
+    Vector2 size;           // Flow size (widest line, all lines height)
+    rTextFlowData *data;    // Paragraphs wrapping data (internal)
+} TextFlow;
+
+// TextArena, memory buffer for allocation-free text functions
+typedef struct TextArena {
+    char *data;             // Arena memory buffer (caller-provided or loaded)
+    int capacity;           // Arena capacity in bytes
+    int offset;             // Arena used bytes, strings are allocated sequentially
+} TextArena;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -472,6 +532,7 @@ typedef struct Wave {
 // NOTE: Actual structs are defined internally in raudio module
 typedef struct rAudioBuffer rAudioBuffer;
 typedef struct rAudioProcessor rAudioProcessor;
+typedef struct rAudioBus rAudioBus;
 
 // AudioStream, custom audio stream
 typedef struct AudioStream {
@@ -499,6 +560,11 @@ typedef struct Music {
     void *ctxData;              // Audio context data, depends on type
 } Music;
 
+// AudioBus, sub-mix of sounds, music and streams processed by an effects chain
+typedef struct AudioBus {
+    rAudioBus *mix;             // Pointer to internal sub-mix data used by the audio system
+} AudioBus;
+
 // VrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct VrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -911,6 +977,13 @@ typedef enum {
     FONT_SDF                        // SDF font generation, requires external shader
 } FontType;
 
+// Text alignment, used by wrapped text layouts
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,            // Lines aligned to the left
+    TEXT_ALIGN_CENTER,              // Lines centered
+    TEXT_ALIGN_RIGHT                // Lines aligned to the right
+} TextAlignment;
+
 // Color blending modes (pre-defined)
 typedef enum {
     BLEND_ALPHA = 0,                // Blend textures considering alpha (default)
@@ -961,6 +1034,33 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Sound data storage
+typedef enum {
+    SOUND_STORAGE_DEVICE = 0,       // Sound data converted to device format on loading (32 bit float, device sample rate and channels)
+    SOUND_STORAGE_S16,              // Sound data kept as 16 bit, converted while mixing
+    SOUND_STORAGE_QOA               // Sound data kept QOA compressed, decoded and converted while mixing
+} SoundStorage;
+
+// Audio resampler, used on sample rate conversion and pitch
+// NOTE: Resampling is skipped when sample rate matches device sample rate and pitch is 1.0
+typedef enum {
+    AUDIO_RESAMPLER_LINEAR = 0,     // Linear interpolation with low-pass filter (default)
+    AUDIO_RESAMPLER_FAST,           // Linear interpolation without filter, lower quality and cost
+    AUDIO_RESAMPLER_SINC            // Windowed-sinc interpolation, higher quality and cost
+} AudioResampler;
+
+// Audio bus effect, parameters listed in order
+// NOTE: Biquad filters resonance defaults to 0.707 (Butterworth) if not positive
+typedef enum {
+    AUDIO_EFFECT_LOWPASS = 0,       // Biquad low-pass filter: cutoff (Hz), resonance (Q)
+    AUDIO_EFFECT_HIGHPASS,          // Biquad high-pass filter: cutoff (Hz), resonance (Q)
+    AUDIO_EFFECT_BANDPASS,          // Biquad band-pass filter: center (Hz), resonance (Q)
+    AUDIO_EFFECT_PEAKING,           // Biquad peaking equalizer: center (Hz), resonance (Q), gain (dB)
+    AUDIO_EFFECT_DELAY,             // Feedback delay: time (seconds), feedback (0.0 to 1.0), mix (0.0 to 1.0)
+    AUDIO_EFFECT_REVERB,            // Reverb: room size (0.0 to 1.0), damping (0.0 to 1.0), mix (0.0 to 1.0)
+    AUDIO_EFFECT_LIMITER            // Peak limiter: threshold (linear level), release (seconds)
+} AudioEffect;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -1351,16 +1451,33 @@ RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);
 // NOTE: These functions do not require GPU access
 RLAPI Image LoadImage(const char *fileName);                                                             // Load image from file into CPU memory (RAM)
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
+RLAPI Image LoadImageMapped(const char *fileName);                                                       // Load image from file memory-mapped (zero-copy for .rli image container)
+RLAPI Image LoadImageRawMapped(const char *fileName, int width, int height, int format, int headerSize); // Load image from RAW file data memory-mapped (zero-copy)
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageValid(Image image);                                                                    // Check if an image is valid (data and parameters)
+RLAPI bool IsImageMapped(Image image);                                                                   // Check if image data is memory-mapped from file
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer, memory must be MemFree()
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI bool ExportImageAsync(Image image, const char *fileName);                                          // Export image data to file on a background thread (image data copied), returns true on start
+RLAPI void WaitImageExports(void);                                                                       // Wait for asynchronous image exports to finish
+RLAPI void SetImageCompressionLevel(int level);                                                          // Set image export compression level (PNG: 0 store-only to 9 smallest, 6 by default)
+
+// Image streaming functions
+// NOTE: Rows are decoded on demand, PNG and QOI decoding is sequential, reading rows in order is recommended
+RLAPI ImageStream LoadImageStream(const char *fileName);                                                 // Load image stream from file (PNG, QOI streamed, other formats fully loaded)
+RLAPI ImageStream LoadImageStreamRaw(const char *fileName, int width, int height, int format, int headerSize); // Load image stream from RAW file data
+RLAPI bool IsImageStreamValid(ImageStream stream);                                                       // Check if an image stream is valid (context and parameters)
+RLAPI void UnloadImageStream(ImageStream stream);                                                        // Unload image stream, closing file
+RLAPI Image LoadImageStreamRows(ImageStream stream, int startRow, int rowCount);                         // Load a range of image rows from image stream
+RLAPI Image ImageFromImageStream(ImageStream stream, Rectangle rec);                                     // Create an image from an image stream piece
+RLAPI Image ImageResizeStream(ImageStream stream, int newWidth, int newHeight);                          // Create a resized image from an image stream (Box/Bilinear scaling algorithm)
+RLAPI bool ExportImageStream(ImageStream stream, const char *fileName);                                  // Export image stream data to file row-by-row (.png, .qoi, .raw), returns true on success
 
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
@@ -1390,6 +1507,8 @@ RLAPI void ImageBlurGaussian(Image *image, int blurSize);
 RLAPI void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize);                    // Apply custom square convolution kernel to image
 RLAPI void ImageResize(Image *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
 RLAPI void ImageResizeNN(Image *image, int newWidth, int newHeight);                                     // Resize image (Nearest-Neighbor scaling algorithm)
+RLAPI void ImageResizeBilinear(Image *image, int newWidth, int newHeight);                               // Resize image (Bilinear scaling algorithm, fixed-point)
+RLAPI void ImageResizeBox(Image *image, int newWidth, int newHeight);                                    // Resize image (Box scaling algorithm, area-average, fixed-point)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
@@ -1411,6 +1530,21 @@ RLAPI void UnloadImagePalette(Color *colors);
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
+// Image pipeline functions
+// NOTE: Operations are recorded and applied with ImageApplyPipeline() in a single fused pass, resize is applied first
+RLAPI ImagePipeline LoadImagePipeline(void);                                                             // Load image pipeline (no operations recorded)
+RLAPI void UnloadImagePipeline(ImagePipeline pipeline);                                                  // Unload image pipeline
+RLAPI void ImagePipelineResize(ImagePipeline *pipeline, int newWidth, int newHeight);                    // Set image pipeline output size (area-average/bilinear resampling)
+RLAPI void ImagePipelineFormat(ImagePipeline *pipeline, int newFormat);                                  // Set image pipeline output pixel format
+RLAPI void ImagePipelineColorTint(ImagePipeline *pipeline, Color color);                                 // Record image pipeline operation: tint
+RLAPI void ImagePipelineColorInvert(ImagePipeline *pipeline);                                            // Record image pipeline operation: invert
+RLAPI void ImagePipelineColorGrayscale(ImagePipeline *pipeline);                                         // Record image pipeline operation: grayscale (alpha and format kept)
+RLAPI void ImagePipelineColorContrast(ImagePipeline *pipeline, float contrast);                          // Record image pipeline operation: contrast (-100 to 100)
+RLAPI void ImagePipelineColorBrightness(ImagePipeline *pipeline, int brightness);                        // Record image pipeline operation: brightness (-255 to 255)
+RLAPI void ImagePipelineColorReplace(ImagePipeline *pipeline, Color color, Color replace);               // Record image pipeline operation: replace color
+RLAPI void ImagePipelineAlphaPremultiply(ImagePipeline *pipeline);                                       // Record image pipeline operation: premultiply alpha
+RLAPI void ImageApplyPipeline(Image *image, ImagePipeline pipeline);                                     // Apply image pipeline to image (fused, multi-threaded)
+
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
 RLAPI void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
@@ -1491,7 +1625,10 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, const int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize);                             // Load dynamic font from TTF/OTF file, glyphs rasterized on first use into a bounded atlas
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize); // Load dynamic font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
+RLAPI bool IsFontDynamic(Font font);                                                        // Check if a font is dynamic (glyphs rasterized on first use)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type, int *glyphCount); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
@@ -1506,6 +1643,17 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyphs placement precomputed for repeated drawing
+RLAPI TextLayout LoadTextLayoutEx(Font font, const char *text, float fontSize, float spacing, float maxWidth, int maxLines, int alignment); // Load text layout word-wrapped to width, truncated with ellipsis over maxLines (0 for no limit)
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout (single batch submission)
+RLAPI TextFlow LoadTextFlow(Font font, const char *text, float fontSize, float spacing, float width, int alignment); // Load text flow, word-wrapped text buffer (width 0 for no wrapping)
+RLAPI void UnloadTextFlow(TextFlow flow);                                                   // Unload text flow
+RLAPI void UpdateTextFlow(TextFlow *flow, int position, int removeLength, const char *text); // Update text flow replacing a bytes range with text, only affected paragraphs are reflowed
+RLAPI void AppendTextFlow(TextFlow *flow, const char *text);                                 // Append text at text flow end
+RLAPI void DrawTextFlow(TextFlow flow, Rectangle bounds, float scroll, Color tint);         // Draw text flow lines visible within bounds, scrolled vertically (pixels)
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1514,6 +1662,8 @@ RLAPI Vector2 MeasureTextCodepoints(Font font, const int *codepoints, int length
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
+RLAPI Texture2D GetFontGlyphTexture(Font font, int index);                                  // Get font atlas texture containing a glyph (by index), required for multi-page font atlases
+RLAPI float GetGlyphKerning(Font font, int codepoint, int nextCodepoint);                   // Get kerning adjustment between two codepoints (unicode characters), font base size pixels
 
 // Text codepoints management functions (unicode characters)
 RLAPI char *LoadUTF8(const int *codepoints, int length);                                    // Load UTF-8 text encoded from codepoints array
@@ -1556,6 +1706,20 @@ RLAPI char *TextToCamel(const char *text);
 RLAPI int TextToInteger(const char *text);                                                  // Get integer value from text
 RLAPI float TextToFloat(const char *text);                                                  // Get float value from text
 
+// Text arena functions, strings allocated in a text arena (no internal static buffers or allocations)
+// NOTE: Functions return NULL if arena has not enough space, one arena per thread makes them thread-safe
+RLAPI TextArena LoadTextArena(int capacity);                                                // Load text arena of requested capacity
+RLAPI void UnloadTextArena(TextArena arena);                                                // Unload text arena
+RLAPI void ResetTextArena(TextArena *arena);                                                // Reset text arena, previous strings are not valid anymore
+RLAPI const char *TextFormatArena(TextArena *arena, int *resultLength, const char *text, ...); // Text formatting with variables (sprintf() style), length returned by parameter
+RLAPI const char *TextSubtextArena(TextArena *arena, const char *text, int position, int length, int *resultLength); // Get a piece of a text string
+RLAPI const char *TextReplaceArena(TextArena *arena, const char *text, const char *search, const char *replacement, int *resultLength); // Replace text string with new string
+RLAPI const char *TextInsertArena(TextArena *arena, const char *text, const char *insert, int position, int *resultLength); // Insert text in a defined byte position
+RLAPI const char *TextJoinArena(TextArena *arena, char **textList, int count, const char *delimiter, int *resultLength); // Join text strings with delimiter
+RLAPI char **TextSplitArena(TextArena *arena, const char *text, char delimiter, int *count); // Split text into multiple strings (no strings count limit)
+RLAPI const char *TextToUpperArena(TextArena *arena, const char *text, int *resultLength);   // Get upper case version of provided string
+RLAPI const char *TextToLowerArena(TextArena *arena, const char *text, int *resultLength);   // Get lower case version of provided string
+
 //------------------------------------------------------------------------------------
 // Basic 3d Shapes Drawing Functions (Module: models)
 //------------------------------------------------------------------------------------
@@ -1657,24 +1821,33 @@ RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3
 // Audio Loading and Playing Functions (Module: audio)
 //------------------------------------------------------------------------------------
 typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
+typedef void (*LoadWavesCallback)(int loadedCount, int waveCount);
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceOffline(int sampleRate);                    // Initialize audio context without output device, mixed on RenderAudioToWave() (0 for default sample rate)
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI void SetAudioVoiceLimit(int maxVoices);                         // Set maximum number of sounds mixed at once, exceeding ones turn virtual (0 for no limit)
+RLAPI int GetAudioVoiceCount(void);                                   // Get number of sounds mixed on last audio period
+RLAPI int GetAudioVirtualVoiceCount(void);                            // Get number of sounds playing but not mixed (virtual) on last audio period
+RLAPI Wave RenderAudioToWave(int frameCount);                         // Render next frames of audio mix into a new wave, faster than realtime (requires offline device)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
+RLAPI Wave *LoadWaves(const char **fileNames, int count, bool deviceFormat, LoadWavesCallback callback); // Load multiple waves from files in parallel, optionally in device format, with progress callback
 RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
 RLAPI bool IsWaveValid(Wave wave);                                    // Checks if wave data is valid (data loaded and parameters)
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI Sound LoadSoundFromWaveEx(Wave wave, int storage);              // Load sound from wave data, defining data storage in memory (SoundStorage)
 RLAPI Sound LoadSoundAlias(Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
 RLAPI bool IsSoundValid(Sound sound);                                 // Checks if a sound is valid (data loaded and buffers initialized)
 RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data (default data format: 32 bit float, stereo)
 RLAPI void UnloadWave(Wave wave);                                     // Unload wave data
+RLAPI void UnloadWaves(Wave *waves, int count);                       // Unload waves loaded with LoadWaves()
 RLAPI void UnloadSound(Sound sound);                                  // Unload sound
 RLAPI void UnloadSoundAlias(Sound alias);                             // Unload a sound alias (does not deallocate sample data)
 RLAPI bool ExportWave(Wave wave, const char *fileName);               // Export wave data to file, returns true on success
@@ -1689,6 +1862,9 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (-1.0 left, 0.0 center, 1.0 right)
+RLAPI void SetSoundResampler(Sound sound, int resampler);             // Set resampler for a sound (AudioResampler)
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound (higher priority sounds are kept mixed first when voices limit is reached)
+RLAPI void SetSoundBus(Sound sound, AudioBus bus);                    // Set audio bus a sound is mixed into (empty bus for master mix)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1710,6 +1886,8 @@ RLAPI void SeekMusicStream(Music music, float position);              // Seek mu
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (-1.0 left, 0.0 center, 1.0 right)
+RLAPI void SetMusicResampler(Music music, int resampler);             // Set resampler for a music (AudioResampler)
+RLAPI void SetMusicBus(Music music, AudioBus bus);                    // Set audio bus a music is mixed into (empty bus for master mix)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
 
@@ -1727,6 +1905,8 @@ RLAPI void StopAudioStream(AudioStream stream);                       // Stop au
 RLAPI void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 RLAPI void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
 RLAPI void SetAudioStreamPan(AudioStream stream, float pan);          // Set pan for audio stream (-1.0 to 1.0 range, 0.0 is centered)
+RLAPI void SetAudioStreamResampler(AudioStream stream, int resampler); // Set resampler for audio stream (AudioResampler)
+RLAPI void SetAudioStreamBus(AudioStream stream, AudioBus bus);       // Set audio bus an audio stream is mixed into (empty bus for master mix)
 RLAPI void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
 RLAPI void SetAudioStreamCallback(AudioStream stream, AudioCallback callback); // Audio thread callback to request new data
 
@@ -1736,6 +1916,15 @@ RLAPI void DetachAudioStreamProcessor(AudioStream stream, AudioCallback processo
 RLAPI void AttachAudioMixedProcessor(AudioCallback processor); // Attach audio stream processor to the entire audio pipeline, receives frames x 2 samples as 'float' (stereo)
 RLAPI void DetachAudioMixedProcessor(AudioCallback processor); // Detach audio stream processor from the entire audio pipeline
 
+// AudioBus management functions
+RLAPI AudioBus LoadAudioBus(void);                                    // Load audio bus (sub-mix), mixed into master mix by default
+RLAPI bool IsAudioBusValid(AudioBus bus);                             // Checks if an audio bus is valid
+RLAPI void UnloadAudioBus(AudioBus bus);                              // Unload audio bus, audio mixed into it is mixed into its output
+RLAPI void SetAudioBusOutput(AudioBus bus, AudioBus output);          // Set audio bus output, mixed into another bus (empty bus for master mix)
+RLAPI void SetAudioBusVolume(AudioBus bus, float volume);             // Set volume for audio bus (1.0 is base level)
+RLAPI int AddAudioBusEffect(AudioBus bus, int effect, float param1, float param2, float param3); // Add effect to the end of audio bus chain (AudioEffect), returns effect index
+RLAPI void SetAudioBusEffect(AudioBus bus, int index, float param1, float param2, float param3); // Set parameters of an audio bus effect
+
 #if defined(__cplusplus)
 }
 #endif
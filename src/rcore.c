@@ -744,6 +744,9 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+#if SUPPORT_MODULE_RTEXTURES
+    WaitImageExports();         // WARNING: Module required: rtextures
+#endif
 #if SUPPORT_MODULE_RTEXT
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
@@ -1843,10 +1846,12 @@ void TakeScreenshot(const char *fileName)
     char path[MAX_FILEPATH_LENGTH] = { 0 };
     strncpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName), MAX_FILEPATH_LENGTH - 1);
 
-    ExportImage(image, path); // WARNING: Module required: rtextures
+    // NOTE: Image is encoded and saved on a background thread, not blocking the render loop,
+    // export result is logged by the export task once the file is written
+    bool result = ExportImageAsync(image, path); // WARNING: Module required: rtextures
     RL_FREE(imgData);
 
-    if (FileExists(path)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+    if (result) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot queued to be saved", path);
     else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", path);
 #else
     TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
@@ -18,11 +18,28 @@
 *       #define MAX_TEXTSPLIT_COUNT       128
 *           TextSplit() function static substrings pointers array (pointing to static buffer)
 *
+*       #define TEXT_THREAD_LOCAL
+*           Storage qualifier for text functions static buffers, thread-local by default so those functions
+*           can be used from worker threads, define it empty if the platform does not support thread-local storage
+*
 *       #define FONT_ATLAS_CORNER_REC_SIZE  3
 *           On font atlas image generation [GenImageFontAtlas()], add a NxN pixels white rectangle
 *           at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
 *           drawing text and shapes with a single draw call [SetShapesTexture()]
 *
+*       #define FONT_ATLAS_MAX_SIZE        4096
+*           Font atlas page maximum size on font loading, glyphs not fitting in a page are packed
+*           into additional atlas pages (textures), font.texture is first page, use GetFontGlyphTexture()
+*
+*       #define FONT_KERNING_MAX_GLYPHS     256
+*           Font kerning pairs are loaded from TTF/OTF 'kern' table, fonts with GPOS table can only be queried
+*           by pairs, so only pairs between the first N glyphs are checked on font loading
+*
+*       #define FONT_DYNAMIC_PAGE_SIZE      512
+*       #define FONT_DYNAMIC_PAGE_COUNT       4
+*           Dynamic fonts [LoadFontDynamic()] atlas page size and number of pages, glyphs are rasterized
+*           on first use, least recently used page is cleared when atlas is full
+*
 *   DEPENDENCIES:
 *       stb_truetype  - Load TTF file and rasterize characters data
 *       stb_rect_pack - Rectangles packing algorithms, required for font atlas generation
@@ -59,10 +76,19 @@
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
-#include <string.h>         // Required for: strcmp(), strstr(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
+#include <string.h>         // Required for: strcmp(), strstr(), memcpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
+// Vectorized ASCII runs scanning on UTF-8 decoding [GetCodepointCount(), LoadCodepoints()]
+#if defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64)
+    #include <emmintrin.h>          // Required for: _mm_loadu_si128(), _mm_movemask_epi8()
+    #define RTEXT_SSE2_ENABLED
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>           // Required for: vld1q_u8(), vmaxvq_u8()
+    #define RTEXT_NEON_ENABLED
+#endif
+
 #if SUPPORT_FILEFORMAT_TTF || SUPPORT_FILEFORMAT_BDF
     #if defined(__GNUC__) // GCC and Clang
         #pragma GCC diagnostic push
@@ -107,6 +133,16 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT         128         // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef TEXT_THREAD_LOCAL
+    // Text functions static buffers are thread-local, every thread gets its own buffers
+    #if defined(_MSC_VER)
+        #define TEXT_THREAD_LOCAL __declspec(thread)
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define TEXT_THREAD_LOCAL __thread
+    #else
+        #define TEXT_THREAD_LOCAL
+    #endif
+#endif
 
 #ifndef FONT_ATLAS_CORNER_REC_SIZE
     // On font atlas image generation [GenImageFontAtlas()], add a 3x3 pixels white rectangle
@@ -115,10 +151,109 @@
     #define FONT_ATLAS_CORNER_REC_SIZE    3         // Size of white rectangle drawn on font atlas on font loading
 #endif
 
+#ifndef FONT_ATLAS_MAX_SIZE
+    #define FONT_ATLAS_MAX_SIZE        4096         // Font atlas page maximum size on font loading, additional pages used if required
+#endif
+
+#ifndef FONT_DYNAMIC_PAGE_SIZE
+    #define FONT_DYNAMIC_PAGE_SIZE      512         // Dynamic font atlas page size in pixels (square pages)
+#endif
+#ifndef FONT_DYNAMIC_PAGE_COUNT
+    #define FONT_DYNAMIC_PAGE_COUNT       4         // Dynamic font atlas pages, stacked vertically on atlas texture
+#endif
+
+#ifndef FONT_KERNING_MAX_GLYPHS
+    #define FONT_KERNING_MAX_GLYPHS     256         // Maximum glyphs checked for kerning pairs on font loading (fonts with GPOS table)
+#endif
+
+#define GLYPH_LOOKUP_PAGE_SIZE          256         // Glyphs lookup table direct-mapped codepoints: Basic Latin + Latin-1 Supplement
+#define FONT_GLYPHS_JOB_BLOCK_SIZE        4         // Glyphs rasterized per block on font data loading (multi-threaded)
+#define KERNING_EMPTY_KEY      0xffffffffffffffffull // Kerning table empty slot key
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if SUPPORT_FILEFORMAT_TTF
+// Dynamic font atlas, glyphs rasterized on first use
+// NOTE: Atlas texture is split vertically in pages, glyphs are packed per page (skyline),
+// every page owns a fixed range of font glyph slots, cleared with the page on eviction
+typedef struct FontAtlasDynamic {
+    stbtt_fontinfo fontInfo;        // Font info, required for glyphs rasterization
+    unsigned char *fileData;        // Font file data (copy), referenced by font info
+    float scaleFactor;              // Font scale factor for requested size
+    int ascent;                     // Font ascent (baseline), scaled
+    int fontSize;                   // Font size (glyphs height)
+    int padding;                    // Glyphs padding
+    Texture2D texture;              // Atlas texture (shared with font)
+    GlyphInfo *glyphs;              // Font glyphs slots (shared with font)
+    Rectangle *recs;                // Font glyphs rectangles (shared with font)
+    int pageSize;                   // Atlas page size
+    int pageCount;                  // Atlas pages count
+    int pageGlyphCapacity;          // Glyph slots per page
+    int *pageGlyphCount;            // Glyph slots used per page
+    unsigned int *pageLastUse;      // Page last use stamp, for least recently used page eviction
+    unsigned int useCounter;        // Use stamps counter
+    unsigned int generation;        // Pages clearing counter, glyph indices retrieved before a change could be evicted
+    stbrp_context *packers;         // Rectangles packers per page
+    stbrp_node *nodes;              // Rectangles packers nodes (pageSize per page)
+} FontAtlasDynamic;
+#endif
+
+#if SUPPORT_FILEFORMAT_TTF
+// Font glyphs rasterization job data, shared by all workers
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // Font info
+    GlyphInfo *glyphs;              // Glyphs to rasterize, codepoint values already set
+    int fontSize;                   // Font size (glyphs height)
+    int type;                       // Font type (FontType)
+    float scaleFactor;              // Font scale factor for requested size
+    int ascent;                     // Font ascent (baseline), unscaled
+} FontGlyphsJob;
+#endif
+
+// Glyphs lookup table, maps codepoints to font glyph indices
+// NOTE: Codepoints in the first page are direct-mapped, the rest are hashed (open addressing, linear probing)
+struct rGlyphLookup {
+    const GlyphInfo *glyphs;        // Glyphs the table was built for, used to detect outdated tables
+    int glyphCount;                 // Glyphs count the table was built for
+    int fallbackIndex;              // Fallback glyph index, '?' if available
+    int page[GLYPH_LOOKUP_PAGE_SIZE]; // Glyph indices for first page codepoints, -1 if not available
+    int capacity;                   // Hash table capacity (power of two), 0 if all codepoints in first page
+    int *codepoints;                // Hash table codepoints
+    int *indices;                   // Hash table glyph indices, -1 on empty slots
+    struct FontAtlasDynamic *atlas; // Dynamic font atlas, NULL for fonts with all glyphs loaded
+    int textureCount;               // Atlas pages textures count, 0 for single texture fonts
+    Texture2D *textures;            // Atlas pages textures, first one is font texture
+    unsigned short *glyphTextures;  // Atlas page index for every glyph
+    int kerningCapacity;            // Kerning table capacity (power of two), 0 if font has no kerning
+    int kerningCount;               // Kerning table pairs count
+    unsigned long long *kerningKeys; // Kerning table codepoints pairs, KERNING_EMPTY_KEY on empty slots
+    float *kerningValues;           // Kerning table advance adjustments, font base size pixels
+};
+
+// Text flow wrapped line
+typedef struct TextFlowLine {
+    int start;                      // Line start, byte offset in paragraph
+    int length;                     // Line length in bytes (breaking spaces not included)
+    float width;                    // Line width in pixels
+} TextFlowLine;
+
+// Text flow paragraph, text between line-breaks, wrapped independently
+typedef struct TextFlowParagraph {
+    int length;                     // Paragraph length in bytes (line-break not included)
+    int lineCount;                  // Wrapped lines count
+    float width;                    // Widest line width
+    TextFlowLine *lines;            // Wrapped lines
+} TextFlowParagraph;
+
+// Text flow wrapping data
+// NOTE: Paragraphs are stored in text order, an update only reflows the paragraphs it touches
+struct rTextFlowData {
+    int textCapacity;               // Text buffer capacity in bytes
+    int paragraphCount;             // Paragraphs count
+    int paragraphCapacity;          // Paragraphs array capacity
+    TextFlowParagraph *paragraphs;  // Paragraphs data
+};
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -133,7 +268,7 @@ static int textLineSpacing = 2;
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-//...
+extern void RunImageJob(void (*func)(void *data, int start, int end), void *data, int count, int blockSize); // [Module: textures] Run processing job on worker threads
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -144,6 +279,36 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if SUPPORT_FILEFORMAT_BDF
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, const int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount); // Load glyphs lookup table by codepoint
+static void UnloadGlyphLookup(rGlyphLookup *lookup);                          // Unload glyphs lookup table
+static unsigned int GetGlyphLookupHash(int codepoint, int capacity);          // Get glyphs lookup table hash slot for a codepoint
+static int FindGlyphLookup(const rGlyphLookup *lookup, int codepoint);         // Find glyph index in lookup table, -1 if not available
+static void AddGlyphLookup(rGlyphLookup *lookup, int codepoint, int index);    // Add glyph index to lookup table (first glyph for a codepoint is kept)
+#if SUPPORT_FILEFORMAT_TTF || SUPPORT_FILEFORMAT_BDF
+static Image *GenImageFontAtlasPages(const GlyphInfo *glyphs, Rectangle *recs, unsigned short *glyphPages, int glyphCount, int padding, int maxSize, int *pageCount); // Generate font atlas pages (skyline best-fit packing)
+#endif
+static bool HasGlyphKerning(Font font);                                         // Check if font has kerning adjustments
+static unsigned int GetKerningHash(unsigned long long key, int capacity);       // Get kerning table hash slot for a codepoints pair key
+static bool FindGlyphKerning(const rGlyphLookup *lookup, int codepoint, int nextCodepoint, float *kerning); // Find kerning for a codepoints pair in kerning table
+#if SUPPORT_FILEFORMAT_TTF
+static void AddGlyphKerning(rGlyphLookup *lookup, int codepoint, int nextCodepoint, float kerning); // Add kerning for a codepoints pair to kerning table
+static void LoadGlyphKerning(rGlyphLookup *lookup, const unsigned char *fileData, const GlyphInfo *glyphs, int glyphCount, int fontSize); // Load kerning table for font glyphs from TTF/OTF font data
+#endif
+static float GetGlyphAdvance(Font font, int index, float scaleFactor);         // Get glyph advance for a scale factor (no spacing)
+static bool IsLineBreakAfter(int codepoint);                                   // Check if a line can be broken after codepoint (hyphen, CJK ideographs)
+static int WrapTextLine(Font font, const char *text, int length, float fontSize, float spacing, float maxWidth, int *nextStart, float *lineWidth); // Get next wrapped line length in bytes
+static void AddTextLayoutGlyphs(TextLayout *layout, const char *text, int length, Vector2 offset); // Add text line glyphs to text layout
+static int GetTextAsciiLength(const unsigned char *text, int length);           // Get number of ASCII bytes at text start (vectorized)
+static char *AllocTextArena(TextArena *arena, int size);                        // Allocate bytes from text arena, NULL if not enough space
+static int FindTextFlowParagraph(const TextFlow *flow, int position, int *paragraphStart); // Find text flow paragraph containing byte position
+static void WrapTextFlowParagraph(const TextFlow *flow, TextFlowParagraph *paragraph, const char *text); // Wrap text flow paragraph lines
+#if SUPPORT_FILEFORMAT_TTF
+static int LoadGlyphDynamic(rGlyphLookup *lookup, int codepoint);              // Rasterize glyph into dynamic font atlas, returns glyph index or -1 if not available
+static void ClearGlyphAtlasPage(rGlyphLookup *lookup, int page);               // Clear dynamic font atlas page, unloading its glyphs
+static void LoadFontGlyphs(void *data, int start, int end);                    // Rasterize font glyphs in range [start, end)
+static unsigned char *GenGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, unsigned char onEdgeValue, float pixelDistScale, int *width, int *height, int *offsetX, int *offsetY); // Generate glyph SDF from supersampled bitmap
+static void ComputeDistanceTransform(float *grid, int width, int height, float *f, float *d, int *v, float *z); // Compute squared euclidean distance transform (in-place)
+#endif
 
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
@@ -311,6 +476,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -322,9 +488,11 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.glyphLookup);
     defaultFont.glyphCount = 0;
     defaultFont.glyphs = NULL;
     defaultFont.recs = NULL;
+    defaultFont.glyphLookup = NULL;
 }
 
 // Get the default font, useful to be used with extended parameters
@@ -501,6 +669,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     font.texture = LoadTextureFromImage(fontClear); // Convert processed image to OpenGL texture
     font.glyphCount = index;
     font.glyphPadding = 0;
+    font.glyphLookup = NULL;
 
     // Populate tempCharValues and tempCharsRecs with glyphs data
     // Move temp data to sized charValues and charRecs arrays
@@ -526,6 +695,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -566,17 +736,42 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     {
         font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
-        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
-        font.texture = LoadTextureFromImage(atlas);
+        // NOTE: Rectangles memory is loaded here, glyphs not fitting in a page go to additional pages
+        int pageCount = 0;
+        unsigned short *glyphPages = (unsigned short *)RL_MALLOC(font.glyphCount*sizeof(unsigned short));
+        font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+        Image *atlas = GenImageFontAtlasPages(font.glyphs, font.recs, glyphPages, font.glyphCount, font.glyphPadding, FONT_ATLAS_MAX_SIZE, &pageCount);
+        font.texture = LoadTextureFromImage(atlas[0]);
 
         // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
         for (int i = 0; i < font.glyphCount; i++)
         {
             UnloadImage(font.glyphs[i].image);
-            font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+            font.glyphs[i].image = ImageFromImage(atlas[glyphPages[i]], font.recs[i]);
+        }
+
+        font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
+        if ((pageCount > 1) && (font.glyphLookup != NULL))
+        {
+            font.glyphLookup->textureCount = pageCount;
+            font.glyphLookup->textures = (Texture2D *)RL_MALLOC(pageCount*sizeof(Texture2D));
+            font.glyphLookup->textures[0] = font.texture;
+            for (int i = 1; i < pageCount; i++) font.glyphLookup->textures[i] = LoadTextureFromImage(atlas[i]);
+            font.glyphLookup->glyphTextures = glyphPages;
+            glyphPages = NULL;
+
+            TRACELOG(LOG_INFO, "FONT: Glyphs packed in %i atlas pages", pageCount);
         }
+        else if (pageCount > 1) TRACELOG(LOG_WARNING, "FONT: Glyphs lookup not available, %i atlas pages dropped, glyphs not in first page will not be drawn properly", pageCount - 1);
 
-        UnloadImage(atlas);
+        for (int i = 0; i < pageCount; i++) UnloadImage(atlas[i]);
+        RL_FREE(atlas);
+        RL_FREE(glyphPages);
+
+#if SUPPORT_FILEFORMAT_TTF
+        if (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")) LoadGlyphKerning(font.glyphLookup, fileData, font.glyphs, font.glyphCount, font.baseSize);
+#endif
 
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
@@ -588,6 +783,150 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load dynamic font from TTF/OTF file, glyphs are rasterized on first use
+Font LoadFontDynamic(const char *fileName, int fontSize)
+{
+    Font font = { 0 };
+
+    // Loading file to memory
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        // Loading font from memory data
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize);
+
+        UnloadFileData(fileData);
+    }
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied internally, glyphs are rasterized on first use into a paged atlas texture,
+// least recently used atlas page is cleared when no more glyphs fit
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize)
+{
+    Font font = { 0 };
+
+#if SUPPORT_FILEFORMAT_TTF
+    char fileExtLower[16] = { 0 };
+    strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
+
+    FontAtlasDynamic *atlas = NULL;
+
+    if ((fileData != NULL) && (dataSize > 0) && (fontSize > 0) && (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")))
+    {
+        atlas = (FontAtlasDynamic *)RL_CALLOC(1, sizeof(FontAtlasDynamic));
+        atlas->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(atlas->fileData, fileData, dataSize);
+
+        if (!stbtt_InitFont(&atlas->fontInfo, atlas->fileData, 0))
+        {
+            RL_FREE(atlas->fileData);
+            RL_FREE(atlas);
+            atlas = NULL;
+        }
+    }
+
+    if (atlas != NULL)
+    {
+        int ascent = 0;
+        stbtt_GetFontVMetrics(&atlas->fontInfo, &ascent, NULL, NULL);
+
+        atlas->scaleFactor = stbtt_ScaleForPixelHeight(&atlas->fontInfo, (float)fontSize);
+        atlas->ascent = (int)((float)ascent*atlas->scaleFactor);
+        atlas->fontSize = fontSize;
+        atlas->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+        atlas->pageSize = FONT_DYNAMIC_PAGE_SIZE;
+        atlas->pageCount = FONT_DYNAMIC_PAGE_COUNT;
+
+        // Glyph slots per page estimated for narrow glyphs (a quarter of font size wide)
+        atlas->pageGlyphCapacity = (atlas->pageSize/(fontSize + 2*atlas->padding))*(atlas->pageSize/(fontSize/4 + 2*atlas->padding + 1));
+        if (atlas->pageGlyphCapacity < 1) atlas->pageGlyphCapacity = 1;
+
+        atlas->pageGlyphCount = (int *)RL_CALLOC(atlas->pageCount, sizeof(int));
+        atlas->pageLastUse = (unsigned int *)RL_CALLOC(atlas->pageCount, sizeof(unsigned int));
+        atlas->packers = (stbrp_context *)RL_CALLOC(atlas->pageCount, sizeof(stbrp_context));
+        atlas->nodes = (stbrp_node *)RL_CALLOC(atlas->pageCount*atlas->pageSize, sizeof(stbrp_node));
+
+        for (int i = 0; i < atlas->pageCount; i++) stbrp_init_target(&atlas->packers[i], atlas->pageSize, atlas->pageSize, atlas->nodes + i*atlas->pageSize, atlas->pageSize);
+
+        // Empty atlas texture, GRAY_ALPHA (same as font atlas)
+        Image image = {
+            .data = RL_MALLOC(atlas->pageSize*atlas->pageSize*atlas->pageCount*2),
+            .width = atlas->pageSize,
+            .height = atlas->pageSize*atlas->pageCount,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+        };
+
+        for (int i = 0; i < image.width*image.height; i++)
+        {
+            ((unsigned char *)image.data)[i*2] = 255;
+            ((unsigned char *)image.data)[i*2 + 1] = 0;
+        }
+
+        font.baseSize = fontSize;
+        font.glyphCount = atlas->pageGlyphCapacity*atlas->pageCount;
+        font.glyphPadding = atlas->padding;
+        font.texture = LoadTextureFromImage(image);
+        font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+        font.recs = (Rectangle *)RL_CALLOC(font.glyphCount, sizeof(Rectangle));
+
+        UnloadImage(image);
+
+        atlas->texture = font.texture;
+        atlas->glyphs = font.glyphs;
+        atlas->recs = font.recs;
+
+        // Lookup table is filled on glyphs rasterization, hash table sized for all glyph slots
+        rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+        lookup->glyphs = font.glyphs;
+        lookup->glyphCount = font.glyphCount;
+        lookup->capacity = 16;
+        while (lookup->capacity < 2*font.glyphCount) lookup->capacity *= 2;
+        lookup->codepoints = (int *)RL_CALLOC(lookup->capacity, sizeof(int));
+        lookup->indices = (int *)RL_MALLOC(lookup->capacity*sizeof(int));
+        lookup->atlas = atlas;
+
+        for (int i = 0; i < GLYPH_LOOKUP_PAGE_SIZE; i++) lookup->page[i] = -1;
+        for (int i = 0; i < lookup->capacity; i++) lookup->indices[i] = -1;
+
+        // Kerning pairs are queried on first use and kept in kerning table
+        if ((atlas->fontInfo.kern != 0) || (atlas->fontInfo.gpos != 0))
+        {
+            lookup->kerningCapacity = 64;
+            lookup->kerningKeys = (unsigned long long *)RL_MALLOC(lookup->kerningCapacity*sizeof(unsigned long long));
+            lookup->kerningValues = (float *)RL_MALLOC(lookup->kerningCapacity*sizeof(float));
+
+            for (int i = 0; i < lookup->kerningCapacity; i++) lookup->kerningKeys[i] = KERNING_EMPTY_KEY;
+        }
+
+        font.glyphLookup = lookup;
+
+        TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %i glyph slots)", font.baseSize, font.glyphCount);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to load dynamic font data -> Using default font");
+        font = GetFontDefault();
+    }
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic fonts require TTF support -> Using default font");
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Check if a font is dynamic (glyphs rasterized on first use)
+bool IsFontDynamic(Font font)
+{
+    return ((font.glyphLookup != NULL) && (font.glyphLookup->atlas != NULL));
+}
+
 // Check if a font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool IsFontValid(Font font)
@@ -618,6 +957,9 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 #ifndef FONT_BITMAP_ALPHA_THRESHOLD
     #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
 #endif
+#ifndef FONT_SDF_SUPERSAMPLING
+    #define FONT_SDF_SUPERSAMPLING           2      // SDF font generation from supersampled bitmap distance transform, 0 for stb_truetype SDF
+#endif
 
     GlyphInfo *glyphs = NULL;
     int glyphCounter = 0;
@@ -665,110 +1007,30 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             // WARNING: Allocating space for maximum number of codepoints
             glyphs = (GlyphInfo *)RL_CALLOC(glyphCounter, sizeof(GlyphInfo));
-            glyphCounter = 0; // Reset to reuse
 
+            // NOTE: Only storing glyphs for codepoints found in the font, in requested order
             int k = 0;
             for (int i = 0; i < codepointCount; i++)
             {
-                int cpWidth = 0, cpHeight = 0;   // Codepoint width and height (on generation)
-                int cp = requiredCodepoints[i];  // Codepoint value to get info for
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into a provided bitmap
-
-                // Check if a glyph is available in the font
                 // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, cp);
-
-                if (index > 0)
+                if (stbtt_FindGlyphIndex(&fontInfo, requiredCodepoints[i]) > 0)
                 {
-                    // NOTE: Only storing glyphs for codepoints found in the font
-                    glyphs[k].value = cp;
-
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP:
-                        {
-                            glyphs[k].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, cp,
-                                &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
-                        } break;
-                        case FONT_SDF:
-                        {
-                            if (cp != 32)
-                            {
-                                glyphs[k].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, cp,
-                                    FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE,
-                                    &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
-                            }
-                        } break;
-                        //case FONT_MSDF:
-                        default: break;
-                    }
-
-                    if (glyphs[k].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, cp, &glyphs[k].advanceX, NULL);
-                        glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
-
-                        // WARNING: If requested SDF font, sdf-glyph height is definitely bigger than fontSize due to FONT_SDF_CHAR_PADDING
-                        if ((type != FONT_SDF) && (cpHeight > fontSize)) TRACELOG(LOG_WARNING, "FONT: [0x%04x] Glyph height is bigger than requested font size: %i > %i", cp, cpHeight, (int)fontSize);
-
-                        // Load glyph image
-                        glyphs[k].image.width = cpWidth;
-                        glyphs[k].image.height = cpHeight;
-                        glyphs[k].image.mipmaps = 1;
-                        glyphs[k].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        glyphs[k].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-                    //else TRACELOG(LOG_WARNING, "FONT: Glyph [0x%08x] has no image data available", cp); // Only reported for 0x20 and 0x3000
-
-                    // Create an empty image for Space character (0x20), useful for sprite font generation
-                    // NOTE: Another space to consider: 0x3000 (CJK - Ideographic Space)
-                    if ((cp == 0x20) || (cp == 0x3000))
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, cp, &glyphs[k].advanceX, NULL);
-                        glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = NULL,
-                            .width = glyphs[k].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        // Only allocate space image if required
-                        if (glyphs[k].advanceX > 0) imSpace.data = RL_CALLOC(glyphs[k].advanceX*fontSize, 1);
-                        else glyphs[k].advanceX = 0;
-
-                        glyphs[k].image = imSpace;
-                    }
-
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < cpWidth*cpHeight; p++)
-                        {
-                            if (((unsigned char *)glyphs[k].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD)
-                                ((unsigned char *)glyphs[k].image.data)[p] = 0;
-                            else ((unsigned char *)glyphs[k].image.data)[p] = 255;
-                        }
-                    }
-
+                    glyphs[k].value = requiredCodepoints[i];
                     k++;
-                    glyphCounter++;
-                }
-                else
-                {
-                    // WARNING: Glyph not found on font, optionally use a fallback glyph
                 }
             }
 
+            // Rasterize glyphs on multiple threads, glyphs are independent and stored by index
+            FontGlyphsJob job = { 0 };
+            job.fontInfo = &fontInfo;
+            job.glyphs = glyphs;
+            job.fontSize = fontSize;
+            job.type = type;
+            job.scaleFactor = scaleFactor;
+            job.ascent = ascent;
+
+            RunImageJob(LoadFontGlyphs, &job, glyphCounter, FONT_GLYPHS_JOB_BLOCK_SIZE);
+
             if (glyphCounter < codepointCount) TRACELOG(LOG_WARNING, "FONT: Requested codepoints glyphs found: [%i/%i]", k, codepointCount);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
@@ -782,7 +1044,7 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 }
 
 // Generate image font atlas using chars info
-// NOTE: Packing method: 0-Default, 1-Skyline
+// NOTE: Packing method: 0-Default, 1-Skyline (best-fit, atlas sized to glyphs, not power-of-two)
 #if SUPPORT_FILEFORMAT_TTF || SUPPORT_FILEFORMAT_BDF
 Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
@@ -802,6 +1064,22 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     // NOTE: Rectangles memory is loaded here!
     Rectangle *recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
 
+    if (packMethod == 1)    // Use Skyline rect packing algorithm (best-fit), atlas tightly sized
+    {
+        int pageCount = 0;
+        unsigned short *glyphPages = (unsigned short *)RL_MALLOC(glyphCount*sizeof(unsigned short));
+        Image *pages = GenImageFontAtlasPages(glyphs, recs, glyphPages, glyphCount, padding, 0, &pageCount);
+
+        atlas = pages[0];
+
+        RL_FREE(pages);
+        RL_FREE(glyphPages);
+
+        *glyphRecs = recs;
+
+        return atlas;
+    }
+
     // Calculate image size based on total glyph width and glyph row count
     int totalWidth = 0;
     int maxGlyphWidth = 0;
@@ -902,59 +1180,6 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             offsetX += (glyphs[i].image.width + 2*padding);
         }
     }
-    else if (packMethod == 1)  // Use Skyline rect packing algorithm (stb_pack_rect)
-    {
-        stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
-        stbrp_node *nodes = (stbrp_node *)RL_MALLOC(glyphCount*sizeof(*nodes));
-
-        stbrp_init_target(context, atlas.width, atlas.height, nodes, glyphCount);
-        stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
-
-        // Fill rectangles for packaging
-        for (int i = 0; i < glyphCount; i++)
-        {
-            rects[i].id = i;
-            rects[i].w = glyphs[i].image.width + 2*padding;
-            rects[i].h = glyphs[i].image.height + 2*padding;
-        }
-
-        // Package rectangles into atlas
-        stbrp_pack_rects(context, rects, glyphCount);
-
-        for (int i = 0; i < glyphCount; i++)
-        {
-            // It returns char rectangles in atlas
-            recs[i].x = rects[i].x + (float)padding;
-            recs[i].y = rects[i].y + (float)padding;
-            recs[i].width = (float)glyphs[i].image.width;
-            recs[i].height = (float)glyphs[i].image.height;
-
-            if (rects[i].was_packed)
-            {
-                // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < glyphs[i].image.height; y++)
-                {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
-                    {
-                        int destX = rects[i].x + padding + x;
-                        int destY = rects[i].y + padding + y;
-
-                        // Security fix: check both lower and upper bounds
-                        if (destX >= 0 && destX < atlas.width && destY >= 0 && destY < atlas.height)
-                        {
-                            ((unsigned char *)atlas.data)[destY * atlas.width + destX] =
-                                ((unsigned char *)glyphs[i].image.data)[y * glyphs[i].image.width + x];
-                        }
-                    }
-                }
-            }
-            else TRACELOG(LOG_WARNING, "FONT: Failed to package glyph (0x%02x)", glyphs[i].value);
-        }
-
-        RL_FREE(rects);
-        RL_FREE(nodes);
-        RL_FREE(context);
-    }
 
     // Add a 3x3 white rectangle at the bottom-right corner of the generated atlas,
     // useful to use as the white texture to draw shapes with raylib
@@ -1008,6 +1233,7 @@ void UnloadFont(Font font)
     {
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
+        UnloadGlyphLookup(font.glyphLookup);
         RL_FREE(font.recs);
 
         TRACELOG(LOG_DEBUG, "FONT: Unloaded font data from RAM and VRAM");
@@ -1029,6 +1255,8 @@ bool ExportFontAsCode(Font font, const char *fileName)
 
     // Get font atlas image and size, required to estimate code file size
     // NOTE: This mechanism is highly coupled to raylib
+    if ((font.glyphLookup != NULL) && (font.glyphLookup->textureCount > 1)) TRACELOG(LOG_WARNING, "Font export as code: Font has multiple atlas pages, only first page is exported");
+
     Image image = LoadImageFromTexture(font.texture);
     if (image.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) TRACELOG(LOG_WARNING, "Font export as code: Font image format is not GRAY+ALPHA!");
     int imageDataSize = GetPixelDataSize(image.width, image.height, image.format);
@@ -1212,6 +1440,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    bool kerning = HasGlyphKerning(font);
+    int previous = 0;               // Previous codepoint in line, for kerning
 
     for (int i = 0; i < size;)
     {
@@ -1225,9 +1455,14 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previous = 0;
         }
         else
         {
+            // Kerning adjustment with previous codepoint in same line
+            if (kerning && (previous != 0)) textOffsetX += GetGlyphKerning(font, previous, codepoint)*scaleFactor;
+            previous = codepoint;
+
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
                 DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
@@ -1276,7 +1511,7 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
     // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTexturePro(GetFontGlyphTexture(font, index), srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
 }
 
 // Draw multiple character (codepoints)
@@ -1286,6 +1521,8 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    bool kerning = HasGlyphKerning(font);
+    int previous = 0;               // Previous codepoint in line, for kerning
 
     for (int i = 0; i < codepointCount; i++)
     {
@@ -1296,9 +1533,14 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previous = 0;
         }
         else
         {
+            // Kerning adjustment with previous codepoint in same line
+            if (kerning && (previous != 0)) textOffsetX += GetGlyphKerning(font, previous, codepoints[i])*scaleFactor;
+            previous = codepoints[i];
+
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
                 DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
@@ -1353,6 +1595,8 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 
     int letter = 0;                 // Current character
     int index = 0;                  // Index position in sprite font
+    bool kerning = HasGlyphKerning(font);
+    int previous = 0;               // Previous character in line, for kerning
 
     for (int i = 0; i < size;)
     {
@@ -1366,6 +1610,9 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 
         if (letter != '\n')
         {
+            if (kerning && (previous != 0)) textWidth += GetGlyphKerning(font, previous, letter);
+            previous = letter;
+
             if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
             else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
         }
@@ -1374,6 +1621,7 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
             if (tempTextWidth < textWidth) tempTextWidth = textWidth;
             byteCounter = 0;
             textWidth = 0;
+            previous = 0;
 
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textHeight += (fontSize + textLineSpacing);
@@ -1412,6 +1660,9 @@ Vector2 MeasureTextCodepoints(Font font, const int *codepoints, int length, floa
     int letter = 0;
     // Index position in sprite font
     int index = 0;
+    // Previous character in line, for kerning
+    int previous = 0;
+    bool kerning = HasGlyphKerning(font);
 
     for (int i = 0; i < length; i++)
     {
@@ -1422,6 +1673,9 @@ Vector2 MeasureTextCodepoints(Font font, const int *codepoints, int length, floa
         {
             glyphCounter++;
 
+            if (kerning && (previous != 0)) textWidth += GetGlyphKerning(font, previous, letter);
+            previous = letter;
+
             if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
             else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
         }
@@ -1431,6 +1685,7 @@ Vector2 MeasureTextCodepoints(Font font, const int *codepoints, int length, floa
 
             textWidth = 0;
             glyphCounter = 0;
+            previous = 0;
 
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textHeight += (fontSize + textLineSpacing);
@@ -1454,8 +1709,32 @@ int GetGlyphIndex(Font font, int codepoint)
     int index = 0;
     if (!IsFontValid(font)) return index;
 
-#define SUPPORT_UNORDERED_CHARSET
-#if defined(SUPPORT_UNORDERED_CHARSET)
+    rGlyphLookup *lookup = font.glyphLookup;
+
+    // Use font lookup table if available and built for current glyphs data
+    if ((lookup != NULL) && (lookup->glyphs == font.glyphs) && (lookup->glyphCount == font.glyphCount))
+    {
+        index = FindGlyphLookup(lookup, codepoint);
+
+#if SUPPORT_FILEFORMAT_TTF
+        if (lookup->atlas != NULL)
+        {
+            // Dynamic font: rasterize glyph on first use, fallback glyph '?' also loaded on demand
+            if (index < 0) index = LoadGlyphDynamic(lookup, codepoint);
+            if ((index < 0) && (codepoint != 63))
+            {
+                index = FindGlyphLookup(lookup, 63);
+                if (index < 0) index = LoadGlyphDynamic(lookup, 63);
+            }
+
+            if (index >= 0) lookup->atlas->pageLastUse[index/lookup->atlas->pageGlyphCapacity] = ++lookup->atlas->useCounter;
+        }
+#endif
+        if (index < 0) index = lookup->fallbackIndex;
+
+        return index;
+    }
+
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
 
     // Look for character index in the unordered charset
@@ -1471,9 +1750,6 @@ int GetGlyphIndex(Font font, int codepoint)
     }
 
     if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
-#else
-    index = codepoint - 32;
-#endif
 
     return index;
 }
@@ -1500,736 +1776,982 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
     return rec;
 }
 
-//----------------------------------------------------------------------------------
-// Text strings management functions
-//----------------------------------------------------------------------------------
-// Load text as separate lines ('\n')
-// NOTE: Returned lines end with null terminator '\0'
-char **LoadTextLines(const char *text, int *count)
+// Get font atlas texture containing a glyph, index as returned by GetGlyphIndex()
+// NOTE: Fonts with multiple atlas pages keep glyphs in different textures, font.texture is first page only
+Texture2D GetFontGlyphTexture(Font font, int index)
 {
-    char **lines = NULL;
-    int lineCount = 0;
+    Texture2D texture = font.texture;
+    const rGlyphLookup *lookup = font.glyphLookup;
 
-    if (text != NULL)
+    if ((lookup != NULL) && (lookup->textureCount > 1) && (lookup->glyphs == font.glyphs) && (index >= 0) && (index < lookup->glyphCount))
     {
-        int textLength = TextLength(text);
-        lineCount = 1;
-
-        // First text scan pass to get required line count
-        for (int i = 0; i < textLength; i++)
-        {
-            if (text[i] == '\n') lineCount++;
-        }
-
-        lines = (char **)RL_CALLOC(lineCount, sizeof(char *));
-        for (int i = 0, l = 0, lineLen = 0; i <= textLength; i++)
-        {
-            if ((text[i] == '\n') || (text[i] == '\0'))
-            {
-                lines[l] = (char *)RL_CALLOC(lineLen + 1, 1);
-                strncpy(lines[l], &text[i - lineLen], lineLen);
-                lineLen = 0;
-                l++;
-            }
-            else lineLen++;
-        }
+        texture = lookup->textures[lookup->glyphTextures[index]];
     }
 
-    *count = lineCount;
-    return lines;
+    return texture;
 }
 
-// Unload text lines
-void UnloadTextLines(char **lines, int lineCount)
+// Get kerning adjustment between two codepoints (unicode characters), font base size pixels
+// NOTE: Kerning is loaded from TTF/OTF fonts, dynamic fonts query pairs on first use
+float GetGlyphKerning(Font font, int codepoint, int nextCodepoint)
 {
-    for (int i = 0; i < lineCount; i++) RL_FREE(lines[i]);
-    RL_FREE(lines);
-}
+    float kerning = 0.0f;
 
-// Get text length in bytes, check for \0 character
-// NOTE: Alternative: use strlen(text)
-unsigned int TextLength(const char *text)
-{
-    unsigned int length = 0;
+    if (!HasGlyphKerning(font)) return kerning;
 
-    if (text != NULL)
+    rGlyphLookup *lookup = font.glyphLookup;
+
+    if (!FindGlyphKerning(lookup, codepoint, nextCodepoint, &kerning))
     {
-        while (text[length] != '\0') length++;
+#if SUPPORT_FILEFORMAT_TTF
+        if (lookup->atlas != NULL)
+        {
+            // Pairs without kerning are also cached to avoid querying font data again
+            kerning = (float)stbtt_GetCodepointKernAdvance(&lookup->atlas->fontInfo, codepoint, nextCodepoint)*lookup->atlas->scaleFactor;
+            AddGlyphKerning(lookup, codepoint, nextCodepoint, kerning);
+        }
+#endif
     }
 
-    return length;
+    return kerning;
 }
 
-// Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
-const char *TextFormat(const char *text, ...)
+//----------------------------------------------------------------------------------
+// Text layout functions
+//----------------------------------------------------------------------------------
+// Load text layout, glyphs placement precomputed for repeated drawing
+// NOTE: Layout matches DrawTextEx() placement, font is referenced (not copied) and must be kept loaded
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
 {
-#ifndef MAX_TEXTFORMAT_BUFFERS
-    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
-#endif
-
-    // Create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    TextLayout layout = { 0 };
 
-    char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH); // Clear buffer before using
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-    if (text != NULL)
-    {
-        va_list args;
-        va_start(args, text);
-        int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
-        va_end(args);
+    layout.font = font;
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
 
-        // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occurred
-        if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
-        {
-            // Inserting "..." at the end of the string to mark as truncated
-            char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
-            snprintf(truncBuffer, 4, "...");
-        }
+    if ((text == NULL) || (text[0] == '\0') || !IsFontValid(font)) return layout;
 
-        index += 1;     // Move to next buffer for next function call
-        if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
-    }
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
-    return currentBuffer;
-}
+    // NOTE: Allocating space for maximum number of glyphs (one per byte)
+    layout.codepoints = (int *)RL_MALLOC(size*sizeof(int));
+    layout.glyphs = (int *)RL_MALLOC(size*sizeof(int));
+    layout.positions = (Vector2 *)RL_MALLOC(size*sizeof(Vector2));
+    layout.lineCount = 1;
 
-// Get integer value from text
-// NOTE: This function replaces atoi() [stdlib.h]
-int TextToInteger(const char *text)
-{
-    int value = 0;
-    int sign = 1;
+    float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
 
-    if (text != NULL)
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    bool kerning = HasGlyphKerning(font);
+    int previous = 0;               // Previous codepoint in line, for kerning
+
+    for (int i = 0; i < size;)
     {
-        if ((text[0] == '+') || (text[0] == '-'))
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
         {
-            if (text[0] == '-') sign = -1;
-            text++;
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+            previous = 0;
+            layout.lineCount++;
         }
+        else
+        {
+            // Kerning adjustment with previous codepoint in same line
+            if (kerning && (previous != 0)) textOffsetX += GetGlyphKerning(font, previous, codepoint)*scaleFactor;
+            previous = codepoint;
 
-        for (int i = 0; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                layout.codepoints[layout.glyphCount] = codepoint;
+                layout.glyphs[layout.glyphCount] = index;
+                layout.positions[layout.glyphCount] = (Vector2){ textOffsetX, textOffsetY };
+                layout.glyphCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
 
-    return value*sign;
+    layout.size = MeasureTextEx(font, text, fontSize, spacing);
+
+    return layout;
 }
 
-// Get float value from text
-// NOTE: This function replaces atof() [stdlib.h]
-// WARNING: Only '.' character is understood as decimal point
-float TextToFloat(const char *text)
+// Load text layout word-wrapped to width, with lines alignment
+// NOTE: Lines are broken at spaces, after hyphens and between CJK ideographs, words wider than
+// maxWidth are broken between characters; if text exceeds maxLines, last line ends with an ellipsis
+TextLayout LoadTextLayoutEx(Font font, const char *text, float fontSize, float spacing, float maxWidth, int maxLines, int alignment)
 {
-    float value = 0.0f;
-    float sign = 1.0f;
+    TextLayout layout = { 0 };
 
-    if (text != NULL)
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    layout.font = font;
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+
+    if ((text == NULL) || (text[0] == '\0') || !IsFontValid(font)) return layout;
+
+    int size = TextLength(text);    // Total size in bytes of the text
+
+    // NOTE: Allocating space for maximum number of glyphs (one per byte) plus ellipsis,
+    // lines data is only required until alignment is applied
+    layout.codepoints = (int *)RL_MALLOC((size + 3)*sizeof(int));
+    layout.glyphs = (int *)RL_MALLOC((size + 3)*sizeof(int));
+    layout.positions = (Vector2 *)RL_MALLOC((size + 3)*sizeof(Vector2));
+    int *lineFirstGlyph = (int *)RL_MALLOC((size + 2)*sizeof(int));
+    float *lineWidths = (float *)RL_MALLOC((size + 1)*sizeof(float));
+
+    float scaleFactor = fontSize/font.baseSize;
+    float ellipsisWidth = 3.0f*GetGlyphAdvance(font, GetGlyphIndex(font, '.'), scaleFactor) + 2.0f*spacing;
+    if (HasGlyphKerning(font)) ellipsisWidth += 2.0f*GetGlyphKerning(font, '.', '.')*scaleFactor;
+    float textWidth = 0.0f;         // Widest line width
+    bool truncated = false;
+
+    for (int start = 0; (start <= size) && !truncated;)
     {
-        if ((text[0] == '+') || (text[0] == '-'))
-        {
-            if (text[0] == '-') sign = -1.0f;
-            text++;
-        }
+        // Get paragraph end, wrapped independently
+        int end = start;
+        while ((end < size) && (text[end] != '\n')) end++;
 
-        int i = 0;
-        for (; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10.0f + (float)(text[i] - '0');
+        int position = start;
 
-        if (text[i++] == '.')
+        do
         {
-            float divisor = 10.0f;
-            for (; ((text[i] >= '0') && (text[i] <= '9')); i++)
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            Vector2 offset = { 0.0f, layout.lineCount*(fontSize + textLineSpacing) };
+            int nextStart = 0;
+            float lineWidth = 0.0f;
+            int length = WrapTextLine(font, text + position, end - position, fontSize, spacing, maxWidth, &nextStart, &lineWidth);
+
+            lineFirstGlyph[layout.lineCount] = layout.glyphCount;
+
+            if ((maxLines > 0) && (layout.lineCount == (maxLines - 1)) && (((position + nextStart) < end) || (end < size)))
             {
-                value += ((float)(text[i] - '0'))/divisor;
-                divisor = divisor*10.0f;
+                // Text exceeds lines limit, last line is wrapped again leaving space for the ellipsis
+                float lineMaxWidth = maxWidth - ellipsisWidth - spacing;
+                if (maxWidth <= 0.0f) lineMaxWidth = 0.0f;
+                else if (lineMaxWidth < 1.0f) lineMaxWidth = 1.0f;
+
+                length = WrapTextLine(font, text + position, end - position, fontSize, spacing, lineMaxWidth, &nextStart, &lineWidth);
+                AddTextLayoutGlyphs(&layout, text + position, length, offset);
+
+                offset.x = (lineWidth > 0.0f)? (lineWidth + spacing) : 0.0f;
+                AddTextLayoutGlyphs(&layout, "...", 3, offset);
+                lineWidth = offset.x + ellipsisWidth;
+                truncated = true;
             }
-        }
-    }
+            else AddTextLayoutGlyphs(&layout, text + position, length, offset);
 
-    return value*sign;
-}
+            lineWidths[layout.lineCount] = lineWidth;
+            if (lineWidth > textWidth) textWidth = lineWidth;
+            layout.lineCount++;
 
-// Copy one string to another, returns bytes copied
-// NOTE: Alternative implementation to strcpy(dst, src) from C standard library
-int TextCopy(char *dst, const char *src)
-{
-    int bytes = 0;
+            position += nextStart;
 
-    if ((src != NULL) && (dst != NULL))
+        } while ((position < end) && !truncated);
+
+        start = end + 1;
+    }
+
+    lineFirstGlyph[layout.lineCount] = layout.glyphCount;
+
+    // Align lines within wrapping width, or within widest line if not wrapped
+    if (alignment != TEXT_ALIGN_LEFT)
     {
-        while (*src != '\0')
+        float alignWidth = (maxWidth > 0.0f)? maxWidth : textWidth;
+
+        for (int i = 0; i < layout.lineCount; i++)
         {
-            *dst = *src;
-            dst++;
-            src++;
+            float offsetX = alignWidth - lineWidths[i];
+            if (alignment == TEXT_ALIGN_CENTER) offsetX *= 0.5f;
 
-            bytes++;
+            for (int k = lineFirstGlyph[i]; k < lineFirstGlyph[i + 1]; k++) layout.positions[k].x += offsetX;
         }
-
-        *dst = '\0';
     }
 
-    return bytes;
+    layout.size.x = textWidth;
+    layout.size.y = fontSize + (layout.lineCount - 1)*(fontSize + textLineSpacing);
+
+    RL_FREE(lineFirstGlyph);
+    RL_FREE(lineWidths);
+
+    return layout;
 }
 
-// Check if two text string are equal
-// REQUIRES: strcmp()
-bool TextIsEqual(const char *text1, const char *text2)
+// Unload text layout
+void UnloadTextLayout(TextLayout layout)
 {
-    bool result = false;
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.glyphs);
+    RL_FREE(layout.positions);
+}
 
-    if ((text1 != NULL) && (text2 != NULL))
+// Draw text layout
+// NOTE: All glyphs are submitted as a single quads batch, dynamic fonts glyphs are refreshed before drawing
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    Font font = layout.font;
+
+    if ((layout.glyphCount <= 0) || (font.texture.id == 0)) return;
+
+    // Dynamic fonts could have moved glyphs in atlas since layout was loaded
+    if (IsFontDynamic(font))
     {
-        if (strcmp(text1, text2) == 0) result = true;
+#if SUPPORT_FILEFORMAT_TTF
+        unsigned int generation = font.glyphLookup->atlas->generation;
+#endif
+        for (int i = 0; i < layout.glyphCount; i++) layout.glyphs[i] = GetGlyphIndex(font, layout.codepoints[i]);
+
+#if SUPPORT_FILEFORMAT_TTF
+        // Atlas can not hold all layout glyphs if a page was cleared while refreshing, already refreshed
+        // glyphs could be evicted: glyphs are resolved and drawn one by one, page clearing flushes the batch
+        if (font.glyphLookup->atlas->generation != generation)
+        {
+            for (int i = 0; i < layout.glyphCount; i++) DrawTextCodepoint(font, layout.codepoints[i], (Vector2){ position.x + layout.positions[i].x, position.y + layout.positions[i].y }, layout.fontSize, tint);
+
+            return;
+        }
+#endif
     }
 
-    return result;
-}
+    float scaleFactor = layout.fontSize/font.baseSize;  // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+    Texture2D texture = GetFontGlyphTexture(font, layout.glyphs[0]);
+    float width = (float)texture.width;
+    float height = (float)texture.height;
 
-// Get a piece of a text string
-const char *TextSubtext(const char *text, int position, int length)
-{
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
 
-    if (text != NULL)
-    {
-        int textLength = TextLength(text);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                  // Normal vector pointing towards viewer
 
-        if (position < textLength)
+        for (int i = 0; i < layout.glyphCount; i++)
         {
-            int maxLength = textLength - position;
-            if (length > maxLength) length = maxLength;
-            if (length >= MAX_TEXT_BUFFER_LENGTH) length = MAX_TEXT_BUFFER_LENGTH - 1;
+            // Multi-page fonts require a new batch when glyph atlas page changes
+            Texture2D glyphTexture = GetFontGlyphTexture(font, layout.glyphs[i]);
 
-            // NOTE: Alternative: memcpy(buffer, text + position, length)
+            if (glyphTexture.id != texture.id)
+            {
+                rlEnd();
 
-            for (int c = 0; c < length; c++) buffer[c] = text[position + c];
+                texture = glyphTexture;
+                width = (float)texture.width;
+                height = (float)texture.height;
 
-            buffer[length] = '\0';
+                rlSetTexture(texture.id);
+                rlBegin(RL_QUADS);
+
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);
+            }
+
+            const GlyphInfo *glyph = &font.glyphs[layout.glyphs[i]];
+            Rectangle rec = font.recs[layout.glyphs[i]];
+
+            // Character destination rectangle on screen and source rectangle in texture atlas,
+            // considering glyph padding (same as DrawTextCodepoint())
+            float x = position.x + layout.positions[i].x + glyph->offsetX*scaleFactor - padding*scaleFactor;
+            float y = position.y + layout.positions[i].y + glyph->offsetY*scaleFactor - padding*scaleFactor;
+            float quadWidth = (rec.width + 2.0f*padding)*scaleFactor;
+            float quadHeight = (rec.height + 2.0f*padding)*scaleFactor;
+
+            float u0 = (rec.x - padding)/width;
+            float v0 = (rec.y - padding)/height;
+            float u1 = (rec.x - padding + rec.width + 2.0f*padding)/width;
+            float v1 = (rec.y - padding + rec.height + 2.0f*padding)/height;
+
+            rlTexCoord2f(u0, v0);
+            rlVertex2f(x, y);
+
+            rlTexCoord2f(u0, v1);
+            rlVertex2f(x, y + quadHeight);
+
+            rlTexCoord2f(u1, v1);
+            rlVertex2f(x + quadWidth, y + quadHeight);
+
+            rlTexCoord2f(u1, v0);
+            rlVertex2f(x + quadWidth, y);
         }
-    }
 
-    return buffer;
+    rlEnd();
+    rlSetTexture(0);
 }
 
-// Remove text spaces, concat words
-const char *TextRemoveSpaces(const char *text)
+// Load text flow, word-wrapped text buffer
+// NOTE: Text is split in paragraphs (line-breaks) wrapped independently, so updates only reflow
+// the paragraphs they touch; font is referenced (not copied) and must be kept loaded
+TextFlow LoadTextFlow(Font font, const char *text, float fontSize, float spacing, float width, int alignment)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    TextFlow flow = { 0 };
 
-    if (text != NULL)
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    flow.font = font;
+    flow.fontSize = fontSize;
+    flow.spacing = spacing;
+    flow.width = width;
+    flow.alignment = alignment;
+
+    if (!IsFontValid(font)) return flow;
+
+    // Init flow with an empty paragraph
+    flow.data = (rTextFlowData *)RL_CALLOC(1, sizeof(rTextFlowData));
+    flow.data->textCapacity = 1;
+    flow.data->paragraphCount = 1;
+    flow.data->paragraphCapacity = 1;
+    flow.data->paragraphs = (TextFlowParagraph *)RL_CALLOC(1, sizeof(TextFlowParagraph));
+    flow.text = (char *)RL_CALLOC(1, 1);
+
+    WrapTextFlowParagraph(&flow, &flow.data->paragraphs[0], flow.text);
+    flow.lineCount = 1;
+    flow.size.y = fontSize;
+
+    if (text != NULL) UpdateTextFlow(&flow, 0, 0, text);
+
+    return flow;
+}
+
+// Unload text flow
+void UnloadTextFlow(TextFlow flow)
+{
+    if (flow.data != NULL)
     {
-        // Avoid copying the ' ' characters
-        for (int i = 0, j = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++)
-        {
-            if (text[i] != ' ') { buffer[j] = text[i]; j++; }
-        }
+        for (int i = 0; i < flow.data->paragraphCount; i++) RL_FREE(flow.data->paragraphs[i].lines);
+
+        RL_FREE(flow.data->paragraphs);
+        RL_FREE(flow.data);
     }
 
-    return buffer;
+    RL_FREE(flow.text);
 }
 
-// Get text between two strings
-char *GetTextBetween(const char *text, const char *begin, const char *end)
+// Update text flow replacing a bytes range with text
+// NOTE: Only the paragraphs touched by the range are reflowed, cost does not depend on text length
+// (besides the text buffer bytes move), text must not point into the flow text buffer
+void UpdateTextFlow(TextFlow *flow, int position, int removeLength, const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    if ((flow == NULL) || (flow->data == NULL)) return;
 
-    int beginIndex = TextFindIndex(text, begin);
+    rTextFlowData *data = flow->data;
 
-    if (beginIndex > -1)
+    if (position < 0) position = 0;
+    if (position > flow->length) position = flow->length;
+    if (removeLength < 0) removeLength = 0;
+    if (removeLength > (flow->length - position)) removeLength = flow->length - position;
+
+    int insertLength = (text != NULL)? TextLength(text) : 0;
+
+    if ((removeLength == 0) && (insertLength == 0)) return;
+
+    // Get paragraphs range touched by the update
+    int firstStart = 0;
+    int lastStart = 0;
+    int first = FindTextFlowParagraph(flow, position, &firstStart);
+    int last = FindTextFlowParagraph(flow, position + removeLength, &lastStart);
+    int regionLength = lastStart + data->paragraphs[last].length - firstStart + insertLength - removeLength;
+
+    // Update text buffer
+    int length = flow->length + insertLength - removeLength;
+
+    if ((length + 1) > data->textCapacity)
     {
-        int beginLen = TextLength(begin);
-        int endIndex = TextFindIndex(text + beginIndex + beginLen, end);
+        int capacity = 2*data->textCapacity;
+        if (capacity < (length + 1)) capacity = length + 1;
 
-        if (endIndex > -1)
+        char *buffer = (char *)RL_REALLOC(flow->text, capacity);
+
+        if (buffer == NULL)
         {
-            endIndex += (beginIndex + beginLen);
-            int len = (endIndex - beginIndex - beginLen);
-            if (len < (MAX_TEXT_BUFFER_LENGTH - 1)) strncpy(buffer, text + beginIndex + beginLen, len);
-            else strncpy(buffer, text + beginIndex + beginLen, MAX_TEXT_BUFFER_LENGTH - 1);
+            TRACELOG(LOG_WARNING, "TEXT: Failed to allocate text flow buffer");
+            return;
         }
+
+        flow->text = buffer;
+        data->textCapacity = capacity;
     }
 
-    return buffer;
-}
+    memmove(flow->text + position + insertLength, flow->text + position + removeLength, flow->length - position - removeLength + 1);
+    if (insertLength > 0) memcpy(flow->text + position, text, insertLength);
+    flow->length = length;
 
-// Replace text string
-// REQUIRES: strstr(), strncpy()
-// NOTE: Limited text replace functionality, using static string
-char *TextReplace(const char *text, const char *search, const char *replacement)
-{
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    // Get updated region paragraphs count
+    const char *region = flow->text + firstStart;
+    int count = 1;
+    for (int i = 0; i < regionLength; i++) if (region[i] == '\n') count++;
 
-    if ((text != NULL) && (search != NULL) && (search[0] != '\0'))
+    int paragraphCount = data->paragraphCount - (last - first + 1) + count;
+
+    if (paragraphCount > data->paragraphCapacity)
     {
-        if (replacement == NULL) replacement = "";
+        int capacity = 2*data->paragraphCapacity;
+        if (capacity < paragraphCount) capacity = paragraphCount;
 
-        char *insertPoint = NULL;   // Next insert point
-        char *tempPtr = NULL;       // Temp pointer
-        int textLen = 0;            // Text string length
-        int searchLen = 0;          // Search string length of (the string to remove)
-        int replaceLen = 0;         // Replacement length (the string to replace by)
-        int lastReplacePos = 0;     // Distance between next search and end of last replace
-        int count = 0;              // Number of replacements
+        TextFlowParagraph *paragraphs = (TextFlowParagraph *)RL_REALLOC(data->paragraphs, capacity*sizeof(TextFlowParagraph));
 
-        textLen = TextLength(text);
-        searchLen = TextLength(search);
-        replaceLen = TextLength(replacement);
+        if (paragraphs == NULL)
+        {
+            // NOTE: Text buffer is already updated, affected paragraphs are collapsed into one to keep flow consistent
+            TRACELOG(LOG_WARNING, "TEXT: Failed to allocate text flow paragraphs");
+            count = 1;
+            paragraphCount = data->paragraphCount - (last - first);
+        }
+        else
+        {
+            data->paragraphs = paragraphs;
+            data->paragraphCapacity = capacity;
+        }
+    }
 
-        // Count the number of replacements needed
-        insertPoint = (char *)text;
-        for (count = 0; (tempPtr = strstr(insertPoint, search)); count++) insertPoint = tempPtr + searchLen;
+    // Unload touched paragraphs, tracking removed lines and width
+    int removedLines = 0;
+    float removedWidth = 0.0f;
 
-        if ((textLen + count*(replaceLen - searchLen)) < (MAX_TEXT_BUFFER_LENGTH - 1))
-        {
-            // TODO: Allow copying data replaced up to maximum buffer size and stop
+    for (int i = first; i <= last; i++)
+    {
+        removedLines += data->paragraphs[i].lineCount;
+        if (data->paragraphs[i].width > removedWidth) removedWidth = data->paragraphs[i].width;
+        RL_FREE(data->paragraphs[i].lines);
+    }
 
-            tempPtr = buffer; // Point to result start
+    memmove(&data->paragraphs[first + count], &data->paragraphs[last + 1], (data->paragraphCount - last - 1)*sizeof(TextFlowParagraph));
+    data->paragraphCount = paragraphCount;
 
-            // First time through the loop, all the variable are set correctly from here on,
-            //  - 'temp' points to the end of the result string
-            //  - 'insertPoint' points to the next occurrence of replace in text
-            //  - 'text' points to the remainder of text after "end of replace"
-            while (count > 0)
-            {
-                insertPoint = (char *)strstr(text, search);
-                lastReplacePos = (int)(insertPoint - text);
+    // Wrap updated region paragraphs
+    int addedLines = 0;
+    float addedWidth = 0.0f;
 
-                memcpy(tempPtr, text, lastReplacePos);
-                tempPtr += lastReplacePos;
+    for (int i = 0, start = 0; i < count; i++)
+    {
+        int end = start;
+        while ((end < regionLength) && ((region[end] != '\n') || (i == (count - 1)))) end++;
 
-                if (replaceLen > 0)
-                {
-                    memcpy(tempPtr, replacement, replaceLen);
-                    tempPtr += replaceLen;
-                }
+        TextFlowParagraph *paragraph = &data->paragraphs[first + i];
+        paragraph->length = end - start;
+        paragraph->lines = NULL;
 
-                text += (lastReplacePos + searchLen); // Move to next "end of replace"
-                count--;
-            }
+        WrapTextFlowParagraph(flow, paragraph, region + start);
 
-            // Copy remaind text part after replacement to result (pointed by moving temp)
-            // NOTE: Text pointer internal copy has been updated along the process
-            strncpy(tempPtr, text, TextLength(text));
+        addedLines += paragraph->lineCount;
+        if (paragraph->width > addedWidth) addedWidth = paragraph->width;
+
+        start = end + 1;
+    }
+
+    // Update flow size, widest line is only searched again if it was removed
+    flow->lineCount += (addedLines - removedLines);
+
+    if ((removedWidth >= flow->size.x) && (addedWidth < removedWidth))
+    {
+        flow->size.x = 0.0f;
+
+        for (int i = 0; i < data->paragraphCount; i++)
+        {
+            if (data->paragraphs[i].width > flow->size.x) flow->size.x = data->paragraphs[i].width;
         }
-        else TRACELOG(LOG_WARNING, "Text with replacement is longer than internal buffer, use TextReplaceAlloc()");
     }
+    else if (addedWidth > flow->size.x) flow->size.x = addedWidth;
 
-    return buffer;
+    // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+    flow->size.y = flow->fontSize + (flow->lineCount - 1)*(flow->fontSize + textLineSpacing);
 }
 
-// Replace text string
-// REQUIRES: strstr(), strncpy()
-// WARNING: Allocated memory must be manually freed
-char *TextReplaceAlloc(const char *text, const char *search, const char *replacement)
+// Append text at text flow end
+void AppendTextFlow(TextFlow *flow, const char *text)
 {
-    char *result = NULL;
+    if (flow != NULL) UpdateTextFlow(flow, flow->length, 0, text);
+}
 
-    if ((text != NULL) && (search != NULL) && (search[0] != '\0'))
+// Draw text flow lines visible within bounds, scrolled vertically (pixels)
+// NOTE: Lines are not clipped, use BeginScissorMode() if required
+void DrawTextFlow(TextFlow flow, Rectangle bounds, float scroll, Color tint)
+{
+    if ((flow.data == NULL) || (flow.font.texture.id == 0)) return;
+
+    Font font = flow.font;
+    float lineHeight = flow.fontSize + textLineSpacing;
+    float scaleFactor = flow.fontSize/font.baseSize;
+    float alignWidth = (flow.width > 0.0f)? flow.width : flow.size.x;
+    float offsetY = bounds.y - scroll;  // Lines offset Y, first line at scroll position drawn at bounds top
+    bool kerning = HasGlyphKerning(font);
+
+    for (int p = 0, line = 0, start = 0; p < flow.data->paragraphCount; p++)
     {
-        if (replacement == NULL) replacement = "";
+        const TextFlowParagraph *paragraph = &flow.data->paragraphs[p];
 
-        char *insertPoint = NULL;   // Next insert point
-        char *temp = NULL;          // Temp pointer
-        int textLen = 0;            // Text string length
-        int searchLen = 0;          // Search string length of (the string to remove)
-        int replaceLen = 0;         // Replacement length (the string to replace by)
-        int lastReplacePos = 0;     // Distance between next search and end of last replace
-        int count = 0;              // Number of replacements
-
-        textLen = TextLength(text);
-        searchLen = TextLength(search);
-        replaceLen = TextLength(replacement);
-
-        // Count the number of replacements needed
-        insertPoint = (char *)text;
-        for (count = 0; (temp = strstr(insertPoint, search)); count++) insertPoint = temp + searchLen;
-
-        // Allocate returning string and point temp to it
-        int tempLen = textLen + (replaceLen - searchLen)*count + 1;
-        temp = result = (char *)RL_CALLOC(tempLen, sizeof(char));
+        if ((line*lineHeight) >= (scroll + bounds.height)) break;
 
-        if (result != NULL)   // Memory was allocated
+        // Skip paragraphs above visible area
+        if (((line + paragraph->lineCount - 1)*lineHeight + flow.fontSize) > scroll)
         {
-            // First time through the loop, all the variable are set correctly from here on,
-            //  - 'temp' points to the end of the result string
-            //  - 'insertPoint' points to the next occurrence of replace in text
-            //  - 'text' points to the remainder of text after "end of replace"
-            while (count > 0)
+            for (int i = 0; i < paragraph->lineCount; i++)
             {
-                insertPoint = (char *)strstr(text, search);
-                lastReplacePos = (int)(insertPoint - text);
+                float lineY = (line + i)*lineHeight;
 
-                memcpy(temp, text, lastReplacePos);
-                temp += lastReplacePos;
+                if ((lineY + flow.fontSize) <= scroll) continue;
+                if (lineY >= (scroll + bounds.height)) break;
 
-                if (replaceLen > 0)
+                const TextFlowLine *textLine = &paragraph->lines[i];
+                const char *text = flow.text + start + textLine->start;
+
+                float textOffsetX = 0.0f;
+                if (flow.alignment == TEXT_ALIGN_CENTER) textOffsetX = (alignWidth - textLine->width)*0.5f;
+                else if (flow.alignment == TEXT_ALIGN_RIGHT) textOffsetX = alignWidth - textLine->width;
+
+                for (int k = 0, previous = 0; k < textLine->length;)
                 {
-                    memcpy(temp, replacement, replaceLen);
-                    temp += replaceLen;
-                }
+                    int codepointByteCount = 0;
+                    int codepoint = GetCodepointNext(&text[k], &codepointByteCount);
+                    int index = GetGlyphIndex(font, codepoint);
 
-                text += (lastReplacePos + searchLen); // Move to next "end of replace"
+                    if (kerning && (previous != 0)) textOffsetX += GetGlyphKerning(font, previous, codepoint)*scaleFactor;
+                    previous = codepoint;
 
-                count--;
-            }
+                    if ((codepoint != ' ') && (codepoint != '\t'))
+                    {
+                        DrawTextCodepoint(font, codepoint, (Vector2){ bounds.x + textOffsetX, offsetY + lineY }, flow.fontSize, tint);
+                    }
 
-            // Copy remaind text part after replacement to result (pointed by moving temp)
-            // NOTE: Text pointer internal copy has been updated along the process
-            strncpy(temp, text, TextLength(text));
+                    textOffsetX += (GetGlyphAdvance(font, index, scaleFactor) + flow.spacing);
+                    k += codepointByteCount;
+                }
+            }
         }
-    }
 
-    return result;
+        line += paragraph->lineCount;
+        start += (paragraph->length + 1);
+    }
 }
 
-// Replace text between two specific strings
-// REQUIRES: strncpy()
-// NOTE: If (replacement == NULL) removes "begin"[ ]"end" text
-char *TextReplaceBetween(const char *text, const char *begin, const char *end, const char *replacement)
+//----------------------------------------------------------------------------------
+// Text strings management functions
+//----------------------------------------------------------------------------------
+// Load text as separate lines ('\n')
+// NOTE: Returned lines end with null terminator '\0'
+char **LoadTextLines(const char *text, int *count)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    char **lines = NULL;
+    int lineCount = 0;
 
-    if ((text != NULL) && (begin != NULL) && (end != NULL))
+    if (text != NULL)
     {
-        int beginIndex = TextFindIndex(text, begin);
+        int textLength = TextLength(text);
+        lineCount = 1;
 
-        if (beginIndex > -1)
+        // First text scan pass to get required line count
+        for (int i = 0; i < textLength; i++)
         {
-            int beginLen = TextLength(begin);
-            int endIndex = TextFindIndex(text + beginIndex + beginLen, end);
+            if (text[i] == '\n') lineCount++;
+        }
 
-            if (endIndex > -1)
+        lines = (char **)RL_CALLOC(lineCount, sizeof(char *));
+        for (int i = 0, l = 0, lineLen = 0; i <= textLength; i++)
+        {
+            if ((text[i] == '\n') || (text[i] == '\0'))
             {
-                endIndex += (beginIndex + beginLen);
-
-                int textLen = TextLength(text);
-                int replaceLen = (replacement == NULL)? 0 : TextLength(replacement);
-                //int toreplaceLen = endIndex - beginIndex - beginLen;
-
-                strncpy(buffer, text, beginIndex + beginLen); // Copy first text part
-                if (replacement != NULL) strncpy(buffer + beginIndex + beginLen, replacement, replaceLen); // Copy replacement (if provided)
-                strncpy(buffer + beginIndex + beginLen + replaceLen, text + endIndex, textLen - endIndex); // Copy end text part
+                lines[l] = (char *)RL_CALLOC(lineLen + 1, 1);
+                strncpy(lines[l], &text[i - lineLen], lineLen);
+                lineLen = 0;
+                l++;
             }
+            else lineLen++;
         }
     }
 
-    return buffer;
+    *count = lineCount;
+    return lines;
 }
 
-// Replace text between two specific strings
-// REQUIRES: strncpy()
-// NOTE: If (replacement == NULL) remove "begin"[ ]"end" text
-// WARNING: Returned string must be freed by user
-char *TextReplaceBetweenAlloc(const char *text, const char *begin, const char *end, const char *replacement)
+// Unload text lines
+void UnloadTextLines(char **lines, int lineCount)
 {
-    char *result = NULL;
-
-    if ((text != NULL) && (begin != NULL) && (end != NULL))
-    {
-        int beginIndex = TextFindIndex(text, begin);
-
-        if (beginIndex > -1)
-        {
-            int beginLen = TextLength(begin);
-            int endIndex = TextFindIndex(text + beginIndex + beginLen, end);
-
-            if (endIndex > -1)
-            {
-                endIndex += (beginIndex + beginLen);
+    for (int i = 0; i < lineCount; i++) RL_FREE(lines[i]);
+    RL_FREE(lines);
+}
 
-                int textLen = TextLength(text);
-                int replaceLen = (replacement == NULL)? 0 : TextLength(replacement);
-                int toreplaceLen = endIndex - beginIndex - beginLen;
-                result = (char *)RL_CALLOC(textLen + replaceLen - toreplaceLen + 1, sizeof(char));
+// Get text length in bytes, check for \0 character
+// NOTE: Alternative: use strlen(text)
+unsigned int TextLength(const char *text)
+{
+    unsigned int length = 0;
 
-                strncpy(result, text, beginIndex + beginLen); // Copy first text part
-                if (replacement != NULL) strncpy(result + beginIndex + beginLen, replacement, replaceLen); // Copy replacement (if provided)
-                strncpy(result + beginIndex + beginLen + replaceLen, text + endIndex, textLen - endIndex); // Copy end text part
-            }
-        }
-    }
+    // NOTE: Using strlen(), usually vectorized by the C standard library
+    if (text != NULL) length = (unsigned int)strlen(text);
 
-    return result;
+    return length;
 }
 
-// Insert text in a specific position, moves all text forward
-// WARNING: Allocated memory must be manually freed
-char *TextInsert(const char *text, const char *insert, int position)
+// Formatting of text with variables to 'embed'
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+const char *TextFormat(const char *text, ...)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+#ifndef MAX_TEXTFORMAT_BUFFERS
+    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
+#endif
 
-    if ((text != NULL) && (insert != NULL))
-    {
-        int textLen = TextLength(text);
-        int insertLen = TextLength(insert);
+    // Create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
+    static TEXT_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL int index = 0;
 
-        if ((textLen + insertLen) < (MAX_TEXT_BUFFER_LENGTH - 1))
-        {
-            // TODO: Allow copying data inserted up to maximum buffer size and stop
+    // NOTE: Buffer is not cleared, vsnprintf() always adds the '\0' ending
+    char *currentBuffer = buffers[index];
+    currentBuffer[0] = '\0';
 
-            for (int i = 0; i < position; i++) buffer[i] = text[i];
-            for (int i = position; i < insertLen + position; i++) buffer[i] = insert[i - position];
-            for (int i = (insertLen + position); i < (textLen + insertLen); i++) buffer[i] = text[i];
+    if (text != NULL)
+    {
+        va_list args;
+        va_start(args, text);
+        int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+        va_end(args);
 
-            buffer[textLen + insertLen] = '\0'; // Add EOL
+        // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occurred
+        if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
+        {
+            // Inserting "..." at the end of the string to mark as truncated
+            char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
+            snprintf(truncBuffer, 4, "...");
         }
-        else TRACELOG(LOG_WARNING, "Text with inserted string is longer than internal buffer, use TextInserExt()");
+
+        index += 1;     // Move to next buffer for next function call
+        if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
     }
 
-    return buffer;
+    return currentBuffer;
 }
 
-// Insert text in a specific position, moves all text forward
-// WARNING: Allocated memory must be manually freed
-char *TextInsertAlloc(const char *text, const char *insert, int position)
+// Get integer value from text
+// NOTE: This function replaces atoi() [stdlib.h]
+int TextToInteger(const char *text)
 {
-    char *result = NULL;
+    int value = 0;
+    int sign = 1;
 
-    if ((text != NULL) && (insert != NULL))
+    if (text != NULL)
     {
-        int textLen = TextLength(text);
-        int insertLen = TextLength(insert);
-
-        result = (char *)RL_MALLOC(textLen + insertLen + 1);
-
-        for (int i = 0; i < position; i++) result[i] = text[i];
-        for (int i = position; i < insertLen + position; i++) result[i] = insert[i - position];
-        for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
+        if ((text[0] == '+') || (text[0] == '-'))
+        {
+            if (text[0] == '-') sign = -1;
+            text++;
+        }
 
-        result[textLen + insertLen] = '\0'; // Add EOL
+        for (int i = 0; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
     }
 
-    return result;
+    return value*sign;
 }
 
-// Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
-char *TextJoin(char **textList, int count, const char *delimiter)
+// Get float value from text
+// NOTE: This function replaces atof() [stdlib.h]
+// WARNING: Only '.' character is understood as decimal point
+float TextToFloat(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-    char *textPtr = buffer;
-
-    int totalLength = 0;
-    int delimiterLen = TextLength(delimiter);
+    float value = 0.0f;
+    float sign = 1.0f;
 
-    for (int i = 0; i < count; i++)
+    if (text != NULL)
     {
-        int textLength = TextLength(textList[i]);
-
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
+        if ((text[0] == '+') || (text[0] == '-'))
         {
-            memcpy(textPtr, textList[i], textLength);
-            totalLength += textLength;
-            textPtr += textLength;
+            if (text[0] == '-') sign = -1.0f;
+            text++;
+        }
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
+        int i = 0;
+        for (; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10.0f + (float)(text[i] - '0');
+
+        if (text[i++] == '.')
+        {
+            float divisor = 10.0f;
+            for (; ((text[i] >= '0') && (text[i] <= '9')); i++)
             {
-                memcpy(textPtr, delimiter, delimiterLen);
-                totalLength += delimiterLen;
-                textPtr += delimiterLen;
+                value += ((float)(text[i] - '0'))/divisor;
+                divisor = divisor*10.0f;
             }
         }
     }
 
-    return buffer;
+    return value*sign;
 }
 
-// Split string into multiple strings
-// REQUIRES: memset()
-char **TextSplit(const char *text, char delimiter, int *count)
+// Copy one string to another, returns bytes copied
+// NOTE: Alternative implementation to strcpy(dst, src) from C standard library
+int TextCopy(char *dst, const char *src)
 {
-    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
-    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
-    //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
-    //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
-
-    static char *buffers[MAX_TEXTSPLIT_COUNT] = { NULL }; // Pointers to buffer[] text data
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 }; // Text data with '\0' separators
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-
-    buffers[0] = buffer;
-    int counter = 0;
+    int bytes = 0;
 
-    if (text != NULL)
+    if ((src != NULL) && (dst != NULL))
     {
-        counter = 1;
-
-        // Count how many substrings ar found on text and set pointers to every one
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        while (*src != '\0')
         {
-            buffer[i] = text[i];
-            if (buffer[i] == '\0') break;
-            else if (buffer[i] == delimiter)
-            {
-                buffer[i] = '\0';   // Set an end of string at this point
-                buffers[counter] = buffer + i + 1;
-                counter++;
+            *dst = *src;
+            dst++;
+            src++;
 
-                if (counter == MAX_TEXTSPLIT_COUNT) break;
-            }
+            bytes++;
         }
+
+        *dst = '\0';
     }
 
-    *count = counter;
-    return buffers;
+    return bytes;
 }
 
-// Append text at specific position and move cursor
-// WARNING: It's up to the user to make sure appended text does not overflow the buffer!
-void TextAppend(char *text, const char *append, int *position)
+// Check if two text string are equal
+// REQUIRES: strcmp()
+bool TextIsEqual(const char *text1, const char *text2)
 {
-    if ((text != NULL) && (append != NULL))
+    bool result = false;
+
+    if ((text1 != NULL) && (text2 != NULL))
     {
-        TextCopy(text + *position, append);
-        *position += TextLength(append);
+        if (strcmp(text1, text2) == 0) result = true;
     }
+
+    return result;
 }
 
-// Find first text occurrence within a string
-// REQUIRES: strstr()
-int TextFindIndex(const char *text, const char *search)
+// Get a piece of a text string
+const char *TextSubtext(const char *text, int position, int length)
 {
-    int position = -1;
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    buffer[0] = '\0';
 
     if (text != NULL)
     {
-        char *ptr = (char *)strstr(text, search);
+        int textLength = TextLength(text);
 
-        if (ptr != NULL) position = (int)(ptr - text);
+        if (position < textLength)
+        {
+            int maxLength = textLength - position;
+            if (length > maxLength) length = maxLength;
+            if (length >= MAX_TEXT_BUFFER_LENGTH) length = MAX_TEXT_BUFFER_LENGTH - 1;
+
+            // NOTE: Alternative: memcpy(buffer, text + position, length)
+
+            for (int c = 0; c < length; c++) buffer[c] = text[position + c];
+
+            buffer[length] = '\0';
+        }
     }
 
-    return position;
+    return buffer;
 }
 
-// Get upper case version of provided string
-// WARNING: Limited functionality, only basic characters set
-// TODO: Support UTF-8 diacritics to upper-case, check codepoints
-char *TextToUpper(const char *text)
+// Remove text spaces, concat words
+const char *TextRemoveSpaces(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     if (text != NULL)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        // Avoid copying the ' ' characters
+        for (int i = 0, j = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++)
         {
-            if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
-            else buffer[i] = text[i];
+            if (text[i] != ' ') { buffer[j] = text[i]; j++; }
         }
     }
 
     return buffer;
 }
 
-// Get lower case version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToLower(const char *text)
+// Get text between two strings
+char *GetTextBetween(const char *text, const char *begin, const char *end)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
-    if (text != NULL)
+    int beginIndex = TextFindIndex(text, begin);
+
+    if (beginIndex > -1)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        int beginLen = TextLength(begin);
+        int endIndex = TextFindIndex(text + beginIndex + beginLen, end);
+
+        if (endIndex > -1)
         {
-            if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
-            else buffer[i] = text[i];
+            endIndex += (beginIndex + beginLen);
+            int len = (endIndex - beginIndex - beginLen);
+            if (len < (MAX_TEXT_BUFFER_LENGTH - 1)) strncpy(buffer, text + beginIndex + beginLen, len);
+            else strncpy(buffer, text + beginIndex + beginLen, MAX_TEXT_BUFFER_LENGTH - 1);
         }
     }
 
     return buffer;
 }
 
-// Get Pascal case notation version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToPascal(const char *text)
+// Replace text string
+// REQUIRES: strstr(), memcpy()
+// NOTE: Limited text replace functionality, using static string
+char *TextReplace(const char *text, const char *search, const char *replacement)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
-    if (text != NULL)
+    if ((text != NULL) && (search != NULL) && (search[0] != '\0'))
     {
-        // Upper case first character
-        if ((text[0] >= 'a') && (text[0] <= 'z')) buffer[0] = text[0] - 32;
-        else buffer[0] = text[0];
+        if (replacement == NULL) replacement = "";
 
-        // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        char *insertPoint = NULL;   // Next insert point
+        char *tempPtr = NULL;       // Temp pointer
+        int textLen = 0;            // Text string length
+        int searchLen = 0;          // Search string length of (the string to remove)
+        int replaceLen = 0;         // Replacement length (the string to replace by)
+        int lastReplacePos = 0;     // Distance between next search and end of last replace
+        int count = 0;              // Number of replacements
+
+        textLen = TextLength(text);
+        searchLen = TextLength(search);
+        replaceLen = TextLength(replacement);
+
+        // Count the number of replacements needed
+        insertPoint = (char *)text;
+        for (count = 0; (tempPtr = strstr(insertPoint, search)); count++) insertPoint = tempPtr + searchLen;
+
+        if ((textLen + count*(replaceLen - searchLen)) < (MAX_TEXT_BUFFER_LENGTH - 1))
         {
-            if (text[j] != '_') buffer[i] = text[j];
-            else
+            // TODO: Allow copying data replaced up to maximum buffer size and stop
+
+            tempPtr = buffer; // Point to result start
+
+            // First time through the loop, all the variable are set correctly from here on,
+            //  - 'temp' points to the end of the result string
+            //  - 'insertPoint' points to the next occurrence of replace in text
+            //  - 'text' points to the remainder of text after "end of replace"
+            while (count > 0)
             {
-                j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
-                else if ((text[j] >= '0') && (text[j] <= '9')) buffer[i] = text[j];
+                insertPoint = (char *)strstr(text, search);
+                lastReplacePos = (int)(insertPoint - text);
+
+                memcpy(tempPtr, text, lastReplacePos);
+                tempPtr += lastReplacePos;
+
+                if (replaceLen > 0)
+                {
+                    memcpy(tempPtr, replacement, replaceLen);
+                    tempPtr += replaceLen;
+                }
+
+                text += (lastReplacePos + searchLen); // Move to next "end of replace"
+                count--;
             }
+
+            // Copy remaind text part after replacement to result (pointed by moving temp)
+            // NOTE: Text pointer internal copy has been updated along the process
+            memcpy(tempPtr, text, TextLength(text));
         }
+        else TRACELOG(LOG_WARNING, "Text with replacement is longer than internal buffer, use TextReplaceAlloc()");
     }
 
     return buffer;
 }
 
-// Get snake case notation version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToSnake(const char *text)
+// Replace text string
+// REQUIRES: strstr(), memcpy()
+// WARNING: Allocated memory must be manually freed
+char *TextReplaceAlloc(const char *text, const char *search, const char *replacement)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    char *result = NULL;
 
-    if (text != NULL)
+    if ((text != NULL) && (search != NULL) && (search[0] != '\0'))
     {
-        // Check for next separator to upper case another character
-        for (int i = 0, j = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        if (replacement == NULL) replacement = "";
+
+        char *insertPoint = NULL;   // Next insert point
+        char *temp = NULL;          // Temp pointer
+        int textLen = 0;            // Text string length
+        int searchLen = 0;          // Search string length of (the string to remove)
+        int replaceLen = 0;         // Replacement length (the string to replace by)
+        int lastReplacePos = 0;     // Distance between next search and end of last replace
+        int count = 0;              // Number of replacements
+
+        textLen = TextLength(text);
+        searchLen = TextLength(search);
+        replaceLen = TextLength(replacement);
+
+        // Count the number of replacements needed
+        insertPoint = (char *)text;
+        for (count = 0; (temp = strstr(insertPoint, search)); count++) insertPoint = temp + searchLen;
+
+        // Allocate returning string and point temp to it
+        int tempLen = textLen + (replaceLen - searchLen)*count + 1;
+        temp = result = (char *)RL_CALLOC(tempLen, sizeof(char));
+
+        if (result != NULL)   // Memory was allocated
         {
-            if ((text[j] >= 'A') && (text[j] <= 'Z'))
+            // First time through the loop, all the variable are set correctly from here on,
+            //  - 'temp' points to the end of the result string
+            //  - 'insertPoint' points to the next occurrence of replace in text
+            //  - 'text' points to the remainder of text after "end of replace"
+            while (count > 0)
             {
-                if (i >= 1)
+                insertPoint = (char *)strstr(text, search);
+                lastReplacePos = (int)(insertPoint - text);
+
+                memcpy(temp, text, lastReplacePos);
+                temp += lastReplacePos;
+
+                if (replaceLen > 0)
                 {
-                    buffer[i] = '_';
-                    i++;
+                    memcpy(temp, replacement, replaceLen);
+                    temp += replaceLen;
                 }
-                buffer[i] = text[j] + 32;
+
+                text += (lastReplacePos + searchLen); // Move to next "end of replace"
+
+                count--;
             }
-            else buffer[i] = text[j];
+
+            // Copy remaind text part after replacement to result (pointed by moving temp)
+            // NOTE: Text pointer internal copy has been updated along the process
+            memcpy(temp, text, TextLength(text));
         }
     }
 
-    return buffer;
+    return result;
 }
 
-// Get Camel case notation version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToCamel(const char *text)
+// Replace text between two specific strings
+// REQUIRES: memcpy()
+// NOTE: If (replacement == NULL) removes "begin"[ ]"end" text
+char *TextReplaceBetween(const char *text, const char *begin, const char *end, const char *replacement)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
-    if (text != NULL)
+    if ((text != NULL) && (begin != NULL) && (end != NULL))
     {
-        // Lower case first character
-        if ((text[0] >= 'A') && (text[0] <= 'Z')) buffer[0] = text[0] + 32;
-        else buffer[0] = text[0];
+        int beginIndex = TextFindIndex(text, begin);
 
-        // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        if (beginIndex > -1)
         {
-            if (text[j] != '_') buffer[i] = text[j];
-            else
+            int beginLen = TextLength(begin);
+            int endIndex = TextFindIndex(text + beginIndex + beginLen, end);
+
+            if (endIndex > -1)
             {
-                j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                endIndex += (beginIndex + beginLen);
+
+                int textLen = TextLength(text);
+                int replaceLen = (replacement == NULL)? 0 : TextLength(replacement);
+                //int toreplaceLen = endIndex - beginIndex - beginLen;
+
+                memcpy(buffer, text, beginIndex + beginLen); // Copy first text part
+                if (replacement != NULL) memcpy(buffer + beginIndex + beginLen, replacement, replaceLen); // Copy replacement (if provided)
+                memcpy(buffer + beginIndex + beginLen + replaceLen, text + endIndex, textLen - endIndex); // Copy end text part
             }
         }
     }
@@ -2237,757 +2759,2464 @@ char *TextToCamel(const char *text)
     return buffer;
 }
 
-// Encode text codepoint into UTF-8 text
+// Replace text between two specific strings
 // REQUIRES: memcpy()
-// WARNING: Allocated memory must be manually freed
-char *LoadUTF8(const int *codepoints, int length)
+// NOTE: If (replacement == NULL) remove "begin"[ ]"end" text
+// WARNING: Returned string must be freed by user
+char *TextReplaceBetweenAlloc(const char *text, const char *begin, const char *end, const char *replacement)
 {
-    char *text = NULL;
+    char *result = NULL;
 
-    if ((codepoints != NULL) && (length > 0))
+    if ((text != NULL) && (begin != NULL) && (end != NULL))
     {
-        // Allocate enough memory to fit all possible codepoints
-        // NOTE: 5 bytes for every codepoint should be enough
-        text = (char *)RL_CALLOC(length*5, 1);
-        const char *utf8 = NULL;
-        int size = 0;
+        int beginIndex = TextFindIndex(text, begin);
 
-        for (int i = 0, bytes = 0; i < length; i++)
+        if (beginIndex > -1)
         {
-            utf8 = CodepointToUTF8(codepoints[i], &bytes);
-            memcpy(text + size, utf8, bytes);
-            size += bytes;
-        }
+            int beginLen = TextLength(begin);
+            int endIndex = TextFindIndex(text + beginIndex + beginLen, end);
 
-        // Create second buffer and copy data manually to it
-        char *temp = (char *)RL_CALLOC(size + 1, 1);
-        memcpy(temp, text, size);
-        RL_FREE(text);
-        text = temp;
+            if (endIndex > -1)
+            {
+                endIndex += (beginIndex + beginLen);
+
+                int textLen = TextLength(text);
+                int replaceLen = (replacement == NULL)? 0 : TextLength(replacement);
+                int toreplaceLen = endIndex - beginIndex - beginLen;
+                result = (char *)RL_CALLOC(textLen + replaceLen - toreplaceLen + 1, sizeof(char));
+
+                memcpy(result, text, beginIndex + beginLen); // Copy first text part
+                if (replacement != NULL) memcpy(result + beginIndex + beginLen, replacement, replaceLen); // Copy replacement (if provided)
+                memcpy(result + beginIndex + beginLen + replaceLen, text + endIndex, textLen - endIndex); // Copy end text part
+            }
+        }
     }
 
-    return text;
+    return result;
 }
 
-// Unload UTF-8 text encoded from codepoints array
-void UnloadUTF8(char *text)
+// Insert text in a specific position, moves all text forward
+// WARNING: Allocated memory must be manually freed
+char *TextInsert(const char *text, const char *insert, int position)
 {
-    RL_FREE(text);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    if ((text != NULL) && (insert != NULL))
+    {
+        int textLen = TextLength(text);
+        int insertLen = TextLength(insert);
+
+        if ((textLen + insertLen) < (MAX_TEXT_BUFFER_LENGTH - 1))
+        {
+            // TODO: Allow copying data inserted up to maximum buffer size and stop
+
+            for (int i = 0; i < position; i++) buffer[i] = text[i];
+            for (int i = position; i < insertLen + position; i++) buffer[i] = insert[i - position];
+            for (int i = (insertLen + position); i < (textLen + insertLen); i++) buffer[i] = text[i];
+
+            buffer[textLen + insertLen] = '\0'; // Add EOL
+        }
+        else TRACELOG(LOG_WARNING, "Text with inserted string is longer than internal buffer, use TextInserExt()");
+    }
+
+    return buffer;
 }
 
-// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
-int *LoadCodepoints(const char *text, int *count)
+// Insert text in a specific position, moves all text forward
+// WARNING: Allocated memory must be manually freed
+char *TextInsertAlloc(const char *text, const char *insert, int position)
 {
-    int *codepoints = NULL;
-    int codepointCount = 0;
+    char *result = NULL;
 
-    if (text != NULL)
+    if ((text != NULL) && (insert != NULL))
     {
-        int textLength = TextLength(text);
+        int textLen = TextLength(text);
+        int insertLen = TextLength(insert);
 
-        // Allocate a big enough buffer to store as many codepoints as text bytes
-        codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+        result = (char *)RL_MALLOC(textLen + insertLen + 1);
 
-        int codepointSize = 0;
-        for (int i = 0; i < textLength; codepointCount++)
-        {
-            codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
-            i += codepointSize;
-        }
+        for (int i = 0; i < position; i++) result[i] = text[i];
+        for (int i = position; i < insertLen + position; i++) result[i] = insert[i - position];
+        for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
 
-        // Create second buffer and copy data manually to it
-        int *temp = (int *)RL_CALLOC(codepointCount, sizeof(int));
-        for (int i = 0; i < codepointCount; i++) temp[i] = codepoints[i];
-        RL_FREE(codepoints);
-        codepoints = temp;
+        result[textLen + insertLen] = '\0'; // Add EOL
     }
 
-    *count = codepointCount;
-    return codepoints;
+    return result;
 }
 
-// Unload codepoints data from memory
-void UnloadCodepoints(int *codepoints)
+// Join text strings with delimiter
+// REQUIRES: memset(), memcpy()
+char *TextJoin(char **textList, int count, const char *delimiter)
 {
-    RL_FREE(codepoints);
-}
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    char *textPtr = buffer;
 
-// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
-// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
-int GetCodepointCount(const char *text)
-{
-    unsigned int length = 0;
-    const char *ptr = text;
+    int totalLength = 0;
+    int delimiterLen = TextLength(delimiter);
 
-    if (ptr != NULL)
+    for (int i = 0; i < count; i++)
     {
-        while (*ptr != '\0')
+        int textLength = TextLength(textList[i]);
+
+        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
+        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
         {
-            int next = 0;
-            GetCodepointNext(ptr, &next);
-            ptr += next;
-            length++;
+            memcpy(textPtr, textList[i], textLength);
+            totalLength += textLength;
+            textPtr += textLength;
+
+            if ((delimiterLen > 0) && (i < (count - 1)))
+            {
+                memcpy(textPtr, delimiter, delimiterLen);
+                totalLength += delimiterLen;
+                textPtr += delimiterLen;
+            }
         }
     }
 
-    return length;
+    return buffer;
 }
 
-// Encode codepoint into utf8 text (char array length returned as parameter)
-// NOTE: It uses a static array to store UTF-8 bytes
-const char *CodepointToUTF8(int codepoint, int *utf8Size)
+// Split string into multiple strings
+// REQUIRES: memset()
+char **TextSplit(const char *text, char delimiter, int *count)
 {
-    static char utf8[6] = { 0 };
-    memset(utf8, 0, 6); // Clear static array
-    int size = 0;       // Byte size of codepoint
+    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
+    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
+    // all used memory is static... it has some limitations:
+    //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
+    //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
 
-    if (codepoint <= 0x7f)
-    {
-        utf8[0] = (char)codepoint;
-        size = 1;
-    }
-    else if (codepoint <= 0x7ff)
-    {
-        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
-        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
-        size = 2;
-    }
-    else if (codepoint <= 0xffff)
-    {
-        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
-        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
-        size = 3;
-    }
-    else if (codepoint <= 0x10ffff)
+    static TEXT_THREAD_LOCAL char *buffers[MAX_TEXTSPLIT_COUNT] = { NULL }; // Pointers to buffer[] text data
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 }; // Text data with '\0' separators
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    buffers[0] = buffer;
+    int counter = 0;
+
+    if (text != NULL)
     {
-        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
-        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
-        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
-        size = 4;
-    }
+        counter = 1;
 
-    *utf8Size = size;
+        // Count how many substrings ar found on text and set pointers to every one
+        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        {
+            buffer[i] = text[i];
+            if (buffer[i] == '\0') break;
+            else if (buffer[i] == delimiter)
+            {
+                buffer[i] = '\0';   // Set an end of string at this point
+                buffers[counter] = buffer + i + 1;
+                counter++;
 
-    return utf8;
+                if (counter == MAX_TEXTSPLIT_COUNT) break;
+            }
+        }
+    }
+
+    *count = counter;
+    return buffers;
 }
 
-// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
-// When an invalid UTF-8 byte is encountered, exit as soon as possible and a '?'(0x3f) codepoint is returned
-// Total number of bytes processed are returned as a parameter
-// NOTE: The standard says U+FFFD should be returned in case of errors
-// but that character is not supported by the default font in raylib
-int GetCodepoint(const char *text, int *codepointSize)
+// Append text at specific position and move cursor
+// WARNING: It's up to the user to make sure appended text does not overflow the buffer!
+void TextAppend(char *text, const char *append, int *position)
 {
-/*
-    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
-
-    Char. number range  |        UTF-8 octet sequence
-      (hexadecimal)    |              (binary)
-    --------------------+---------------------------------------------
-    0000 0000-0000 007F | 0xxxxxxx
-    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
-    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
-    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-*/
-
-    int codepoint = 0x3f;   // Codepoint (defaults to '?')
-    *codepointSize = 1;
-    if (text == NULL) return codepoint;
+    if ((text != NULL) && (append != NULL))
+    {
+        TextCopy(text + *position, append);
+        *position += TextLength(append);
+    }
+}
 
-    // NOTE: On decoding errors, return as soon as possible
-    int octet = (unsigned char)(text[0]); // The first UTF8 octet
+// Find first text occurrence within a string
+// REQUIRES: strstr()
+int TextFindIndex(const char *text, const char *search)
+{
+    int position = -1;
 
-    if (octet <= 0x7f)
+    if (text != NULL)
     {
-        // Only one octet (ASCII range x00-7F)
-        codepoint = text[0];
+        char *ptr = (char *)strstr(text, search);
+
+        if (ptr != NULL) position = (int)(ptr - text);
     }
-    else if ((octet & 0xe0) == 0xc0)
-    {
-        // Two octets
 
-        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
-        unsigned char octet1 = text[1];
+    return position;
+}
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+// Get upper case version of provided string
+// WARNING: Limited functionality, only basic characters set
+// TODO: Support UTF-8 diacritics to upper-case, check codepoints
+char *TextToUpper(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    int i = 0;
 
-        if ((octet >= 0xc2) && (octet <= 0xdf))
+    if (text != NULL)
+    {
+        for (; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
         {
-            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
-            *codepointSize = 2;
+            if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
+            else buffer[i] = text[i];
         }
     }
-    else if ((octet & 0xf0) == 0xe0)
-    {
-        // Three octets
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
-
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
 
-        octet2 = text[2];
+    buffer[i] = '\0';
 
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
-
-        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
-        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
-        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
-        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+    return buffer;
+}
 
-        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
-            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+// Get lower case version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToLower(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    int i = 0;
 
-        if ((octet >= 0xe0) && (octet <= 0xef))
+    if (text != NULL)
+    {
+        for (; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
         {
-            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
-            *codepointSize = 3;
+            if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
+            else buffer[i] = text[i];
         }
     }
-    else if ((octet & 0xf8) == 0xf0)
-    {
-        // Four octets
-        if (octet > 0xf4) return codepoint;
-
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
-        unsigned char octet3 = '\0';
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
+    buffer[i] = '\0';
 
-        octet2 = text[2];
+    return buffer;
+}
 
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
+// Get Pascal case notation version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToPascal(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
-        octet3 = text[3];
+    if (text != NULL)
+    {
+        // Upper case first character
+        if ((text[0] >= 'a') && (text[0] <= 'z')) buffer[0] = text[0] - 32;
+        else buffer[0] = text[0];
 
-        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+        // Check for next separator to upper case another character
+        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        {
+            if (text[j] != '_') buffer[i] = text[j];
+            else
+            {
+                j++;
+                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                else if ((text[j] >= '0') && (text[j] <= '9')) buffer[i] = text[j];
+            }
+        }
+    }
 
-        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+    return buffer;
+}
 
-        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
-            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+// Get snake case notation version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToSnake(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
-        if (octet >= 0xf0)
+    if (text != NULL)
+    {
+        // Check for next separator to upper case another character
+        for (int i = 0, j = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
         {
-            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
-            *codepointSize = 4;
+            if ((text[j] >= 'A') && (text[j] <= 'Z'))
+            {
+                if (i >= 1)
+                {
+                    buffer[i] = '_';
+                    i++;
+                }
+                buffer[i] = text[j] + 32;
+            }
+            else buffer[i] = text[j];
         }
     }
 
-    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
-
-    return codepoint;
+    return buffer;
 }
 
-// Get next codepoint in a byte sequence and bytes processed
-int GetCodepointNext(const char *text, int *codepointSize)
+// Get Camel case notation version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToCamel(const char *text)
 {
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    *codepointSize = 1;
-    if (text == NULL) return codepoint;
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
-    // Get current codepoint and bytes processed
-    if (0xf0 == (0xf8 & ptr[0]))
-    {
-        // 4 byte UTF-8 codepoint
-        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80) || ((ptr[3] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
-        *codepointSize = 4;
-    }
-    else if (0xe0 == (0xf0 & ptr[0]))
-    {
-        // 3 byte UTF-8 codepoint */
-        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
-        *codepointSize = 3;
-    }
-    else if (0xc0 == (0xe0 & ptr[0]))
-    {
-        // 2 byte UTF-8 codepoint
-        if ((ptr[1] & 0xC0) ^ 0x80) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
-        *codepointSize = 2;
-    }
-    else if (0x00 == (0x80 & ptr[0]))
+    if (text != NULL)
     {
-        // 1 byte UTF-8 codepoint
-        codepoint = ptr[0];
-        *codepointSize = 1;
+        // Lower case first character
+        if ((text[0] >= 'A') && (text[0] <= 'Z')) buffer[0] = text[0] + 32;
+        else buffer[0] = text[0];
+
+        // Check for next separator to upper case another character
+        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        {
+            if (text[j] != '_') buffer[i] = text[j];
+            else
+            {
+                j++;
+                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+            }
+        }
     }
 
-    return codepoint;
+    return buffer;
 }
 
-// Get previous codepoint in a byte sequence and bytes processed
-int GetCodepointPrevious(const char *text, int *codepointSize)
+// Load text arena, memory buffer for allocation-free text functions
+// NOTE: A caller-provided buffer can also be used: (TextArena){ buffer, sizeof(buffer), 0 }
+TextArena LoadTextArena(int capacity)
 {
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    *codepointSize = 1;
-    if (text == NULL) return codepoint;
-
-    // Move to previous codepoint
-    do ptr--;
-    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+    TextArena arena = { 0 };
 
-    int cpSize = 0;
-    codepoint = GetCodepointNext(ptr, &cpSize);
-    if (codepoint != 0) *codepointSize = cpSize;
+    if (capacity > 0)
+    {
+        arena.data = (char *)RL_MALLOC(capacity);
+        if (arena.data != NULL) arena.capacity = capacity;
+    }
 
-    return codepoint;
+    return arena;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-#if SUPPORT_FILEFORMAT_FNT || SUPPORT_FILEFORMAT_BDF
-// Read a line from memory
-// REQUIRES: memcpy()
-// NOTE: Returns the number of bytes read
-static int GetLine(const char *origin, char *buffer, int maxLength)
+// Unload text arena (only arenas loaded with LoadTextArena())
+void UnloadTextArena(TextArena arena)
 {
-    int count = 0;
-    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
-    memcpy(buffer, origin, count);
-    buffer[count] = '\0';
-    return count;
+    RL_FREE(arena.data);
 }
-#endif
 
-#if SUPPORT_FILEFORMAT_FNT
-// Load a BMFont file (AngelCode font file)
-// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
-static Font LoadBMFont(const char *fileName)
+// Reset text arena, strings previously returned are not valid anymore
+void ResetTextArena(TextArena *arena)
 {
-    #define MAX_BUFFER_SIZE       256
-    #define MAX_FONT_IMAGE_PAGES    8
+    if (arena != NULL) arena->offset = 0;
+}
 
-    Font font = { 0 };
+// Text formatting with variables into text arena (sprintf() style)
+// NOTE: Text is formatted directly in arena free space (no intermediate buffer or clearing),
+// returns NULL if arena has not enough space
+const char *TextFormatArena(TextArena *arena, int *resultLength, const char *text, ...)
+{
+    char *result = NULL;
+    int length = 0;
 
-    char buffer[MAX_BUFFER_SIZE] = { 0 };
-    char *searchPoint = NULL;
+    if ((arena != NULL) && (arena->data != NULL) && (text != NULL))
+    {
+        int available = arena->capacity - arena->offset;
 
-    int fontSize = 0;
-    int glyphCount = 0;
+        va_list args;
+        va_start(args, text);
+        int requiredByteCount = vsnprintf(arena->data + arena->offset, available, text, args);
+        va_end(args);
 
-    int imWidth = 0;
-    int imHeight = 0;
-    int pageCount = 1;
-    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+        if ((requiredByteCount >= 0) && (requiredByteCount < available))
+        {
+            result = arena->data + arena->offset;
+            arena->offset += (requiredByteCount + 1);
+            length = requiredByteCount;
+        }
+        else TRACELOG(LOG_WARNING, "TEXT: Text arena has not enough space for formatted text");
+    }
 
-    int base = 0;       // Useless data
-    int readBytes = 0;  // Data bytes read
-    int readVars = 0;   // Variables filled by sscanf()
+    if (resultLength != NULL) *resultLength = length;
 
-    char *fileText = LoadFileText(fileName);
+    return result;
+}
 
-    if (fileText == NULL) return font;
+// Get a piece of a text string into text arena
+const char *TextSubtextArena(TextArena *arena, const char *text, int position, int length, int *resultLength)
+{
+    char *result = NULL;
 
-    char *fileTextPtr = fileText;
+    if (text == NULL) text = "";
 
-    // NOTE: Skip first line, it contains no useful information
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    fileTextPtr += (readBytes + 1);
+    int textLength = TextLength(text);
 
-    // Read line data
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "lineHeight");
-    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
-    fileTextPtr += (readBytes + 1);
+    if (position < 0) position = 0;
+    if (position > textLength) position = textLength;
+    if (length > (textLength - position)) length = textLength - position;
+    if (length < 0) length = 0;
 
-    if (readVars < 4) { UnloadFileText(fileText); return font; } // Some data not available, file malformed
+    result = AllocTextArena(arena, length + 1);
 
-    if (pageCount > MAX_FONT_IMAGE_PAGES)
+    if (result != NULL)
     {
-        TRACELOG(LOG_WARNING, "FONT: [%s] Font defines more pages than supported: %i/%i", fileName, pageCount, MAX_FONT_IMAGE_PAGES);
-        pageCount = MAX_FONT_IMAGE_PAGES;
+        memcpy(result, text + position, length);
+        result[length] = '\0';
     }
+    else length = 0;
 
-    for (int i = 0; i < pageCount; i++)
-    {
-        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-        searchPoint = strstr(buffer, "file");
-        readVars = sscanf(searchPoint, "file=\"%128[^\"]\"", imFileName[i]);
-        fileTextPtr += (readBytes + 1);
+    if (resultLength != NULL) *resultLength = length;
 
-        if (readVars < 1) { UnloadFileText(fileText); return font; } // No fileName read
-    }
+    return result;
+}
 
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "count");
-    readVars = sscanf(searchPoint, "count=%i", &glyphCount);
-    fileTextPtr += (readBytes + 1);
+// Replace text string with new string into text arena
+const char *TextReplaceArena(TextArena *arena, const char *text, const char *search, const char *replacement, int *resultLength)
+{
+    char *result = NULL;
+    int length = 0;
 
-    if (readVars < 1) { UnloadFileText(fileText); return font; } // No glyphCount read
+    if (text != NULL)
+    {
+        if (replacement == NULL) replacement = "";
 
-    // Load all required images for further compose
-    Image *imFonts = (Image *)RL_CALLOC(pageCount, sizeof(Image)); // Font atlases, multiple images
+        int textLen = TextLength(text);
+        int searchLen = TextLength(search);
+        int replaceLen = TextLength(replacement);
+        int count = 0;
 
-    for (int i = 0; i < pageCount; i++)
-    {
-        imFonts[i] = LoadImage(TextFormat("%s/%s", GetDirectoryPath(fileName), imFileName[i]));
+        // Count the number of replacements needed
+        if (searchLen > 0)
+        {
+            for (const char *ptr = strstr(text, search); ptr != NULL; ptr = strstr(ptr + searchLen, search)) count++;
+        }
 
-        if (imFonts[i].format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+        length = textLen + count*(replaceLen - searchLen);
+        result = AllocTextArena(arena, length + 1);
+
+        if (result != NULL)
         {
-            // Convert image to GRAYSCALE + ALPHA, using the mask as the alpha channel
-            Image imFontAlpha = {
-                .data = RL_CALLOC(imFonts[i].width*imFonts[i].height, 2),
-                .width = imFonts[i].width,
-                .height = imFonts[i].height,
-                .mipmaps = 1,
-                .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
-            };
+            char *dst = result;
 
-            for (int p = 0, pi = 0; p < (imFonts[i].width*imFonts[i].height*2); p += 2, pi++)
+            for (int i = 0; i < count; i++)
             {
-                ((unsigned char *)(imFontAlpha.data))[p] = 0xff;
-                ((unsigned char *)(imFontAlpha.data))[p + 1] = ((unsigned char *)imFonts[i].data)[pi];
+                const char *ptr = strstr(text, search);
+                int segmentLen = (int)(ptr - text);
+
+                memcpy(dst, text, segmentLen);
+                dst += segmentLen;
+                memcpy(dst, replacement, replaceLen);
+                dst += replaceLen;
+
+                text = ptr + searchLen;
             }
 
-            UnloadImage(imFonts[i]);
-            imFonts[i] = imFontAlpha;
+            // Copy remaining text after last replacement
+            memcpy(dst, text, (int)(result + length - dst));
+            result[length] = '\0';
         }
+        else length = 0;
     }
 
-    Image fullFont = imFonts[0];
-    for (int i = 1; i < pageCount; i++) UnloadImage(imFonts[i]);
+    if (resultLength != NULL) *resultLength = length;
 
-    // If multiple atlas, then merge atlas
-    // NOTE: WARNING: This process could be really slow!
-    if (pageCount > 1)
-    {
-        // Resize font atlas to draw additional images
-        ImageResizeCanvas(&fullFont, imWidth, imHeight*pageCount, 0, 0, BLACK);
+    return result;
+}
 
-        for (int i = 1; i < pageCount; i++)
-        {
-            Rectangle srcRec = { 0.0f, 0.0f, (float)imWidth, (float)imHeight };
-            Rectangle destRec = { 0.0f, (float)imHeight*(float)i, (float)imWidth, (float)imHeight };
-            ImageDraw(&fullFont, imFonts[i], srcRec, destRec, WHITE);
-        }
-    }
+// Insert text in a defined byte position into text arena
+const char *TextInsertArena(TextArena *arena, const char *text, const char *insert, int position, int *resultLength)
+{
+    char *result = NULL;
 
-    RL_FREE(imFonts);
+    if (text == NULL) text = "";
+    if (insert == NULL) insert = "";
 
-    font.texture = LoadTextureFromImage(fullFont);
+    int textLen = TextLength(text);
+    int insertLen = TextLength(insert);
+    int length = textLen + insertLen;
 
-    // Fill font characters info data
-    font.baseSize = fontSize;
-    font.glyphCount = glyphCount;
-    font.glyphPadding = 0;
-    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
-    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+    if (position < 0) position = 0;
+    if (position > textLen) position = textLen;
 
-    int charId = 0;
-    int charX = 0;
-    int charY = 0;
-    int charWidth = 0;
-    int charHeight = 0;
-    int charOffsetX = 0;
-    int charOffsetY = 0;
-    int charAdvanceX = 0;
-    int pageID = 0;
+    result = AllocTextArena(arena, length + 1);
 
-    for (int i = 0; i < glyphCount; i++)
+    if (result != NULL)
     {
-        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-        readVars = sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i page=%i",
-                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX, &pageID);
-        fileTextPtr += (readBytes + 1);
+        memcpy(result, text, position);
+        memcpy(result + position, insert, insertLen);
+        memcpy(result + position + insertLen, text + position, textLen - position);
+        result[length] = '\0';
+    }
+    else length = 0;
 
-        if (readVars == 9)  // Make sure all char data has been properly read
-        {
-            // Get character rectangle in the font atlas texture
-            font.recs[i] = (Rectangle){ (float)charX, (float)charY + (float)imHeight*pageID, (float)charWidth, (float)charHeight };
+    if (resultLength != NULL) *resultLength = length;
 
-            // Save data properly in sprite font
-            font.glyphs[i].value = charId;
-            font.glyphs[i].offsetX = charOffsetX;
-            font.glyphs[i].offsetY = charOffsetY;
-            font.glyphs[i].advanceX = charAdvanceX;
+    return result;
+}
 
-            // Fill character image data from full font data
-            font.glyphs[i].image = ImageFromImage(fullFont, font.recs[i]);
-        }
-        else
-        {
-            font.glyphs[i].image = GenImageColor((int)font.recs[i].width, (int)font.recs[i].height, BLACK);
-            TRACELOG(LOG_WARNING, "FONT: [%s] Some characters data not correctly provided", fileName);
-        }
-    }
+// Join text strings with delimiter into text arena
+const char *TextJoinArena(TextArena *arena, char **textList, int count, const char *delimiter, int *resultLength)
+{
+    char *result = NULL;
+    int delimiterLen = TextLength(delimiter);
+    int length = 0;
 
-    UnloadImage(fullFont);
-    UnloadFileText(fileText);
+    for (int i = 0; i < count; i++) length += TextLength(textList[i]);
+    if (count > 1) length += (count - 1)*delimiterLen;
 
-    if (font.texture.id == 0)
+    result = AllocTextArena(arena, length + 1);
+
+    if (result != NULL)
     {
-        UnloadFont(font);
-        font = GetFontDefault();
-        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
+        char *dst = result;
+
+        for (int i = 0; i < count; i++)
+        {
+            int textLength = TextLength(textList[i]);
+            memcpy(dst, textList[i], textLength);
+            dst += textLength;
+
+            if ((delimiterLen > 0) && (i < (count - 1)))
+            {
+                memcpy(dst, delimiter, delimiterLen);
+                dst += delimiterLen;
+            }
+        }
+
+        result[length] = '\0';
     }
-    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    else length = 0;
 
-    return font;
-}
-#endif
+    if (resultLength != NULL) *resultLength = length;
 
-#if SUPPORT_FILEFORMAT_BDF
-// Convert hexadecimal to decimal (single digit)
-static unsigned char HexToInt(char hex)
-{
-    if ((hex >= '0') && (hex <= '9')) return hex - '0';
-    else if ((hex >= 'a') && (hex <= 'f')) return hex - 'a' + 10;
-    else if ((hex >= 'A') && (hex <= 'F')) return hex - 'A' + 10;
-    else return 0;
+    return result;
 }
 
-// Load font data for further use
-// NOTE: Requires BDF font memory data
-static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, const int *codepoints, int codepointCount, int *outFontSize)
+// Split text into multiple strings into text arena, strings count returned by parameter
+// NOTE: Strings pointers and text copy with '\0' separators are both stored in arena, no strings count limit
+char **TextSplitArena(TextArena *arena, const char *text, char delimiter, int *count)
 {
-    #define MAX_BUFFER_SIZE 256
+    char **result = NULL;
+    int counter = 0;
 
-    char buffer[MAX_BUFFER_SIZE] = { 0 };
+    if (text != NULL)
+    {
+        int textLength = TextLength(text);
 
-    GlyphInfo *glyphs = NULL;
-    bool internalCodepoints = false;
+        counter = 1;
+        for (int i = 0; i < textLength; i++) if (text[i] == delimiter) counter++;
 
-    int totalReadBytes = 0;         // Data bytes read (total)
-    int readBytes = 0;              // Data bytes read (line)
-    int readVars = 0;               // Variables filled by sscanf()
+        // Strings pointers array requires pointer alignment
+        int padding = (arena != NULL)? (int)((sizeof(char *) - ((size_t)(arena->data + arena->offset) % sizeof(char *))) % sizeof(char *)) : 0;
+        char *buffer = AllocTextArena(arena, padding + counter*(int)sizeof(char *) + textLength + 1);
 
-    const char *fileText = (const char *)fileData;
-    const char *fileTextPtr = fileText;
+        if (buffer != NULL)
+        {
+            result = (char **)(buffer + padding);
+            char *strings = buffer + padding + counter*sizeof(char *);
 
-    bool fontMalformed = false;     // Is the font malformed
-    bool fontStarted = false;       // Has font started (STARTFONT)
-    int fontBBw = 0;                // Font base character bounding box width
-    int fontBBh = 0;                // Font base character bounding box height
-    int fontBBxoff0 = 0;            // Font base character bounding box X0 offset
-    int fontBByoff0 = 0;            // Font base character bounding box Y0 offset
-    int fontAscent = 0;             // Font ascent
+            memcpy(strings, text, textLength + 1);
+            result[0] = strings;
 
-    bool charStarted = false;       // Has character started (STARTCHAR)
-    bool charBitmapStarted = false; // Has bitmap data started (BITMAP)
-    int charBitmapNextRow = 0;      // Y position for the next row of bitmap data
-    int charEncoding = -1;          // The unicode value of the character (-1 if not set)
-    int charBBw = 0;                // Character bounding box width
-    int charBBh = 0;                // Character bounding box height
-    int charBBxoff0 = 0;            // Character bounding box X0 offset
-    int charBByoff0 = 0;            // Character bounding box Y0 offset
-    int charDWidthX = 0;            // Character advance X
-    int charDWidthY = 0;            // Character advance Y (unused)
+            for (int i = 0, k = 1; i < textLength; i++)
+            {
+                if (strings[i] == delimiter)
+                {
+                    strings[i] = '\0';      // Set an end of string at this point
+                    result[k] = strings + i + 1;
+                    k++;
+                }
+            }
+        }
+        else counter = 0;
+    }
 
-    int *requiredCodepoints = (int *)RL_MALLOC(codepointCount*sizeof(int));
+    if (count != NULL) *count = counter;
 
-    if (fileData == NULL) return glyphs;
+    return result;
+}
 
-    // In case no chars count provided, default to 95
-    codepointCount = (codepointCount > 0)? codepointCount : 95;
+// Get upper case version of provided string into text arena
+const char *TextToUpperArena(TextArena *arena, const char *text, int *resultLength)
+{
+    if (text == NULL) text = "";
 
-    if (codepoints == NULL)
+    int length = TextLength(text);
+    char *result = AllocTextArena(arena, length + 1);
+
+    if (result != NULL)
     {
-        // Fill internal codepoints array in case not provided externally
-        // NOTE: By default, filling glyph count consecutively, starting at 32 (Space)
-        for (int i = 0; i < codepointCount; i++) requiredCodepoints[i] = i + 32;
-        internalCodepoints = true;
+        for (int i = 0; i < length; i++) result[i] = ((text[i] >= 'a') && (text[i] <= 'z'))? (text[i] - 32) : text[i];
+        result[length] = '\0';
     }
-    else
+    else length = 0;
+
+    if (resultLength != NULL) *resultLength = length;
+
+    return result;
+}
+
+// Get lower case version of provided string into text arena
+const char *TextToLowerArena(TextArena *arena, const char *text, int *resultLength)
+{
+    if (text == NULL) text = "";
+
+    int length = TextLength(text);
+    char *result = AllocTextArena(arena, length + 1);
+
+    if (result != NULL)
     {
-        for (int i = 0; i < codepointCount; i++) requiredCodepoints[i] = codepoints[i];
+        for (int i = 0; i < length; i++) result[i] = ((text[i] >= 'A') && (text[i] <= 'Z'))? (text[i] + 32) : text[i];
+        result[length] = '\0';
     }
+    else length = 0;
 
-    glyphs = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
+    if (resultLength != NULL) *resultLength = length;
 
-    while (totalReadBytes <= dataSize)
-    {
-        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-        totalReadBytes += (readBytes + 1);
-        fileTextPtr += (readBytes + 1);
+    return result;
+}
 
-        // Line: COMMENT
-        if (strstr(buffer, "COMMENT") != NULL) continue; // Ignore line
+// Encode text codepoint into UTF-8 text
+// REQUIRES: memcpy()
+// WARNING: Allocated memory must be manually freed
+char *LoadUTF8(const int *codepoints, int length)
+{
+    char *text = NULL;
 
-        if (charStarted)
+    if ((codepoints != NULL) && (length > 0))
+    {
+        // Allocate enough memory to fit all possible codepoints
+        // NOTE: 5 bytes for every codepoint should be enough
+        text = (char *)RL_CALLOC(length*5, 1);
+        const char *utf8 = NULL;
+        int size = 0;
+
+        for (int i = 0, bytes = 0; i < length; i++)
         {
-            // Line: ENDCHAR
-            if (strstr(buffer, "ENDCHAR") != NULL)
-            {
-                charStarted = false;
-                continue;
-            }
+            utf8 = CodepointToUTF8(codepoints[i], &bytes);
+            memcpy(text + size, utf8, bytes);
+            size += bytes;
+        }
 
-            if (charBitmapStarted)
-            {
-                if (glyphs != NULL)
-                {
-                    int pixelY = charBitmapNextRow++;
+        // Create second buffer and copy data manually to it
+        char *temp = (char *)RL_CALLOC(size + 1, 1);
+        memcpy(temp, text, size);
+        RL_FREE(text);
+        text = temp;
+    }
 
-                    if (pixelY >= glyphs->image.height) break;
+    return text;
+}
 
-                    for (int x = 0; x < readBytes; x++)
-                    {
-                        unsigned char byte = HexToInt(buffer[x]);
+// Unload UTF-8 text encoded from codepoints array
+void UnloadUTF8(char *text)
+{
+    RL_FREE(text);
+}
 
-                        for (int bitX = 0; bitX < 4; bitX++)
-                        {
-                            int pixelX = ((x*4) + bitX);
+// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
+int *LoadCodepoints(const char *text, int *count)
+{
+    int *codepoints = NULL;
+    int codepointCount = 0;
 
-                            if (pixelX >= glyphs->image.width) break;
+    if (text != NULL)
+    {
+        int textLength = TextLength(text);
 
-                            if ((byte & (8 >> bitX)) > 0) ((unsigned char *)glyphs->image.data)[(pixelY*glyphs->image.width) + pixelX] = 255;
-                        }
-                    }
-                }
-                continue;
-            }
+        // Allocate a big enough buffer to store as many codepoints as text bytes
+        // NOTE: Buffer is not cleared, all codepoints are written
+        codepoints = (int *)RL_MALLOC((textLength + 1)*sizeof(int));
 
-            // Line: ENCODING
-            if (strstr(buffer, "ENCODING") != NULL)
-            {
-                readVars = sscanf(buffer, "ENCODING %i", &charEncoding);
-                continue;
-            }
+        int codepointSize = 0;
+        for (int i = 0; i < textLength;)
+        {
+            // ASCII runs are copied directly, only multibyte codepoints are decoded
+            int asciiLength = GetTextAsciiLength((const unsigned char *)text + i, textLength - i);
+            for (int k = 0; k < asciiLength; k++) codepoints[codepointCount + k] = text[i + k];
+            i += asciiLength;
+            codepointCount += asciiLength;
 
-            // Line: BBX
-            if (strstr(buffer, "BBX") != NULL)
+            if (i < textLength)
             {
-                readVars = sscanf(buffer, "BBX %i %i %i %i", &charBBw, &charBBh, &charBBxoff0, &charBByoff0);
-                continue;
+                codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
+                i += codepointSize;
+                codepointCount++;
             }
+        }
+
+        // Shrink buffer to codepoints count
+        int *temp = (int *)RL_REALLOC(codepoints, (codepointCount + 1)*sizeof(int));
+        if (temp != NULL) codepoints = temp;
+    }
+
+    *count = codepointCount;
+    return codepoints;
+}
+
+// Unload codepoints data from memory
+void UnloadCodepoints(int *codepoints)
+{
+    RL_FREE(codepoints);
+}
+
+// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
+// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
+int GetCodepointCount(const char *text)
+{
+    unsigned int length = 0;
+
+    if (text != NULL)
+    {
+        int textLength = TextLength(text);
+
+        // ASCII runs are skipped in bulk, only multibyte codepoints are decoded
+        for (int i = 0; i < textLength;)
+        {
+            int asciiLength = GetTextAsciiLength((const unsigned char *)text + i, textLength - i);
+            i += asciiLength;
+            length += asciiLength;
+
+            if (i < textLength)
+            {
+                int next = 0;
+                GetCodepointNext(text + i, &next);
+                i += next;
+                length++;
+            }
+        }
+    }
+
+    return length;
+}
+
+// Encode codepoint into utf8 text (char array length returned as parameter)
+// NOTE: It uses a static array to store UTF-8 bytes
+const char *CodepointToUTF8(int codepoint, int *utf8Size)
+{
+    static TEXT_THREAD_LOCAL char utf8[6] = { 0 };
+    memset(utf8, 0, 6); // Clear static array
+    int size = 0;       // Byte size of codepoint
+
+    if (codepoint <= 0x7f)
+    {
+        utf8[0] = (char)codepoint;
+        size = 1;
+    }
+    else if (codepoint <= 0x7ff)
+    {
+        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
+        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
+        size = 2;
+    }
+    else if (codepoint <= 0xffff)
+    {
+        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
+        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
+        size = 3;
+    }
+    else if (codepoint <= 0x10ffff)
+    {
+        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
+        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
+        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
+        size = 4;
+    }
+
+    *utf8Size = size;
+
+    return utf8;
+}
+
+// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
+// When an invalid UTF-8 byte is encountered, exit as soon as possible and a '?'(0x3f) codepoint is returned
+// Total number of bytes processed are returned as a parameter
+// NOTE: The standard says U+FFFD should be returned in case of errors
+// but that character is not supported by the default font in raylib
+int GetCodepoint(const char *text, int *codepointSize)
+{
+/*
+    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
+
+    Char. number range  |        UTF-8 octet sequence
+      (hexadecimal)    |              (binary)
+    --------------------+---------------------------------------------
+    0000 0000-0000 007F | 0xxxxxxx
+    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
+    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
+    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+*/
+
+    int codepoint = 0x3f;   // Codepoint (defaults to '?')
+    *codepointSize = 1;
+    if (text == NULL) return codepoint;
+
+    // NOTE: On decoding errors, return as soon as possible
+    int octet = (unsigned char)(text[0]); // The first UTF8 octet
+
+    if (octet <= 0x7f)
+    {
+        // Only one octet (ASCII range x00-7F)
+        codepoint = text[0];
+    }
+    else if ((octet & 0xe0) == 0xc0)
+    {
+        // Two octets
+
+        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
+        unsigned char octet1 = text[1];
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if ((octet >= 0xc2) && (octet <= 0xdf))
+        {
+            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
+            *codepointSize = 2;
+        }
+    }
+    else if ((octet & 0xf0) == 0xe0)
+    {
+        // Three octets
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
+
+        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
+        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
+        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+
+        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
+            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+
+        if ((octet >= 0xe0) && (octet <= 0xef))
+        {
+            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
+            *codepointSize = 3;
+        }
+    }
+    else if ((octet & 0xf8) == 0xf0)
+    {
+        // Four octets
+        if (octet > 0xf4) return codepoint;
+
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+        unsigned char octet3 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
+
+        octet3 = text[3];
+
+        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+
+        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+
+        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
+            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if (octet >= 0xf0)
+        {
+            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
+            *codepointSize = 4;
+        }
+    }
+
+    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
+
+    return codepoint;
+}
+
+// Get next codepoint in a byte sequence and bytes processed
+int GetCodepointNext(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    *codepointSize = 1;
+    if (text == NULL) return codepoint;
+
+    // Get current codepoint and bytes processed
+    // NOTE: 1 byte codepoints (ASCII) are checked first, most common case
+    if (0x00 == (0x80 & ptr[0]))
+    {
+        // 1 byte UTF-8 codepoint
+        codepoint = ptr[0];
+        *codepointSize = 1;
+    }
+    else if (0xf0 == (0xf8 & ptr[0]))
+    {
+        // 4 byte UTF-8 codepoint
+        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80) || ((ptr[3] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
+        *codepointSize = 4;
+    }
+    else if (0xe0 == (0xf0 & ptr[0]))
+    {
+        // 3 byte UTF-8 codepoint */
+        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
+        *codepointSize = 3;
+    }
+    else if (0xc0 == (0xe0 & ptr[0]))
+    {
+        // 2 byte UTF-8 codepoint
+        if ((ptr[1] & 0xC0) ^ 0x80) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
+        *codepointSize = 2;
+    }
+
+    return codepoint;
+}
+
+// Get previous codepoint in a byte sequence and bytes processed
+int GetCodepointPrevious(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    *codepointSize = 1;
+    if (text == NULL) return codepoint;
+
+    // Move to previous codepoint
+    do ptr--;
+    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+
+    int cpSize = 0;
+    codepoint = GetCodepointNext(ptr, &cpSize);
+    if (codepoint != 0) *codepointSize = cpSize;
+
+    return codepoint;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+#if SUPPORT_FILEFORMAT_FNT || SUPPORT_FILEFORMAT_BDF
+// Read a line from memory
+// REQUIRES: memcpy()
+// NOTE: Returns the number of bytes read
+static int GetLine(const char *origin, char *buffer, int maxLength)
+{
+    int count = 0;
+    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
+    memcpy(buffer, origin, count);
+    buffer[count] = '\0';
+    return count;
+}
+#endif
+
+#if SUPPORT_FILEFORMAT_FNT
+// Load a BMFont file (AngelCode font file)
+// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
+static Font LoadBMFont(const char *fileName)
+{
+    #define MAX_BUFFER_SIZE       256
+    #define MAX_FONT_IMAGE_PAGES    8
+
+    Font font = { 0 };
+
+    char buffer[MAX_BUFFER_SIZE] = { 0 };
+    char *searchPoint = NULL;
+
+    int fontSize = 0;
+    int glyphCount = 0;
+
+    int imWidth = 0;
+    int imHeight = 0;
+    int pageCount = 1;
+    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+
+    int base = 0;       // Useless data
+    int readBytes = 0;  // Data bytes read
+    int readVars = 0;   // Variables filled by sscanf()
+
+    char *fileText = LoadFileText(fileName);
+
+    if (fileText == NULL) return font;
+
+    char *fileTextPtr = fileText;
+
+    // NOTE: Skip first line, it contains no useful information
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    fileTextPtr += (readBytes + 1);
+
+    // Read line data
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "lineHeight");
+    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
+    fileTextPtr += (readBytes + 1);
+
+    if (readVars < 4) { UnloadFileText(fileText); return font; } // Some data not available, file malformed
+
+    if (pageCount > MAX_FONT_IMAGE_PAGES)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font defines more pages than supported: %i/%i", fileName, pageCount, MAX_FONT_IMAGE_PAGES);
+        pageCount = MAX_FONT_IMAGE_PAGES;
+    }
+
+    for (int i = 0; i < pageCount; i++)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        searchPoint = strstr(buffer, "file");
+        readVars = sscanf(searchPoint, "file=\"%128[^\"]\"", imFileName[i]);
+        fileTextPtr += (readBytes + 1);
+
+        if (readVars < 1) { UnloadFileText(fileText); return font; } // No fileName read
+    }
+
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "count");
+    readVars = sscanf(searchPoint, "count=%i", &glyphCount);
+    fileTextPtr += (readBytes + 1);
+
+    if (readVars < 1) { UnloadFileText(fileText); return font; } // No glyphCount read
+
+    // Load all required images for further compose
+    Image *imFonts = (Image *)RL_CALLOC(pageCount, sizeof(Image)); // Font atlases, multiple images
+
+    for (int i = 0; i < pageCount; i++)
+    {
+        imFonts[i] = LoadImage(TextFormat("%s/%s", GetDirectoryPath(fileName), imFileName[i]));
+
+        if (imFonts[i].format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+        {
+            // Convert image to GRAYSCALE + ALPHA, using the mask as the alpha channel
+            Image imFontAlpha = {
+                .data = RL_CALLOC(imFonts[i].width*imFonts[i].height, 2),
+                .width = imFonts[i].width,
+                .height = imFonts[i].height,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+            };
+
+            for (int p = 0, pi = 0; p < (imFonts[i].width*imFonts[i].height*2); p += 2, pi++)
+            {
+                ((unsigned char *)(imFontAlpha.data))[p] = 0xff;
+                ((unsigned char *)(imFontAlpha.data))[p + 1] = ((unsigned char *)imFonts[i].data)[pi];
+            }
+
+            UnloadImage(imFonts[i]);
+            imFonts[i] = imFontAlpha;
+        }
+    }
+
+    Image fullFont = imFonts[0];
+    for (int i = 1; i < pageCount; i++) UnloadImage(imFonts[i]);
+
+    // If multiple atlas, then merge atlas
+    // NOTE: WARNING: This process could be really slow!
+    if (pageCount > 1)
+    {
+        // Resize font atlas to draw additional images
+        ImageResizeCanvas(&fullFont, imWidth, imHeight*pageCount, 0, 0, BLACK);
+
+        for (int i = 1; i < pageCount; i++)
+        {
+            Rectangle srcRec = { 0.0f, 0.0f, (float)imWidth, (float)imHeight };
+            Rectangle destRec = { 0.0f, (float)imHeight*(float)i, (float)imWidth, (float)imHeight };
+            ImageDraw(&fullFont, imFonts[i], srcRec, destRec, WHITE);
+        }
+    }
+
+    RL_FREE(imFonts);
+
+    font.texture = LoadTextureFromImage(fullFont);
+
+    // Fill font characters info data
+    font.baseSize = fontSize;
+    font.glyphCount = glyphCount;
+    font.glyphPadding = 0;
+    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+
+    int charId = 0;
+    int charX = 0;
+    int charY = 0;
+    int charWidth = 0;
+    int charHeight = 0;
+    int charOffsetX = 0;
+    int charOffsetY = 0;
+    int charAdvanceX = 0;
+    int pageID = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        readVars = sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i page=%i",
+                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX, &pageID);
+        fileTextPtr += (readBytes + 1);
+
+        if (readVars == 9)  // Make sure all char data has been properly read
+        {
+            // Get character rectangle in the font atlas texture
+            font.recs[i] = (Rectangle){ (float)charX, (float)charY + (float)imHeight*pageID, (float)charWidth, (float)charHeight };
+
+            // Save data properly in sprite font
+            font.glyphs[i].value = charId;
+            font.glyphs[i].offsetX = charOffsetX;
+            font.glyphs[i].offsetY = charOffsetY;
+            font.glyphs[i].advanceX = charAdvanceX;
+
+            // Fill character image data from full font data
+            font.glyphs[i].image = ImageFromImage(fullFont, font.recs[i]);
+        }
+        else
+        {
+            font.glyphs[i].image = GenImageColor((int)font.recs[i].width, (int)font.recs[i].height, BLACK);
+            TRACELOG(LOG_WARNING, "FONT: [%s] Some characters data not correctly provided", fileName);
+        }
+    }
+
+    UnloadImage(fullFont);
+    UnloadFileText(fileText);
+
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
+    if (font.texture.id == 0)
+    {
+        UnloadFont(font);
+        font = GetFontDefault();
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
+    }
+    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+
+    return font;
+}
+#endif
+
+#if SUPPORT_FILEFORMAT_BDF
+// Convert hexadecimal to decimal (single digit)
+static unsigned char HexToInt(char hex)
+{
+    if ((hex >= '0') && (hex <= '9')) return hex - '0';
+    else if ((hex >= 'a') && (hex <= 'f')) return hex - 'a' + 10;
+    else if ((hex >= 'A') && (hex <= 'F')) return hex - 'A' + 10;
+    else return 0;
+}
+
+// Load font data for further use
+// NOTE: Requires BDF font memory data
+static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, const int *codepoints, int codepointCount, int *outFontSize)
+{
+    #define MAX_BUFFER_SIZE 256
+
+    char buffer[MAX_BUFFER_SIZE] = { 0 };
+
+    GlyphInfo *glyphs = NULL;
+    bool internalCodepoints = false;
+
+    int totalReadBytes = 0;         // Data bytes read (total)
+    int readBytes = 0;              // Data bytes read (line)
+    int readVars = 0;               // Variables filled by sscanf()
+
+    const char *fileText = (const char *)fileData;
+    const char *fileTextPtr = fileText;
+
+    bool fontMalformed = false;     // Is the font malformed
+    bool fontStarted = false;       // Has font started (STARTFONT)
+    int fontBBw = 0;                // Font base character bounding box width
+    int fontBBh = 0;                // Font base character bounding box height
+    int fontBBxoff0 = 0;            // Font base character bounding box X0 offset
+    int fontBByoff0 = 0;            // Font base character bounding box Y0 offset
+    int fontAscent = 0;             // Font ascent
+
+    bool charStarted = false;       // Has character started (STARTCHAR)
+    bool charBitmapStarted = false; // Has bitmap data started (BITMAP)
+    int charBitmapNextRow = 0;      // Y position for the next row of bitmap data
+    int charEncoding = -1;          // The unicode value of the character (-1 if not set)
+    int charBBw = 0;                // Character bounding box width
+    int charBBh = 0;                // Character bounding box height
+    int charBBxoff0 = 0;            // Character bounding box X0 offset
+    int charBByoff0 = 0;            // Character bounding box Y0 offset
+    int charDWidthX = 0;            // Character advance X
+    int charDWidthY = 0;            // Character advance Y (unused)
+
+    int *requiredCodepoints = (int *)RL_MALLOC(codepointCount*sizeof(int));
+
+    if (fileData == NULL) return glyphs;
+
+    // In case no chars count provided, default to 95
+    codepointCount = (codepointCount > 0)? codepointCount : 95;
+
+    if (codepoints == NULL)
+    {
+        // Fill internal codepoints array in case not provided externally
+        // NOTE: By default, filling glyph count consecutively, starting at 32 (Space)
+        for (int i = 0; i < codepointCount; i++) requiredCodepoints[i] = i + 32;
+        internalCodepoints = true;
+    }
+    else
+    {
+        for (int i = 0; i < codepointCount; i++) requiredCodepoints[i] = codepoints[i];
+    }
+
+    glyphs = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
+
+    while (totalReadBytes <= dataSize)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        totalReadBytes += (readBytes + 1);
+        fileTextPtr += (readBytes + 1);
+
+        // Line: COMMENT
+        if (strstr(buffer, "COMMENT") != NULL) continue; // Ignore line
+
+        if (charStarted)
+        {
+            // Line: ENDCHAR
+            if (strstr(buffer, "ENDCHAR") != NULL)
+            {
+                charStarted = false;
+                continue;
+            }
+
+            if (charBitmapStarted)
+            {
+                if (glyphs != NULL)
+                {
+                    int pixelY = charBitmapNextRow++;
+
+                    if (pixelY >= glyphs->image.height) break;
+
+                    for (int x = 0; x < readBytes; x++)
+                    {
+                        unsigned char byte = HexToInt(buffer[x]);
+
+                        for (int bitX = 0; bitX < 4; bitX++)
+                        {
+                            int pixelX = ((x*4) + bitX);
+
+                            if (pixelX >= glyphs->image.width) break;
+
+                            if ((byte & (8 >> bitX)) > 0) ((unsigned char *)glyphs->image.data)[(pixelY*glyphs->image.width) + pixelX] = 255;
+                        }
+                    }
+                }
+                continue;
+            }
+
+            // Line: ENCODING
+            if (strstr(buffer, "ENCODING") != NULL)
+            {
+                readVars = sscanf(buffer, "ENCODING %i", &charEncoding);
+                continue;
+            }
+
+            // Line: BBX
+            if (strstr(buffer, "BBX") != NULL)
+            {
+                readVars = sscanf(buffer, "BBX %i %i %i %i", &charBBw, &charBBh, &charBBxoff0, &charBByoff0);
+                continue;
+            }
+
+            // Line: DWIDTH
+            if (strstr(buffer, "DWIDTH") != NULL)
+            {
+                readVars = sscanf(buffer, "DWIDTH %i %i", &charDWidthX, &charDWidthY);
+                continue;
+            }
+
+            // Line: BITMAP
+            if (strstr(buffer, "BITMAP") != NULL)
+            {
+                // Search for glyph index in codepoints
+                glyphs = NULL;
+
+                for (int index = 0; index < codepointCount; index++)
+                {
+                    if (requiredCodepoints[index] == charEncoding)
+                    {
+                        glyphs = &glyphs[index];
+                        break;
+                    }
+                }
+
+                // Init glyph info
+                if (glyphs != NULL)
+                {
+                    glyphs->value = charEncoding;
+                    glyphs->offsetX = charBBxoff0 + fontBByoff0;
+                    glyphs->offsetY = fontBBh - (charBBh + charBByoff0 + fontBByoff0 + fontAscent);
+                    glyphs->advanceX = charDWidthX;
+
+                    glyphs->image.data = RL_CALLOC(charBBw*charBBh, 1);
+                    glyphs->image.width = charBBw;
+                    glyphs->image.height = charBBh;
+                    glyphs->image.mipmaps = 1;
+                    glyphs->image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+                }
+
+                charBitmapStarted = true;
+                charBitmapNextRow = 0;
+
+                continue;
+            }
+        }
+        else if (fontStarted)
+        {
+            // Line: ENDFONT
+            if (strstr(buffer, "ENDFONT") != NULL)
+            {
+                fontStarted = false;
+                break;
+            }
+
+            // Line: SIZE
+            if (strstr(buffer, "SIZE") != NULL)
+            {
+                if (outFontSize != NULL) readVars = sscanf(buffer, "SIZE %i", outFontSize);
+                continue;
+            }
+
+            // PIXEL_SIZE
+            if (strstr(buffer, "PIXEL_SIZE") != NULL)
+            {
+                if (outFontSize != NULL) readVars = sscanf(buffer, "PIXEL_SIZE %i", outFontSize);
+                continue;
+            }
+
+            // FONTBOUNDINGBOX
+            if (strstr(buffer, "FONTBOUNDINGBOX") != NULL)
+            {
+                readVars = sscanf(buffer, "FONTBOUNDINGBOX %i %i %i %i", &fontBBw, &fontBBh, &fontBBxoff0, &fontBByoff0);
+                continue;
+            }
+
+            // FONT_ASCENT
+            if (strstr(buffer, "FONT_ASCENT") != NULL)
+            {
+                readVars = sscanf(buffer, "FONT_ASCENT %i", &fontAscent);
+                continue;
+            }
+
+            // STARTCHAR
+            if (strstr(buffer, "STARTCHAR") != NULL)
+            {
+                charStarted = true;
+                charEncoding = -1;
+                glyphs = NULL;
+                charBBw = 0;
+                charBBh = 0;
+                charBBxoff0 = 0;
+                charBByoff0 = 0;
+                charDWidthX = 0;
+                charDWidthY = 0;
+                glyphs = NULL;
+                charBitmapStarted = false;
+                charBitmapNextRow = 0;
+                continue;
+            }
+        }
+        else
+        {
+            // STARTFONT
+            if (strstr(buffer, "STARTFONT") != NULL)
+            {
+                if (fontStarted)
+                {
+                    fontMalformed = true;
+                    break;
+                }
+                else
+                {
+                    fontStarted = true;
+                    continue;
+                }
+            }
+        }
+    }
+
+    RL_FREE(requiredCodepoints);
 
-            // Line: DWIDTH
-            if (strstr(buffer, "DWIDTH") != NULL)
+    if (fontMalformed)
+    {
+        RL_FREE(glyphs);
+        glyphs = NULL;
+    }
+
+    return glyphs;
+}
+#endif      // SUPPORT_FILEFORMAT_BDF
+
+// Load glyphs lookup table by codepoint
+// NOTE: Lookup results match a linear search: first glyph with codepoint is used,
+// last '?' glyph is used as fallback (or first glyph if not available)
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+    lookup->glyphs = glyphs;
+    lookup->glyphCount = glyphCount;
+
+    for (int i = 0; i < GLYPH_LOOKUP_PAGE_SIZE; i++) lookup->page[i] = -1;
+
+    int hashedCount = 0;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].value == 63) lookup->fallbackIndex = i;
+        if ((glyphs[i].value < 0) || (glyphs[i].value >= GLYPH_LOOKUP_PAGE_SIZE)) hashedCount++;
+    }
+
+    // Hash table is kept at most half full to keep probing sequences short
+    if (hashedCount > 0)
+    {
+        lookup->capacity = 16;
+        while (lookup->capacity < 2*hashedCount) lookup->capacity *= 2;
+
+        lookup->codepoints = (int *)RL_CALLOC(lookup->capacity, sizeof(int));
+        lookup->indices = (int *)RL_MALLOC(lookup->capacity*sizeof(int));
+        for (int i = 0; i < lookup->capacity; i++) lookup->indices[i] = -1;
+    }
+
+    for (int i = 0; i < glyphCount; i++) AddGlyphLookup(lookup, glyphs[i].value, i);
+
+    return lookup;
+}
+
+// Unload glyphs lookup table
+static void UnloadGlyphLookup(rGlyphLookup *lookup)
+{
+    if (lookup != NULL)
+    {
+#if SUPPORT_FILEFORMAT_TTF
+        if (lookup->atlas != NULL)
+        {
+            RL_FREE(lookup->atlas->fileData);
+            RL_FREE(lookup->atlas->pageGlyphCount);
+            RL_FREE(lookup->atlas->pageLastUse);
+            RL_FREE(lookup->atlas->packers);
+            RL_FREE(lookup->atlas->nodes);
+            RL_FREE(lookup->atlas);
+        }
+#endif
+        // NOTE: First page texture is font texture, unloaded with font
+        for (int i = 1; i < lookup->textureCount; i++) UnloadTexture(lookup->textures[i]);
+
+        RL_FREE(lookup->textures);
+        RL_FREE(lookup->glyphTextures);
+        RL_FREE(lookup->kerningKeys);
+        RL_FREE(lookup->kerningValues);
+        RL_FREE(lookup->codepoints);
+        RL_FREE(lookup->indices);
+        RL_FREE(lookup);
+    }
+}
+
+// Get glyphs lookup table hash slot for a codepoint
+// NOTE: Multiplicative hashing (Knuth), capacity must be a power of two
+static unsigned int GetGlyphLookupHash(int codepoint, int capacity)
+{
+    unsigned int hash = (unsigned int)codepoint*2654435761u;
+    hash ^= (hash >> 16);
+
+    return hash & (unsigned int)(capacity - 1);
+}
+
+// Find glyph index in lookup table, -1 if not available
+static int FindGlyphLookup(const rGlyphLookup *lookup, int codepoint)
+{
+    int index = -1;
+
+    if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGE_SIZE)) index = lookup->page[codepoint];
+    else if (lookup->capacity > 0)
+    {
+        unsigned int slot = GetGlyphLookupHash(codepoint, lookup->capacity);
+
+        while (lookup->indices[slot] >= 0)
+        {
+            if (lookup->codepoints[slot] == codepoint)
             {
-                readVars = sscanf(buffer, "DWIDTH %i %i", &charDWidthX, &charDWidthY);
-                continue;
+                index = lookup->indices[slot];
+                break;
+            }
+
+            slot = (slot + 1) & (lookup->capacity - 1);
+        }
+    }
+
+    return index;
+}
+
+// Add glyph index to lookup table (first glyph for a codepoint is kept)
+// NOTE: Hash table must have free slots available
+static void AddGlyphLookup(rGlyphLookup *lookup, int codepoint, int index)
+{
+    if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGE_SIZE))
+    {
+        if (lookup->page[codepoint] < 0) lookup->page[codepoint] = index;
+    }
+    else
+    {
+        unsigned int slot = GetGlyphLookupHash(codepoint, lookup->capacity);
+
+        while ((lookup->indices[slot] >= 0) && (lookup->codepoints[slot] != codepoint)) slot = (slot + 1) & (lookup->capacity - 1);
+
+        if (lookup->indices[slot] < 0)
+        {
+            lookup->codepoints[slot] = codepoint;
+            lookup->indices[slot] = index;
+        }
+    }
+}
+
+#if SUPPORT_FILEFORMAT_TTF
+// Rasterize glyph into dynamic font atlas, returns glyph index or -1 if not available
+// NOTE: Least recently used page is cleared if no page can fit the glyph
+static int LoadGlyphDynamic(rGlyphLookup *lookup, int codepoint)
+{
+    FontAtlasDynamic *atlas = lookup->atlas;
+
+    if (stbtt_FindGlyphIndex(&atlas->fontInfo, codepoint) <= 0) return -1;
+
+    int width = 0;
+    int height = 0;
+    int offsetX = 0;
+    int offsetY = 0;
+    int advanceX = 0;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&atlas->fontInfo, atlas->scaleFactor, atlas->scaleFactor, codepoint, &width, &height, &offsetX, &offsetY);
+    stbtt_GetCodepointHMetrics(&atlas->fontInfo, codepoint, &advanceX, NULL);
+    advanceX = (int)((float)advanceX*atlas->scaleFactor);
+
+    if (bitmap != NULL) offsetY += atlas->ascent;
+    else
+    {
+        // Glyph without image data, empty image for space characters (same as LoadFontData())
+        width = height = 0;
+        offsetX = offsetY = 0;
+
+        if ((codepoint == 0x20) || (codepoint == 0x3000))
+        {
+            width = advanceX;
+            height = atlas->fontSize;
+        }
+    }
+
+    stbrp_rect rect = { 0 };
+    rect.w = width + 2*atlas->padding;
+    rect.h = height + 2*atlas->padding;
+
+    if ((rect.w > atlas->pageSize) || (rect.h > atlas->pageSize))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [0x%04x] Glyph does not fit in dynamic font atlas page", codepoint);
+        RL_FREE(bitmap);
+        return -1;
+    }
+
+    // Look for a page with free space, clear least recently used page otherwise
+    int page = -1;
+    for (int i = 0; i < atlas->pageCount; i++)
+    {
+        if (atlas->pageGlyphCount[i] < atlas->pageGlyphCapacity)
+        {
+            stbrp_pack_rects(&atlas->packers[i], &rect, 1);
+
+            if (rect.was_packed)
+            {
+                page = i;
+                break;
+            }
+        }
+    }
+
+    if (page < 0)
+    {
+        page = 0;
+        for (int i = 1; i < atlas->pageCount; i++) if (atlas->pageLastUse[i] < atlas->pageLastUse[page]) page = i;
+
+        ClearGlyphAtlasPage(lookup, page);
+        stbrp_pack_rects(&atlas->packers[page], &rect, 1);
+    }
+
+    int index = page*atlas->pageGlyphCapacity + atlas->pageGlyphCount[page];
+    atlas->pageGlyphCount[page]++;
+
+    // Glyph image data, converted to GRAY_ALPHA (same as font atlas)
+    GlyphInfo *glyph = &atlas->glyphs[index];
+    glyph->value = codepoint;
+    glyph->offsetX = offsetX;
+    glyph->offsetY = offsetY;
+    glyph->advanceX = advanceX;
+    glyph->image.width = width;
+    glyph->image.height = height;
+    glyph->image.mipmaps = 1;
+    glyph->image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    glyph->image.data = NULL;
+
+    // Padded glyph rectangle pixels, uploaded to atlas texture
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(rect.w*rect.h*2);
+    for (int i = 0; i < rect.w*rect.h; i++)
+    {
+        pixels[i*2] = 255;
+        pixels[i*2 + 1] = 0;
+    }
+
+    if ((width > 0) && (height > 0))
+    {
+        unsigned char *data = (unsigned char *)RL_MALLOC(width*height*2);
+
+        for (int y = 0; y < height; y++)
+        {
+            unsigned char *row = pixels + ((y + atlas->padding)*rect.w + atlas->padding)*2;
+
+            for (int x = 0; x < width; x++)
+            {
+                unsigned char alpha = (bitmap != NULL)? bitmap[y*width + x] : 0;
+
+                row[x*2 + 1] = alpha;
+                data[(y*width + x)*2] = 255;
+                data[(y*width + x)*2 + 1] = alpha;
+            }
+        }
+
+        glyph->image.data = data;
+    }
+
+    RL_FREE(bitmap);
+
+    atlas->recs[index] = (Rectangle){ (float)(rect.x + atlas->padding), (float)(page*atlas->pageSize + rect.y + atlas->padding), (float)width, (float)height };
+
+    UpdateTextureRec(atlas->texture, (Rectangle){ (float)rect.x, (float)(page*atlas->pageSize + rect.y), (float)rect.w, (float)rect.h }, pixels);
+    RL_FREE(pixels);
+
+    AddGlyphLookup(lookup, codepoint, index);
+
+    return index;
+}
+
+// Clear dynamic font atlas page, unloading its glyphs
+// NOTE: Pending draw calls are flushed first, they could reference page glyphs
+static void ClearGlyphAtlasPage(rGlyphLookup *lookup, int page)
+{
+    FontAtlasDynamic *atlas = lookup->atlas;
+
+    rlDrawRenderBatchActive();
+
+    for (int i = page*atlas->pageGlyphCapacity; i < (page*atlas->pageGlyphCapacity + atlas->pageGlyphCount[page]); i++)
+    {
+        UnloadImage(atlas->glyphs[i].image);
+        atlas->glyphs[i] = (GlyphInfo){ 0 };
+        atlas->recs[i] = (Rectangle){ 0 };
+    }
+
+    atlas->pageGlyphCount[page] = 0;
+    atlas->generation++;
+    stbrp_init_target(&atlas->packers[page], atlas->pageSize, atlas->pageSize, atlas->nodes + page*atlas->pageSize, atlas->pageSize);
+
+    // Rebuild lookup table with remaining glyphs
+    for (int i = 0; i < GLYPH_LOOKUP_PAGE_SIZE; i++) lookup->page[i] = -1;
+    for (int i = 0; i < lookup->capacity; i++) lookup->indices[i] = -1;
+
+    for (int p = 0; p < atlas->pageCount; p++)
+    {
+        for (int i = p*atlas->pageGlyphCapacity; i < (p*atlas->pageGlyphCapacity + atlas->pageGlyphCount[p]); i++) AddGlyphLookup(lookup, atlas->glyphs[i].value, i);
+    }
+
+    TRACELOG(LOG_DEBUG, "FONT: Dynamic font atlas page %i cleared", page);
+}
+
+// Rasterize font glyphs in range [start, end)
+// NOTE: Glyph codepoint values are set before processing, glyphs are independent
+static void LoadFontGlyphs(void *data, int start, int end)
+{
+    FontGlyphsJob *job = (FontGlyphsJob *)data;
+    GlyphInfo *glyphs = job->glyphs;
+    int fontSize = job->fontSize;
+    float scaleFactor = job->scaleFactor;
+
+    for (int k = start; k < end; k++)
+    {
+        int cpWidth = 0, cpHeight = 0;   // Codepoint width and height (on generation)
+        int cp = glyphs[k].value;        // Codepoint value to get info for
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into a provided bitmap
+        switch (job->type)
+        {
+            case FONT_DEFAULT:
+            case FONT_BITMAP:
+            {
+                glyphs[k].image.data = stbtt_GetCodepointBitmap(job->fontInfo, scaleFactor, scaleFactor, cp,
+                    &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
+            } break;
+            case FONT_SDF:
+            {
+                if (cp != 32)
+                {
+#if FONT_SDF_SUPERSAMPLING > 0
+                    glyphs[k].image.data = GenGlyphSDF(job->fontInfo, scaleFactor, cp,
+                        FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE,
+                        &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
+#else
+                    glyphs[k].image.data = stbtt_GetCodepointSDF(job->fontInfo, scaleFactor, cp,
+                        FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE,
+                        &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
+#endif
+                }
+            } break;
+            //case FONT_MSDF:
+            default: break;
+        }
+
+        if (glyphs[k].image.data != NULL)    // Glyph data has been found in the font
+        {
+            stbtt_GetCodepointHMetrics(job->fontInfo, cp, &glyphs[k].advanceX, NULL);
+            glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
+
+            // WARNING: If requested SDF font, sdf-glyph height is definitely bigger than fontSize due to FONT_SDF_CHAR_PADDING
+            if ((job->type != FONT_SDF) && (cpHeight > fontSize)) TRACELOG(LOG_WARNING, "FONT: [0x%04x] Glyph height is bigger than requested font size: %i > %i", cp, cpHeight, (int)fontSize);
+
+            // Load glyph image
+            glyphs[k].image.width = cpWidth;
+            glyphs[k].image.height = cpHeight;
+            glyphs[k].image.mipmaps = 1;
+            glyphs[k].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+            glyphs[k].offsetY += (int)((float)job->ascent*scaleFactor);
+        }
+        //else TRACELOG(LOG_WARNING, "FONT: Glyph [0x%08x] has no image data available", cp); // Only reported for 0x20 and 0x3000
+
+        // Create an empty image for Space character (0x20), useful for sprite font generation
+        // NOTE: Another space to consider: 0x3000 (CJK - Ideographic Space)
+        if ((cp == 0x20) || (cp == 0x3000))
+        {
+            stbtt_GetCodepointHMetrics(job->fontInfo, cp, &glyphs[k].advanceX, NULL);
+            glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
+
+            Image imSpace = {
+                .data = NULL,
+                .width = glyphs[k].advanceX,
+                .height = fontSize,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            };
+
+            // Only allocate space image if required
+            if (glyphs[k].advanceX > 0) imSpace.data = RL_CALLOC(glyphs[k].advanceX*fontSize, 1);
+            else glyphs[k].advanceX = 0;
+
+            glyphs[k].image = imSpace;
+        }
+
+        if (job->type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < cpWidth*cpHeight; p++)
+            {
+                if (((unsigned char *)glyphs[k].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD)
+                    ((unsigned char *)glyphs[k].image.data)[p] = 0;
+                else ((unsigned char *)glyphs[k].image.data)[p] = 255;
+            }
+        }
+    }
+}
+
+// Generate glyph SDF from supersampled bitmap
+// NOTE: Same output size, offsets and values mapping as stbtt_GetCodepointSDF(), distances are
+// computed with an exact euclidean distance transform on a bitmap rasterized FONT_SDF_SUPERSAMPLING times bigger
+static unsigned char *GenGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, unsigned char onEdgeValue, float pixelDistScale, int *width, int *height, int *offsetX, int *offsetY)
+{
+    int supersampling = (FONT_SDF_SUPERSAMPLING > 0)? FONT_SDF_SUPERSAMPLING : 1;
+    int glyph = stbtt_FindGlyphIndex(fontInfo, codepoint);
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale, scale, &x0, &y0, &x1, &y1);
+    if ((x0 == x1) || (y0 == y1)) return NULL;
+
+    x0 -= padding;
+    y0 -= padding;
+    x1 += padding;
+    y1 += padding;
+
+    int sdfWidth = x1 - x0;
+    int sdfHeight = y1 - y0;
+
+    // Rasterize supersampled bitmap, aligned to SDF pixels grid
+    int bitmapWidth = sdfWidth*supersampling;
+    int bitmapHeight = sdfHeight*supersampling;
+    unsigned char *bitmap = (unsigned char *)RL_CALLOC(bitmapWidth*bitmapHeight, 1);
+
+    int bx0 = 0, by0 = 0, bx1 = 0, by1 = 0;
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale*supersampling, scale*supersampling, &bx0, &by0, &bx1, &by1);
+
+    int originX = bx0 - x0*supersampling;
+    int originY = by0 - y0*supersampling;
+    int glyphWidth = ((originX + bx1 - bx0) <= bitmapWidth)? (bx1 - bx0) : (bitmapWidth - originX);
+    int glyphHeight = ((originY + by1 - by0) <= bitmapHeight)? (by1 - by0) : (bitmapHeight - originY);
+
+    if ((originX >= 0) && (originY >= 0) && (glyphWidth > 0) && (glyphHeight > 0))
+    {
+        stbtt_MakeGlyphBitmap(fontInfo, bitmap + originY*bitmapWidth + originX, glyphWidth, glyphHeight, bitmapWidth, scale*supersampling, scale*supersampling, glyph);
+    }
+
+    // Squared distances to nearest inside pixel (outside) and to nearest outside pixel (inside)
+    int size = bitmapWidth*bitmapHeight;
+    int maxSide = (bitmapWidth > bitmapHeight)? bitmapWidth : bitmapHeight;
+    float *outside = (float *)RL_MALLOC(size*sizeof(float));
+    float *inside = (float *)RL_MALLOC(size*sizeof(float));
+    float *f = (float *)RL_MALLOC(maxSide*sizeof(float));
+    float *d = (float *)RL_MALLOC(maxSide*sizeof(float));
+    float *z = (float *)RL_MALLOC((maxSide + 1)*sizeof(float));
+    int *v = (int *)RL_MALLOC(maxSide*sizeof(int));
+
+    // NOTE: Partially covered pixels are seeded with the edge distance estimated from coverage
+    for (int i = 0; i < size; i++)
+    {
+        if (bitmap[i] == 255)
+        {
+            outside[i] = 0.0f;
+            inside[i] = 1e20f;
+        }
+        else if (bitmap[i] == 0)
+        {
+            outside[i] = 1e20f;
+            inside[i] = 0.0f;
+        }
+        else
+        {
+            float edge = 0.5f - (float)bitmap[i]/255.0f;
+            outside[i] = (edge > 0.0f)? edge*edge : 0.0f;
+            inside[i] = (edge < 0.0f)? edge*edge : 0.0f;
+        }
+    }
+
+    ComputeDistanceTransform(outside, bitmapWidth, bitmapHeight, f, d, v, z);
+    ComputeDistanceTransform(inside, bitmapWidth, bitmapHeight, f, d, v, z);
+
+    // Average signed distances of supersampled pixels
+    unsigned char *sdf = (unsigned char *)RL_MALLOC(sdfWidth*sdfHeight);
+    float scaleDist = pixelDistScale/(float)(supersampling*supersampling*supersampling);
+
+    for (int y = 0; y < sdfHeight; y++)
+    {
+        for (int x = 0; x < sdfWidth; x++)
+        {
+            float sum = 0.0f;
+
+            for (int sy = 0; sy < supersampling; sy++)
+            {
+                int offset = (y*supersampling + sy)*bitmapWidth + x*supersampling;
+
+                for (int sx = 0; sx < supersampling; sx++) sum += sqrtf(outside[offset + sx]) - sqrtf(inside[offset + sx]);
+            }
+
+            float value = (float)onEdgeValue - sum*scaleDist;
+            sdf[y*sdfWidth + x] = (unsigned char)((value < 0.0f)? 0 : ((value > 255.0f)? 255 : value));
+        }
+    }
+
+    RL_FREE(bitmap);
+    RL_FREE(outside);
+    RL_FREE(inside);
+    RL_FREE(f);
+    RL_FREE(d);
+    RL_FREE(z);
+    RL_FREE(v);
+
+    *width = sdfWidth;
+    *height = sdfHeight;
+    *offsetX = x0;
+    *offsetY = y0;
+
+    return sdf;
+}
+
+// Compute squared euclidean distance transform (in-place), columns first and rows after
+// NOTE: Exact distances to nearest zero-valued cell, using lower envelope of parabolas (Felzenszwalb-Huttenlocher),
+// provided arrays work as temporary buffers: f, d and v sized max(width, height), z sized max(width, height) + 1
+static void ComputeDistanceTransform(float *grid, int width, int height, float *f, float *d, int *v, float *z)
+{
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int lineCount = (pass == 0)? width : height;
+        int n = (pass == 0)? height : width;
+        int stride = (pass == 0)? width : 1;
+
+        for (int line = 0; line < lineCount; line++)
+        {
+            float *values = grid + ((pass == 0)? line : line*width);
+            for (int q = 0; q < n; q++) f[q] = values[q*stride];
+
+            int k = 0;
+            v[0] = 0;
+            z[0] = -1e20f;
+            z[1] = 1e20f;
+
+            for (int q = 1; q < n; q++)
+            {
+                float s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+
+                while ((k > 0) && (s <= z[k]))
+                {
+                    k--;
+                    s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+                }
+
+                k++;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = 1e20f;
+            }
+
+            k = 0;
+            for (int q = 0; q < n; q++)
+            {
+                while (z[k + 1] < (float)q) k++;
+                d[q] = (float)((q - v[k])*(q - v[k])) + f[v[k]];
+            }
+
+            for (int q = 0; q < n; q++) values[q*stride] = d[q];
+        }
+    }
+}
+
+#endif
+
+#if SUPPORT_FILEFORMAT_TTF || SUPPORT_FILEFORMAT_BDF
+// Generate font atlas pages, glyphs packed with skyline best-fit heuristic (sorted by height)
+// NOTE: Pages are sized to packed glyphs (not power-of-two), glyphs not fitting on a page
+// go to the next one; maxSize 0 packs all glyphs on a single page
+static Image *GenImageFontAtlasPages(const GlyphInfo *glyphs, Rectangle *recs, unsigned short *glyphPages, int glyphCount, int padding, int maxSize, int *pageCount)
+{
+    Image *pages = NULL;
+    int count = 0;
+
+    // Pending rectangles to pack, compacted after every page
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
+    int pendingCount = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int width = glyphs[i].image.width + 2*padding;
+        int height = glyphs[i].image.height + 2*padding;
+
+        recs[i] = (Rectangle){ 0 };
+        glyphPages[i] = 0;
+
+        if ((maxSize > 0) && ((width > maxSize) || (height > (maxSize - FONT_ATLAS_CORNER_REC_SIZE))))
+        {
+            TRACELOG(LOG_WARNING, "FONT: Failed to package glyph (0x%02x), bigger than atlas page", glyphs[i].value);
+            continue;
+        }
+
+        rects[pendingCount] = (stbrp_rect){ .id = i, .w = width, .h = height };
+        pendingCount++;
+    }
+
+    stbrp_context context = { 0 };
+    stbrp_node *nodes = NULL;
+
+    do
+    {
+        // Estimate page width from pending glyphs area, page height is cropped after packing
+        float area = 0.0f;
+        int maxWidth = 0;
+        int totalHeight = 0;
+
+        for (int i = 0; i < pendingCount; i++)
+        {
+            area += (float)rects[i].w*rects[i].h;
+            if (rects[i].w > maxWidth) maxWidth = rects[i].w;
+            totalHeight += rects[i].h;
+        }
+
+        int width = (int)sqrtf(area*1.1f);
+        if (width < maxWidth) width = maxWidth;
+        if (width < FONT_ATLAS_CORNER_REC_SIZE) width = FONT_ATLAS_CORNER_REC_SIZE;
+        width = (width + 3) & ~3;   // Rows aligned to 4 pixels
+        if ((maxSize > 0) && (width > maxSize)) width = maxSize;
+
+        // NOTE: Bottom rows are reserved for the corner rectangle on size limited pages
+        int height = (maxSize > 0)? (maxSize - FONT_ATLAS_CORNER_REC_SIZE) : totalHeight;
+
+        nodes = (stbrp_node *)RL_REALLOC(nodes, width*sizeof(stbrp_node));
+        stbrp_init_target(&context, width, height, nodes, width);
+        stbrp_setup_heuristic(&context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+        stbrp_pack_rects(&context, rects, pendingCount);
+
+        int packedCount = 0;
+        int usedHeight = 0;
+
+        for (int i = 0; i < pendingCount; i++)
+        {
+            if (rects[i].was_packed)
+            {
+                if ((rects[i].y + rects[i].h) > usedHeight) usedHeight = rects[i].y + rects[i].h;
+                packedCount++;
             }
+        }
+
+        if ((packedCount == 0) && (pendingCount > 0)) break;    // Security check, should not happen
+
+        // Reserve bottom-right corner rectangle, extending page if any glyph is placed there
+        if (FONT_ATLAS_CORNER_REC_SIZE > 0)
+        {
+            if (usedHeight < FONT_ATLAS_CORNER_REC_SIZE) usedHeight = FONT_ATLAS_CORNER_REC_SIZE;
 
-            // Line: BITMAP
-            if (strstr(buffer, "BITMAP") != NULL)
+            for (int i = 0; i < pendingCount; i++)
             {
-                // Search for glyph index in codepoints
-                glyphs = NULL;
-
-                for (int index = 0; index < codepointCount; index++)
+                if (rects[i].was_packed && ((rects[i].x + rects[i].w) > (width - FONT_ATLAS_CORNER_REC_SIZE)) &&
+                    ((rects[i].y + rects[i].h) > (usedHeight - FONT_ATLAS_CORNER_REC_SIZE)))
                 {
-                    if (requiredCodepoints[index] == charEncoding)
-                    {
-                        glyphs = &glyphs[index];
-                        break;
-                    }
+                    usedHeight += FONT_ATLAS_CORNER_REC_SIZE;
+                    break;
                 }
+            }
+        }
 
-                // Init glyph info
-                if (glyphs != NULL)
-                {
-                    glyphs->value = charEncoding;
-                    glyphs->offsetX = charBBxoff0 + fontBByoff0;
-                    glyphs->offsetY = fontBBh - (charBBh + charBByoff0 + fontBByoff0 + fontAscent);
-                    glyphs->advanceX = charDWidthX;
+        Image page = { 0 };
+        page.width = width;
+        page.height = usedHeight;
+        page.mipmaps = 1;
+        page.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        page.data = RL_MALLOC(page.width*page.height*2);
 
-                    glyphs->image.data = RL_CALLOC(charBBw*charBBh, 1);
-                    glyphs->image.width = charBBw;
-                    glyphs->image.height = charBBh;
-                    glyphs->image.mipmaps = 1;
-                    glyphs->image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-                }
+        unsigned char *pixels = (unsigned char *)page.data;
+        for (int i = 0; i < page.width*page.height; i++)
+        {
+            pixels[2*i] = 255;
+            pixels[2*i + 1] = 0;
+        }
 
-                charBitmapStarted = true;
-                charBitmapNextRow = 0;
+        // Copy packed glyphs to page (alpha channel), keeping not packed ones for next page
+        int remainingCount = 0;
 
-                continue;
-            }
-        }
-        else if (fontStarted)
+        for (int i = 0; i < pendingCount; i++)
         {
-            // Line: ENDFONT
-            if (strstr(buffer, "ENDFONT") != NULL)
+            if (rects[i].was_packed)
             {
-                fontStarted = false;
-                break;
-            }
+                const Image *image = &glyphs[rects[i].id].image;
+                int offsetX = rects[i].x + padding;
+                int offsetY = rects[i].y + padding;
 
-            // Line: SIZE
-            if (strstr(buffer, "SIZE") != NULL)
+                for (int y = 0; y < image->height; y++)
+                {
+                    const unsigned char *src = (const unsigned char *)image->data + y*image->width;
+                    unsigned char *dst = pixels + 2*((offsetY + y)*page.width + offsetX) + 1;
+
+                    for (int x = 0; x < image->width; x++) dst[2*x] = src[x];
+                }
+
+                recs[rects[i].id] = (Rectangle){ (float)offsetX, (float)offsetY, (float)image->width, (float)image->height };
+                glyphPages[rects[i].id] = (unsigned short)count;
+            }
+            else
             {
-                if (outFontSize != NULL) readVars = sscanf(buffer, "SIZE %i", outFontSize);
-                continue;
+                rects[remainingCount] = rects[i];
+                remainingCount++;
             }
+        }
 
-            // PIXEL_SIZE
-            if (strstr(buffer, "PIXEL_SIZE") != NULL)
+        pendingCount = remainingCount;
+
+        // Add white rectangle at the bottom-right corner of the page
+        for (int y = page.height - FONT_ATLAS_CORNER_REC_SIZE; y < page.height; y++)
+        {
+            for (int x = page.width - FONT_ATLAS_CORNER_REC_SIZE; x < page.width; x++) pixels[2*(y*page.width + x) + 1] = 255;
+        }
+
+        pages = (Image *)RL_REALLOC(pages, (count + 1)*sizeof(Image));
+        pages[count] = page;
+        count++;
+
+    } while (pendingCount > 0);
+
+    RL_FREE(nodes);
+    RL_FREE(rects);
+
+    *pageCount = count;
+
+    return pages;
+}
+#endif
+
+// Check if font has kerning adjustments (static kerning table or dynamic font with kerning data)
+static bool HasGlyphKerning(Font font)
+{
+    return ((font.glyphLookup != NULL) && (font.glyphLookup->kerningCapacity > 0));
+}
+
+// Get kerning table hash slot for a codepoints pair key
+// NOTE: Multiplicative hashing (Fibonacci), capacity must be a power of two
+static unsigned int GetKerningHash(unsigned long long key, int capacity)
+{
+    unsigned long long hash = key*0x9e3779b97f4a7c15ull;
+
+    return (unsigned int)(hash >> 32) & (unsigned int)(capacity - 1);
+}
+
+// Find kerning for a codepoints pair in kerning table, false if pair is not available
+static bool FindGlyphKerning(const rGlyphLookup *lookup, int codepoint, int nextCodepoint, float *kerning)
+{
+    if (lookup->kerningCount == 0) return false;
+
+    unsigned long long key = ((unsigned long long)(unsigned int)codepoint << 32) | (unsigned int)nextCodepoint;
+
+    for (unsigned int slot = GetKerningHash(key, lookup->kerningCapacity); lookup->kerningKeys[slot] != KERNING_EMPTY_KEY; slot = (slot + 1) & (lookup->kerningCapacity - 1))
+    {
+        if (lookup->kerningKeys[slot] == key)
+        {
+            *kerning = lookup->kerningValues[slot];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#if SUPPORT_FILEFORMAT_TTF
+// Add kerning for a codepoints pair to kerning table, table grows to be kept at most half full
+static void AddGlyphKerning(rGlyphLookup *lookup, int codepoint, int nextCodepoint, float kerning)
+{
+    if (2*(lookup->kerningCount + 1) > lookup->kerningCapacity)
+    {
+        int capacity = (lookup->kerningCapacity < 64)? 64 : 2*lookup->kerningCapacity;
+        unsigned long long *keys = (unsigned long long *)RL_MALLOC(capacity*sizeof(unsigned long long));
+        float *values = (float *)RL_MALLOC(capacity*sizeof(float));
+
+        for (int i = 0; i < capacity; i++) keys[i] = KERNING_EMPTY_KEY;
+
+        // Rehash current pairs into new table
+        for (int i = 0; i < lookup->kerningCapacity; i++)
+        {
+            if (lookup->kerningKeys[i] != KERNING_EMPTY_KEY)
             {
-                if (outFontSize != NULL) readVars = sscanf(buffer, "PIXEL_SIZE %i", outFontSize);
-                continue;
+                unsigned int slot = GetKerningHash(lookup->kerningKeys[i], capacity);
+                while (keys[slot] != KERNING_EMPTY_KEY) slot = (slot + 1) & (capacity - 1);
+
+                keys[slot] = lookup->kerningKeys[i];
+                values[slot] = lookup->kerningValues[i];
             }
+        }
 
-            // FONTBOUNDINGBOX
-            if (strstr(buffer, "FONTBOUNDINGBOX") != NULL)
+        RL_FREE(lookup->kerningKeys);
+        RL_FREE(lookup->kerningValues);
+        lookup->kerningKeys = keys;
+        lookup->kerningValues = values;
+        lookup->kerningCapacity = capacity;
+    }
+
+    unsigned long long key = ((unsigned long long)(unsigned int)codepoint << 32) | (unsigned int)nextCodepoint;
+    unsigned int slot = GetKerningHash(key, lookup->kerningCapacity);
+
+    while ((lookup->kerningKeys[slot] != KERNING_EMPTY_KEY) && (lookup->kerningKeys[slot] != key)) slot = (slot + 1) & (lookup->kerningCapacity - 1);
+
+    if (lookup->kerningKeys[slot] == KERNING_EMPTY_KEY) lookup->kerningCount++;
+
+    lookup->kerningKeys[slot] = key;
+    lookup->kerningValues[slot] = kerning;
+}
+
+// Load kerning table for font glyphs from TTF/OTF font data
+// NOTE: Legacy 'kern' table pairs are all loaded, GPOS pair adjustments can only be queried
+// pair by pair, so only pairs between first FONT_KERNING_MAX_GLYPHS glyphs are loaded
+static void LoadGlyphKerning(rGlyphLookup *lookup, const unsigned char *fileData, const GlyphInfo *glyphs, int glyphCount, int fontSize)
+{
+    stbtt_fontinfo fontInfo = { 0 };
+
+    if ((lookup == NULL) || !stbtt_InitFont(&fontInfo, fileData, 0)) return;
+    if ((fontInfo.kern == 0) && (fontInfo.gpos == 0)) return;
+
+    float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+
+    if (fontInfo.gpos == 0)
+    {
+        // Map font glyph ids to loaded codepoints (first glyph for a codepoint is kept)
+        int *glyphCodepoints = (int *)RL_MALLOC(fontInfo.numGlyphs*sizeof(int));
+        for (int i = 0; i < fontInfo.numGlyphs; i++) glyphCodepoints[i] = -1;
+
+        for (int i = glyphCount - 1; i >= 0; i--)
+        {
+            int glyphId = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+            if ((glyphId > 0) && (glyphId < fontInfo.numGlyphs)) glyphCodepoints[glyphId] = glyphs[i].value;
+        }
+
+        int entryCount = stbtt_GetKerningTableLength(&fontInfo);
+        stbtt_kerningentry *entries = (stbtt_kerningentry *)RL_MALLOC(entryCount*sizeof(stbtt_kerningentry));
+        entryCount = stbtt_GetKerningTable(&fontInfo, entries, entryCount);
+
+        for (int i = 0; i < entryCount; i++)
+        {
+            if ((entries[i].advance != 0) && (entries[i].glyph1 < fontInfo.numGlyphs) && (entries[i].glyph2 < fontInfo.numGlyphs) &&
+                (glyphCodepoints[entries[i].glyph1] >= 0) && (glyphCodepoints[entries[i].glyph2] >= 0))
             {
-                readVars = sscanf(buffer, "FONTBOUNDINGBOX %i %i %i %i", &fontBBw, &fontBBh, &fontBBxoff0, &fontBByoff0);
-                continue;
+                AddGlyphKerning(lookup, glyphCodepoints[entries[i].glyph1], glyphCodepoints[entries[i].glyph2], (float)entries[i].advance*scaleFactor);
             }
+        }
 
-            // FONT_ASCENT
-            if (strstr(buffer, "FONT_ASCENT") != NULL)
+        RL_FREE(entries);
+        RL_FREE(glyphCodepoints);
+    }
+    else
+    {
+        int count = (glyphCount < FONT_KERNING_MAX_GLYPHS)? glyphCount : FONT_KERNING_MAX_GLYPHS;
+        int *glyphIds = (int *)RL_MALLOC(count*sizeof(int));
+
+        for (int i = 0; i < count; i++) glyphIds[i] = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+
+        for (int i = 0; i < count; i++)
+        {
+            if (glyphIds[i] == 0) continue;
+
+            for (int k = 0; k < count; k++)
             {
-                readVars = sscanf(buffer, "FONT_ASCENT %i", &fontAscent);
-                continue;
+                if (glyphIds[k] == 0) continue;
+
+                int advance = stbtt_GetGlyphKernAdvance(&fontInfo, glyphIds[i], glyphIds[k]);
+                if (advance != 0) AddGlyphKerning(lookup, glyphs[i].value, glyphs[k].value, (float)advance*scaleFactor);
             }
+        }
 
-            // STARTCHAR
-            if (strstr(buffer, "STARTCHAR") != NULL)
+        RL_FREE(glyphIds);
+    }
+
+    if (lookup->kerningCount > 0) TRACELOG(LOG_INFO, "FONT: Kerning loaded successfully (%i pairs)", lookup->kerningCount);
+}
+#endif
+
+// Get glyph advance for a scale factor (no spacing)
+static float GetGlyphAdvance(Font font, int index, float scaleFactor)
+{
+    if (font.glyphs[index].advanceX == 0) return (float)font.recs[index].width*scaleFactor;
+    else return (float)font.glyphs[index].advanceX*scaleFactor;
+}
+
+// Check if a line can be broken after codepoint
+// NOTE: Spaces are handled by the wrapping itself, CJK ideographs, kana and hangul can break anywhere
+static bool IsLineBreakAfter(int codepoint)
+{
+    bool result = false;
+
+    if ((codepoint == '-') ||
+        ((codepoint >= 0x2e80) && (codepoint <= 0x9fff)) ||     // CJK radicals, punctuation, kana, ideographs
+        ((codepoint >= 0xac00) && (codepoint <= 0xd7af)) ||     // Hangul syllables
+        ((codepoint >= 0xf900) && (codepoint <= 0xfaff)) ||     // CJK compatibility ideographs
+        ((codepoint >= 0xff00) && (codepoint <= 0xffef)) ||     // Halfwidth and fullwidth forms
+        ((codepoint >= 0x20000) && (codepoint <= 0x2ffff))) result = true;  // CJK ideographs extensions
+
+    return result;
+}
+
+// Get next wrapped line length in bytes, text must not contain line-breaks
+// NOTE: Lines always contain at least one codepoint, nextStart skips breaking spaces,
+// line width does not include trailing spaces; maxWidth <= 0 disables wrapping
+static int WrapTextLine(Font font, const char *text, int length, float fontSize, float spacing, float maxWidth, int *nextStart, float *lineWidth)
+{
+    float scaleFactor = fontSize/font.baseSize;
+    float textOffsetX = 0.0f;       // Offset X to next character
+    float width = 0.0f;             // Line width up to last not space character
+
+    int breakEnd = 0;               // Line end at last break opportunity, 0 if none
+    int breakNext = 0;              // Next line start at last break opportunity
+    float breakWidth = 0.0f;        // Line width at last break opportunity
+    bool previousSpace = false;
+    bool kerning = HasGlyphKerning(font);
+    int previous = 0;               // Previous codepoint in line, for kerning
+
+    for (int i = 0; i < length;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        float advance = GetGlyphAdvance(font, GetGlyphIndex(font, codepoint), scaleFactor);
+
+        if (kerning && (previous != 0)) textOffsetX += GetGlyphKerning(font, previous, codepoint)*scaleFactor;
+        previous = codepoint;
+
+        if ((codepoint == ' ') || (codepoint == '\t'))
+        {
+            // Break opportunity before spaces, next line starts after them
+            if (!previousSpace)
             {
-                charStarted = true;
-                charEncoding = -1;
-                glyphs = NULL;
-                charBBw = 0;
-                charBBh = 0;
-                charBBxoff0 = 0;
-                charBByoff0 = 0;
-                charDWidthX = 0;
-                charDWidthY = 0;
-                glyphs = NULL;
-                charBitmapStarted = false;
-                charBitmapNextRow = 0;
-                continue;
+                breakEnd = i;
+                breakWidth = width;
             }
+
+            breakNext = i + codepointByteCount;
+            previousSpace = true;
         }
         else
         {
-            // STARTFONT
-            if (strstr(buffer, "STARTFONT") != NULL)
+            if ((maxWidth > 0.0f) && (i > 0) && ((textOffsetX + advance) > maxWidth))
             {
-                if (fontStarted)
-                {
-                    fontMalformed = true;
-                    break;
-                }
-                else
+                if (breakEnd > 0)
                 {
-                    fontStarted = true;
-                    continue;
+                    *nextStart = breakNext;
+                    *lineWidth = breakWidth;
+                    return breakEnd;
                 }
+
+                // No break opportunity available, break between characters
+                *nextStart = i;
+                *lineWidth = width;
+                return i;
+            }
+
+            width = textOffsetX + advance;
+            previousSpace = false;
+
+            if (IsLineBreakAfter(codepoint))
+            {
+                breakEnd = i + codepointByteCount;
+                breakNext = breakEnd;
+                breakWidth = width;
             }
         }
+
+        textOffsetX += (advance + spacing);
+        i += codepointByteCount;
     }
 
-    RL_FREE(requiredCodepoints);
+    *nextStart = length;
+    *lineWidth = width;
 
-    if (fontMalformed)
+    return length;
+}
+
+// Add text line glyphs to text layout, glyphs arrays must have enough space
+static void AddTextLayoutGlyphs(TextLayout *layout, const char *text, int length, Vector2 offset)
+{
+    float scaleFactor = layout->fontSize/layout->font.baseSize;
+    bool kerning = HasGlyphKerning(layout->font);
+    int previous = 0;               // Previous codepoint in line, for kerning
+
+    for (int i = 0; i < length;)
     {
-        RL_FREE(glyphs);
-        glyphs = NULL;
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(layout->font, codepoint);
+
+        if (kerning && (previous != 0)) offset.x += GetGlyphKerning(layout->font, previous, codepoint)*scaleFactor;
+        previous = codepoint;
+
+        if ((codepoint != ' ') && (codepoint != '\t'))
+        {
+            layout->codepoints[layout->glyphCount] = codepoint;
+            layout->glyphs[layout->glyphCount] = index;
+            layout->positions[layout->glyphCount] = offset;
+            layout->glyphCount++;
+        }
+
+        offset.x += (GetGlyphAdvance(layout->font, index, scaleFactor) + layout->spacing);
+        i += codepointByteCount;
     }
+}
 
-    return glyphs;
+// Get number of ASCII bytes at text start, up to length
+// NOTE: Bytes are checked 16 at a time with SSE2/NEON, 8 at a time otherwise
+static int GetTextAsciiLength(const unsigned char *text, int length)
+{
+    int i = 0;
+
+#if defined(RTEXT_SSE2_ENABLED)
+    for (; (i + 16) <= length; i += 16)
+    {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(text + i))) != 0) break;
+    }
+#elif defined(RTEXT_NEON_ENABLED)
+    for (; (i + 16) <= length; i += 16)
+    {
+        if (vmaxvq_u8(vld1q_u8(text + i)) >= 0x80) break;
+    }
+#else
+    for (; (i + 8) <= length; i += 8)
+    {
+        unsigned long long block = 0;
+        memcpy(&block, text + i, 8);
+        if ((block & 0x8080808080808080ULL) != 0) break;
+    }
+#endif
+
+    // Check remaining bytes (or bytes in block with non-ASCII byte)
+    while ((i < length) && (text[i] < 0x80)) i++;
+
+    return i;
+}
+
+// Allocate bytes from text arena, NULL if not enough space
+static char *AllocTextArena(TextArena *arena, int size)
+{
+    char *result = NULL;
+
+    if ((arena != NULL) && (arena->data != NULL) && (size <= (arena->capacity - arena->offset)))
+    {
+        result = arena->data + arena->offset;
+        arena->offset += size;
+    }
+    else TRACELOG(LOG_WARNING, "TEXT: Text arena has not enough space");
+
+    return result;
+}
+
+// Find text flow paragraph containing byte position, paragraphs include their line-break position
+// NOTE: Paragraphs are searched from the closest text end, appending to long flows is cheap
+static int FindTextFlowParagraph(const TextFlow *flow, int position, int *paragraphStart)
+{
+    const TextFlowParagraph *paragraphs = flow->data->paragraphs;
+    int index = 0;
+    int start = 0;
+
+    if (position > (flow->length/2))
+    {
+        index = flow->data->paragraphCount - 1;
+        start = flow->length - paragraphs[index].length;
+
+        while ((index > 0) && (start > position))
+        {
+            index--;
+            start -= (paragraphs[index].length + 1);
+        }
+    }
+    else
+    {
+        while ((index < (flow->data->paragraphCount - 1)) && ((start + paragraphs[index].length) < position))
+        {
+            start += (paragraphs[index].length + 1);
+            index++;
+        }
+    }
+
+    *paragraphStart = start;
+
+    return index;
+}
+
+// Wrap text flow paragraph lines, paragraph length must be set
+static void WrapTextFlowParagraph(const TextFlow *flow, TextFlowParagraph *paragraph, const char *text)
+{
+    int capacity = 0;
+    int position = 0;
+
+    paragraph->lineCount = 0;
+    paragraph->width = 0.0f;
+
+    do
+    {
+        int nextStart = 0;
+        float lineWidth = 0.0f;
+        int length = WrapTextLine(flow->font, text + position, paragraph->length - position, flow->fontSize, flow->spacing, flow->width, &nextStart, &lineWidth);
+
+        if (paragraph->lineCount == capacity)
+        {
+            // NOTE: Most paragraphs fit in one line, lines array grows on demand
+            capacity = (capacity == 0)? 1 : 2*capacity;
+            paragraph->lines = (TextFlowLine *)RL_REALLOC(paragraph->lines, capacity*sizeof(TextFlowLine));
+        }
+
+        paragraph->lines[paragraph->lineCount] = (TextFlowLine){ position, length, lineWidth };
+        paragraph->lineCount++;
+
+        if (lineWidth > paragraph->width) paragraph->width = lineWidth;
+
+        position += nextStart;
+
+    } while (position < paragraph->length);
 }
-#endif      // SUPPORT_FILEFORMAT_BDF
 
 #endif      // SUPPORT_MODULE_RTEXT
@@ -30,6 +30,12 @@
 *       #define SUPPORT_IMAGE_GENERATION    1
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_IMAGE_MMAP          1
+*           Support image loading from memory-mapped files, zero-copy for raw data and image container (.rli)
+*
+*       #define SUPPORT_IMAGE_THREADS       1
+*           Support multi-threaded image processing (image pipelines)
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform
@@ -69,6 +75,56 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()/LoadImageAnimFromMemory()/ExportImageToMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in CheckImageContainer()/OpenImageStreamPNG()]
+
+#if defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64)
+    #include <emmintrin.h>          // Required for: SSE2 intrinsics [Used in BlendImageCoverageRow()]
+    #define RTEXTURES_SSE2_ENABLED
+#endif
+
+#if SUPPORT_IMAGE_MMAP
+    #if defined(_WIN32)
+        // Win32 file mapping functions declaration, windows.h not included to avoid conflicts
+        #if defined(__cplusplus)
+        extern "C" {
+        #endif
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, void *lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *hFile, long long *lpFileSize);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, void *lpFileMappingAttributes, unsigned long flProtect, unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, size_t dwNumberOfBytesToMap);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        #if defined(__cplusplus)
+        }
+        #endif
+    #elif defined(__unix__) || defined(__APPLE__)
+        #include <sys/mman.h>           // Required for: mmap(), munmap() [Used in LoadImageMapped()/LoadImageRawMapped()]
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+    #endif
+#endif
+
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+        // Win32 threads functions declaration, windows.h not included to avoid conflicts
+        #if defined(__cplusplus)
+        extern "C" {
+        #endif
+        __declspec(dllimport) void *__stdcall CreateThread(void *lpThreadAttributes, size_t dwStackSize, unsigned long (__stdcall *lpStartAddress)(void *), void *lpParameter, unsigned long dwCreationFlags, unsigned long *lpThreadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void *SRWLock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void *SRWLock);
+        #if defined(__cplusplus)
+        }
+        #endif
+    #elif defined(__unix__) || defined(__APPLE__)
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock() [Used in RunImageJob()]
+        #include <unistd.h>             // Required for: sysconf()
+    #endif
+#endif
 
 // Support only desired texture formats on stb_image
 #if !SUPPORT_FILEFORMAT_BMP
@@ -234,15 +290,296 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_STREAM_BUFFER_SIZE
+    #define IMAGE_STREAM_BUFFER_SIZE     65536    // Image stream file read buffer size in bytes
+#endif
+#ifndef IMAGE_STREAM_BAND_SIZE
+    #define IMAGE_STREAM_BAND_SIZE      262144    // Image stream rows band size in bytes, processed per step on export
+#endif
+#ifndef PNG_COMPRESSION_LEVEL_DEFAULT
+    #define PNG_COMPRESSION_LEVEL_DEFAULT    6    // PNG DEFLATE compression level used by image stream export [0..9]
+#endif
+
+#define INFLATE_FAST_BITS               10    // Huffman codes fast lookup table size in bits (DEFLATE decoding)
+
+#ifndef IMAGE_MAX_THREADS
+    #define IMAGE_MAX_THREADS                8    // Maximum number of threads used for image processing jobs
+#endif
+#ifndef IMAGE_EXPORT_MAX_TASKS
+    #define IMAGE_EXPORT_MAX_TASKS           4    // Maximum number of asynchronous image exports running at the same time
+#endif
+#ifndef IMAGE_JOB_BAND_SIZE
+    #define IMAGE_JOB_BAND_SIZE          65536    // Image processing job rows band size in bytes, processed per step
+#endif
+#ifndef IMAGE_TEXT_JOB_MIN_SIZE
+    #define IMAGE_TEXT_JOB_MIN_SIZE     262144    // Minimum glyphs pixels count to draw image text on worker threads
+#endif
+
+#define IMAGE_CONTAINER_VERSION        100    // Image container file (.rli) version
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image stream context type
+// NOTE: Depends on the decoder in charge of reading the different file types
+typedef enum {
+    IMAGE_STREAM_NONE = 0,          // No image stream context loaded
+    IMAGE_STREAM_RAW,               // RAW pixel data, random rows access
+    IMAGE_STREAM_PNG,               // PNG image, sequential rows decoding
+    IMAGE_STREAM_QOI,               // QOI image, sequential rows decoding
+    IMAGE_STREAM_MEMORY             // Image fully decoded in memory (file format not supporting streaming)
+} ImageStreamType;
+
+// DEFLATE Huffman decoding table
+typedef struct InflateTable {
+    unsigned short fast[1 << INFLATE_FAST_BITS]; // Fast lookup entries: (symbol << 4) | codeLength, 0 for longer codes
+    unsigned short counts[16];      // Number of codes for every code length
+    unsigned short symbols[288];    // Symbols sorted by code length
+} InflateTable;
+
+// DEFLATE streaming decoder state
+// NOTE: Output is generated on demand, back-references use a 32KB sliding window
+typedef struct InflateState {
+    unsigned long long bits;        // Input bit buffer
+    int bitCount;                   // Number of bits available in bit buffer
+    int blockType;                  // Current block type: -1 (no block), 0 (stored), 1 (fixed codes), 2 (dynamic codes)
+    bool lastBlock;                 // Current block is the last one in the stream
+    bool finished;                  // Stream end reached or invalid data found
+    unsigned int storedLength;      // Remaining bytes of current stored block
+    int matchLength;                // Remaining bytes of current back-reference
+    int matchDistance;              // Current back-reference distance
+    InflateTable lit;               // Literal/length codes table
+    InflateTable dist;              // Distance codes table
+    unsigned char window[32768];    // Sliding window, last 32KB of output
+    unsigned int windowPos;         // Sliding window write position
+} InflateState;
+
+// Image stream context data
+typedef struct ImageStreamContext {
+    FILE *file;                     // File handle (not used by memory streams)
+    long dataOffset;                // File offset where pixel data starts
+    int width;                      // Image width
+    int height;                     // Image height
+    int format;                     // Image output pixel format (PixelFormat type)
+    int rowSize;                    // Output row size in bytes
+    int nextRow;                    // Next row to be decoded (sequential streams)
+
+    unsigned char *buffer;          // File read buffer
+    long bufferOffset;              // File offset of read buffer data
+    int bufferSize;                 // Read buffer available bytes
+    int bufferPos;                  // Read buffer position
+
+    Image image;                    // Image data (memory streams)
+
+    // PNG decoding data
+    int bitDepth;                   // PNG bits per channel: 1, 2, 4, 8, 16
+    int colorType;                  // PNG color type: 0-Gray, 2-RGB, 3-Indexed, 4-GrayAlpha, 6-RGBA
+    int channels;                   // PNG channels per pixel
+    int filterStride;               // PNG filter bytes per complete pixel (at least 1)
+    int rawRowSize;                 // PNG filtered row size in bytes (without filter type byte)
+    unsigned char *rowPrevious;     // PNG previous unfiltered row
+    unsigned char *rowCurrent;      // PNG current row
+    unsigned char palette[256*4];   // PNG palette colors (RGBA)
+    bool transparency;              // PNG transparency chunk available (tRNS)
+    unsigned short transKey[3];     // PNG transparent color key (non-indexed images)
+    unsigned int chunkRemaining;    // PNG remaining bytes of current IDAT chunk
+    bool chunkCrcPending;           // PNG current IDAT chunk CRC must be skipped
+    bool chunksEnded;               // PNG no more IDAT chunks available
+    InflateState *inflate;          // PNG zlib stream decoder
+
+    // QOI decoding data
+    unsigned char qoiIndex[64*4];   // QOI previously seen pixels array
+    unsigned char qoiPixel[4];      // QOI current pixel (RGBA)
+    int qoiRun;                     // QOI current pixel remaining run
+} ImageStreamContext;
+
+// DEFLATE bits writer
+// Image container file header (.rli), pixel data (including mipmaps) follows the header
+// NOTE: Header size keeps pixel data aligned for direct access from memory-mapped files
+typedef struct ImageContainerHeader {
+    char id[4];                     // Image container file identifier: "rIMG"
+    int version;                    // Image container version
+    int width;                      // Image base width
+    int height;                     // Image base height
+    int format;                     // Data format (PixelFormat type)
+    int mipmaps;                    // Mipmap levels, 1 by default
+    int dataSize;                   // Pixel data size in bytes, all mipmap levels
+    int reserved;                   // Reserved, 0 by default
+} ImageContainerHeader;
+
+// Memory-mapped image data, required to unmap file on image unloading
+typedef struct ImageMapping {
+    void *data;                     // Image data pointer, inside mapped file
+    void *mapping;                  // Mapped file base address
+    size_t size;                    // Mapped file size in bytes
+} ImageMapping;
+
+// Image pipeline operation type
+typedef enum {
+    IMAGE_PIPELINE_OP_NONE = 0,
+    IMAGE_PIPELINE_OP_LUT,          // Fused per-channel operations, applied with lookup tables
+    IMAGE_PIPELINE_OP_TINT,
+    IMAGE_PIPELINE_OP_INVERT,
+    IMAGE_PIPELINE_OP_GRAYSCALE,
+    IMAGE_PIPELINE_OP_CONTRAST,
+    IMAGE_PIPELINE_OP_BRIGHTNESS,
+    IMAGE_PIPELINE_OP_REPLACE,
+    IMAGE_PIPELINE_OP_PREMULTIPLY
+} ImagePipelineOpType;
+
+// Image pipeline operation, as recorded
+typedef struct ImagePipelineOp {
+    int type;                       // Operation type (ImagePipelineOpType)
+    Color color;                    // Operation color: tint, replaced color
+    Color replace;                  // Operation replacement color
+    float value;                    // Operation value: contrast, brightness
+} ImagePipelineOp;
+
+// Image pipeline stage, as executed
+typedef struct ImagePipelineStage {
+    int type;                       // Stage type (ImagePipelineOpType)
+    Color color;                    // Stage color: replaced color
+    Color replace;                  // Stage replacement color
+    unsigned char lut[4][256];      // Stage lookup tables per channel (IMAGE_PIPELINE_OP_LUT)
+} ImagePipelineStage;
+
+// Image pipeline job data, shared by all workers
+typedef struct ImagePipelineJob {
+    Image src;                      // Source image
+    Image dst;                      // Destination image, same data as source if processed in-place
+    ImagePipelineStage *stages;     // Pipeline stages
+    int stageCount;                 // Pipeline stages count
+    int tapsX;                      // Horizontal resampling taps, 0 if not resized
+    int tapsY;                      // Vertical resampling taps, 0 if not resized
+    int *firstX;                    // Horizontal resampling first source pixel
+    int *firstY;                    // Vertical resampling first source row
+    float *weightsX;                // Horizontal resampling weights
+    float *weightsY;                // Vertical resampling weights
+} ImagePipelineJob;
+
+// Image resize job data, 8 bit per channel fixed-point resampling
+typedef struct ImageResizeJob {
+    const unsigned char *src;       // Source image data
+    unsigned char *dst;             // Destination image data
+    int srcWidth;                   // Source image width
+    int srcHeight;                  // Source image height
+    int dstWidth;                   // Destination image width
+    int dstHeight;                  // Destination image height
+    int channels;                   // Channels per pixel [1..4]
+    int factor;                     // Integer downscale factor (box filtering), 0 if generic resampling
+    int tapsX;                      // Horizontal resampling taps
+    int tapsY;                      // Vertical resampling taps
+    int *firstX;                    // Horizontal resampling first source pixel
+    int *firstY;                    // Vertical resampling first source row
+    int *weightsX;                  // Horizontal resampling weights (fixed-point, 14 bit)
+    int *weightsY;                  // Vertical resampling weights (fixed-point, 14 bit)
+} ImageResizeJob;
+
+// Image text glyph, placed in destination image
+typedef struct ImageTextGlyph {
+    const unsigned char *data;      // Glyph image data (GRAY_ALPHA), coverage in alpha channel
+    int width;                      // Glyph image width
+    int height;                     // Glyph image height
+    float x;                        // Glyph position X in destination image
+    float y;                        // Glyph position Y in destination image
+    int x0, y0, x1, y1;             // Glyph pixels bounds in destination image, clipped to text box
+} ImageTextGlyph;
+
+// Image text drawing job data, glyphs coverage blended into destination rows
+typedef struct ImageTextJob {
+    Image *dst;                     // Destination image (RGBA8, RGB8, GRAYSCALE)
+    const ImageTextGlyph *glyphs;   // Glyphs to draw, in text order
+    int glyphCount;                 // Glyphs count
+    int maxWidth;                   // Maximum glyph width in destination image
+    float scale;                    // Glyphs scale factor
+    bool nearest;                   // Glyphs nearest-neighbor sampling, bilinear sampling otherwise
+    Color tint;                     // Text color
+    unsigned char tintGray;         // Text color grayscale equivalent
+    int startRow;                   // First row processed by job
+} ImageTextJob;
+
+// Image processing job function, processes items in range [start, end)
+typedef void (*ImageJobFunc)(void *data, int start, int end);
+
+// Image processing job worker
+typedef struct ImageJobWorker {
+    ImageJobFunc func;              // Job function
+    void *data;                     // Job data
+    int count;                      // Job items count
+    int blockSize;                  // Job items processed per block
+    int index;                      // Worker index
+    int workerCount;                // Workers count
+} ImageJobWorker;
+
+// Image processing thread
+typedef struct ImageThread {
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+    void *handle;                   // Thread handle (Win32)
+    #elif defined(__unix__) || defined(__APPLE__)
+    pthread_t handle;               // Thread handle (POSIX)
+    #endif
+#endif
+    bool started;                   // Thread started, requires joining
+    void (*func)(void *arg);        // Thread function
+    void *arg;                      // Thread function argument
+} ImageThread;
+
+// Image asynchronous export task
+typedef struct ImageExportTask {
+    Image image;                    // Image copy to be exported
+    char *fileName;                 // Export file name copy
+    ImageThread thread;             // Export thread
+    bool active;                    // Export task active, thread must be joined
+} ImageExportTask;
+
+// PNG encoder job data, shared by all workers
+typedef struct PngEncoderJob {
+    const unsigned char *data;      // Image data, 8 bit per channel
+    int height;                     // Image height
+    int channels;                   // Image channels
+    int rowSize;                    // Image row size in bytes
+    int bandRows;                   // Rows per band
+    int level;                      // Compression level
+    unsigned char **bands;          // Compressed bands, stored as IDAT chunks
+    int *bandSizes;                 // Compressed bands size in bytes
+    unsigned int *bandAdlers;       // Bands filtered data checksum
+} PngEncoderJob;
+
+typedef struct DeflateWriter {
+    unsigned char *output;          // Output buffer
+    int size;                       // Output bytes written
+    unsigned long long bits;        // Bit buffer
+    int bitCount;                   // Number of bits in bit buffer
+} DeflateWriter;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+#if SUPPORT_FILEFORMAT_PNG
+// DEFLATE length and distance codes base values and extra bits
+static const unsigned short deflateLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const unsigned char deflateLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const unsigned short deflateDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const unsigned char deflateDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+#endif
+
+static int imageCompressionLevel = PNG_COMPRESSION_LEVEL_DEFAULT;   // Image export compression level (PNG)
+static ImageExportTask imageExportTasks[IMAGE_EXPORT_MAX_TASKS] = { 0 }; // Image asynchronous export tasks
+static int imageExportTaskIndex = 0;            // Image asynchronous export next task index
+
+#if SUPPORT_IMAGE_MMAP
+static ImageMapping *imageMappings = NULL;      // Memory-mapped images data, registered on loading
+static int imageMappingCount = 0;               // Memory-mapped images count
+static int imageMappingCapacity = 0;            // Memory-mapped images registry capacity
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+static void *imageMappingLock = NULL;           // Memory-mapped images registry lock (SRWLOCK), images can be loaded/unloaded from any thread
+    #elif defined(__unix__) || defined(__APPLE__)
+static pthread_mutex_t imageMappingLock = PTHREAD_MUTEX_INITIALIZER; // Memory-mapped images registry lock, images can be loaded/unloaded from any thread
+    #endif
+#endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -256,6 +593,77 @@ static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
 
+
+// Image stream decoding functions
+static int ImageStreamReadData(ImageStreamContext *ctx, unsigned char *data, int size); // Read data from image stream file (buffered)
+static int ImageStreamReadByte(ImageStreamContext *ctx);                      // Read one byte from image stream file (buffered), -1 on end of file
+static void ImageStreamSeek(ImageStreamContext *ctx, long offset);            // Set image stream file read position
+static bool ReadImageStreamRows(ImageStreamContext *ctx, int type, int startRow, int rowCount, unsigned char *data); // Read image stream rows into provided buffer
+static bool ReadImageStreamRowsColor(ImageStreamContext *ctx, int type, int startRow, int rowCount, unsigned char *data, unsigned char *rowData, int channels); // Read image stream rows as 8-bit channels
+#if SUPPORT_FILEFORMAT_PNG
+static bool OpenImageStreamPNG(ImageStreamContext *ctx);                      // Read PNG header and chunks up to image data
+static bool RewindImageStreamPNG(ImageStreamContext *ctx);                    // Restart PNG image data decoding
+static bool ReadImageStreamRowPNG(ImageStreamContext *ctx, unsigned char *row); // Decode next PNG row
+static int ReadPngDataByte(ImageStreamContext *ctx);                          // Read next byte of PNG image data chunks, -1 if no more data
+static int GetPaethPredictor(int a, int b, int c);                            // Get PNG Paeth filter predictor
+static unsigned int InflateGetBits(ImageStreamContext *ctx, int count);       // Get bits from DEFLATE stream
+static bool InflateBuildTable(InflateTable *table, const unsigned char *lengths, int count); // Build Huffman decoding table from code lengths
+static int InflateDecodeSymbol(ImageStreamContext *ctx, const InflateTable *table); // Decode one symbol from DEFLATE stream
+static bool InflateReadDynamicTables(ImageStreamContext *ctx);                // Read dynamic Huffman codes block header
+static int InflateRead(ImageStreamContext *ctx, unsigned char *output, int size); // Decode DEFLATE stream data from PNG image data chunks
+#endif
+#if SUPPORT_FILEFORMAT_QOI
+static bool OpenImageStreamQOI(ImageStreamContext *ctx);                      // Read QOI header
+static void RewindImageStreamQOI(ImageStreamContext *ctx);                    // Restart QOI image data decoding
+static bool ReadImageStreamRowQOI(ImageStreamContext *ctx, unsigned char *row); // Decode next QOI row
+#endif
+
+// Image encoding functions
+static int LoadResampleWeights(int srcSize, int dstSize, int **first, float **weights); // Load resampling contributions (Box/Bilinear), returns taps per sample
+#if SUPPORT_IMAGE_EXPORT && SUPPORT_FILEFORMAT_PNG
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int dataSize); // Compute Adler-32 checksum (zlib streams)
+static void DeflatePutBits(DeflateWriter *writer, unsigned int value, int count); // Write bits into DEFLATE stream
+static int DeflateBlocks(const unsigned char *data, int dataSize, unsigned char *output, int level); // Compress data into non-final DEFLATE blocks, byte-aligned at the end
+static int GetPngBandBound(int rowCount, int rowSize);                        // Get maximum compressed size for a band of PNG rows
+static int CompressPngBand(const unsigned char *rows, int rowCount, int rowSize, int channels, const unsigned char *previousRow, unsigned char *output, int level, unsigned int *adler); // Filter and compress a band of PNG rows
+static int SetPngChunk(unsigned char *chunk, const char *type, int dataSize);  // Set PNG chunk header and CRC, data must be placed at (chunk + 8)
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int dataSize2); // Combine Adler-32 checksums of consecutive data blocks
+static void CompressPngBands(void *data, int startBand, int endBand);         // Compress PNG bands in range [startBand, endBand)
+static unsigned char *EncodePNG(const unsigned char *data, int width, int height, int channels, int level, int *dataSize); // Encode image data into PNG file data (multi-threaded)
+#endif
+
+static bool CheckImageContainer(const unsigned char *fileData, size_t dataSize); // Check image container (.rli) header and data size
+#if SUPPORT_IMAGE_MMAP
+static void *MapFileData(const char *fileName, size_t *size);                 // Map file data into memory (copy-on-write)
+static void UnmapFileData(void *mapping, size_t size);                        // Unmap file data from memory
+static void RegisterImageMapping(void *data, void *mapping, size_t size);     // Register memory-mapped image data
+static bool UnloadImageMapping(void *data);                                   // Unmap image data if memory-mapped, returns true if unmapped
+static void LockImageMappings(void);                                          // Lock memory-mapped images registry, it can be accessed from several threads
+static void UnlockImageMappings(void);                                        // Unlock memory-mapped images registry
+#endif
+
+// Image processing functions
+static void AddImagePipelineOp(ImagePipeline *pipeline, ImagePipelineOp op);   // Record image pipeline operation
+static void ProcessImagePipelineRows(void *data, int startRow, int endRow);    // Process image pipeline rows in range [startRow, endRow)
+static void LoadImagePipelineRow(Image image, int y, Color *row, int pixelSize); // Load image row pixels as Color values
+static int GetImageChannels8(int format);                                      // Get channels count for 8 bit per channel pixel formats, 0 for other formats
+static int LoadResampleWeightsFixed(int srcSize, int dstSize, bool bilinear, int **first, int **weights); // Load resampling contributions as fixed-point weights, returns taps per sample
+static void ResizeImageRowsFixed(void *data, int startRow, int endRow);        // Resize 8 bit per channel image rows in range [startRow, endRow)
+static void ResizeImageFixed(const unsigned char *src, int srcWidth, int srcHeight, unsigned char *dst, int dstWidth, int dstHeight, int channels, bool bilinear); // Resize 8 bit per channel image data (Box/Bilinear, multi-threaded)
+static bool DrawImageTextCoverage(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text glyphs coverage into image (RGBA8, RGB8, GRAYSCALE)
+#if SUPPORT_MODULE_RTEXT
+static void DrawImageTextRows(void *data, int startRow, int endRow);           // Draw image text rows in range [startRow, endRow)
+static void LoadGlyphCoverageRow(const ImageTextGlyph *glyph, float scale, bool nearest, int x, int y, int count, unsigned char *coverage); // Load glyph coverage for destination image row pixels
+static void BlendImageCoverageRow(unsigned char *dst, const unsigned char *coverage, int count, int format, Color tint, unsigned char tintGray); // Blend solid color into image row pixels by coverage
+static void BlendImageCoveragePixel(unsigned char *pixel, unsigned int alpha, Color color); // Blend solid color into RGBA8 pixel with alpha
+#endif
+static void RunImageJobWorker(void *arg);                                      // Run image processing job worker blocks
+extern void RunImageJob(ImageJobFunc func, void *data, int count, int blockSize); // Run image processing job on worker threads (also used by rtext)
+static bool StartImageThread(ImageThread *thread, void (*func)(void *arg), void *arg); // Start image processing thread
+static void JoinImageThread(ImageThread *thread);                             // Wait for image processing thread to finish
+static int GetImageThreadCount(void);                                         // Get number of threads available for image processing
+static void ExportImageTask(void *arg);                                       // Export image asynchronous task
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -324,6 +732,117 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
     return image;
 }
 
+// Load image from file memory-mapped
+// NOTE: Image container files (.rli) are mapped with zero-copy, pixel data pages are shared with
+// other processes mapping the same file until modified, other file formats are decoded from mapped data
+Image LoadImageMapped(const char *fileName)
+{
+    Image image = { 0 };
+
+#if SUPPORT_IMAGE_MMAP
+    size_t size = 0;
+    unsigned char *mapping = (unsigned char *)MapFileData(fileName, &size);
+
+    if (mapping != NULL)
+    {
+        bool mapped = false;
+
+        if (IsFileExtension(fileName, ".rli"))
+        {
+            if (CheckImageContainer(mapping, size))
+            {
+                const ImageContainerHeader *header = (const ImageContainerHeader *)mapping;
+
+                image.data = mapping + sizeof(ImageContainerHeader);
+                image.width = header->width;
+                image.height = header->height;
+                image.format = header->format;
+                image.mipmaps = header->mipmaps;
+                mapped = true;
+            }
+            else TRACELOG(LOG_WARNING, "IMAGE: [%s] Image container data not valid", fileName);
+        }
+        else if (size <= 0x7fffffff) image = LoadImageFromMemory(GetFileExtension(fileName), mapping, (int)size);
+
+        if (mapped)
+        {
+            RegisterImageMapping(image.data, mapping, size);     // Mapping unmapped on UnloadImage()
+
+            TRACELOG(LOG_INFO, "IMAGE: [%s] Image data mapped successfully (%ix%i | %s | %i mipmaps)", fileName, image.width, image.height, rlGetPixelFormatName(image.format), image.mipmaps);
+        }
+        else UnmapFileData(mapping, size);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to map file, loading image data into memory", fileName);
+        image = LoadImage(fileName);
+    }
+#else
+    image = LoadImage(fileName);
+#endif
+
+    return image;
+}
+
+// Load image from RAW file memory-mapped
+// NOTE: Image data points into the mapped file (zero-copy), mapped pages are copy-on-write
+Image LoadImageRawMapped(const char *fileName, int width, int height, int format, int headerSize)
+{
+    Image image = { 0 };
+
+#if SUPPORT_IMAGE_MMAP
+    size_t size = 0;
+    unsigned char *mapping = (unsigned char *)MapFileData(fileName, &size);
+
+    if (mapping != NULL)
+    {
+        int dataSize = GetPixelDataSize(width, height, format);
+
+        if ((headerSize >= 0) && (dataSize > 0) && (((size_t)headerSize + dataSize) <= size))   // Security check
+        {
+            image.data = mapping + headerSize;
+            image.width = width;
+            image.height = height;
+            image.mipmaps = 1;
+            image.format = format;
+
+            RegisterImageMapping(image.data, mapping, size);     // Mapping unmapped on UnloadImage()
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: [%s] RAW file size not valid for provided image parameters", fileName);
+            UnmapFileData(mapping, size);
+        }
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to map file, loading image data into memory", fileName);
+        image = LoadImageRaw(fileName, width, height, format, headerSize);
+    }
+#else
+    image = LoadImageRaw(fileName, width, height, format, headerSize);
+#endif
+
+    return image;
+}
+
+// Check if image data is memory-mapped from file
+bool IsImageMapped(Image image)
+{
+    bool result = false;
+
+#if SUPPORT_IMAGE_MMAP
+    LockImageMappings();
+    for (int i = 0; (i < imageMappingCount) && !result; i++)
+    {
+        if ((image.data != NULL) && (imageMappings[i].data == image.data)) result = true;
+    }
+    UnlockImageMappings();
+#endif
+
+    return result;
+}
+
 // Load animated image data
 //  - Image.data buffer includes all frames: [image#0][image#1][image#2][...]
 //  - Number of frames is returned through 'frames' parameter
@@ -510,6 +1029,21 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
         }
     }
 #endif
+    else if ((strcmp(fileType, ".rli") == 0) || (strcmp(fileType, ".RLI") == 0))
+    {
+        if (CheckImageContainer(fileData, dataSize))
+        {
+            const ImageContainerHeader *header = (const ImageContainerHeader *)fileData;
+
+            image.data = RL_MALLOC(header->dataSize);
+            memcpy(image.data, fileData + sizeof(ImageContainerHeader), header->dataSize);
+            image.width = header->width;
+            image.height = header->height;
+            image.format = header->format;
+            image.mipmaps = header->mipmaps;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Image container data not valid");
+    }
 #if SUPPORT_FILEFORMAT_DDS
     else if ((strcmp(fileType, ".dds") == 0) || (strcmp(fileType, ".DDS") == 0))
     {
@@ -611,6 +1145,10 @@ bool IsImageValid(Image image)
 // Unload image from CPU memory (RAM)
 void UnloadImage(Image image)
 {
+#if SUPPORT_IMAGE_MMAP
+    // Memory-mapped image data is unmapped instead of freed
+    if (UnloadImageMapping(image.data)) return;
+#endif
     RL_FREE(image.data);
 }
 
@@ -643,7 +1181,7 @@ bool ExportImage(Image image, const char *fileName)
     else if (IsFileExtension(fileName, ".png"))
     {
         int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+        unsigned char *fileData = EncodePNG(imgData, image.width, image.height, channels, imageCompressionLevel, &dataSize);
         result = SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
@@ -690,6 +1228,32 @@ bool ExportImage(Image image, const char *fileName)
         // NOTE: It's up to the user to track image parameters
         result = SaveFileData(fileName, image.data, GetPixelDataSize(image.width, image.height, image.format));
     }
+    else if (IsFileExtension(fileName, ".rli"))
+    {
+        // Export image container: header followed by pixel data (all mipmaps, any pixel format)
+        // NOTE: Exported file can be loaded with zero-copy using LoadImageMapped()
+        ImageContainerHeader header = { .id = { 'r', 'I', 'M', 'G' } };
+        header.version = IMAGE_CONTAINER_VERSION;
+        header.width = image.width;
+        header.height = image.height;
+        header.format = image.format;
+        header.mipmaps = (image.mipmaps > 0)? image.mipmaps : 1;
+
+        for (int i = 0, width = image.width, height = image.height; i < header.mipmaps; i++)
+        {
+            header.dataSize += GetPixelDataSize(width, height, image.format);
+            width = (width > 1)? width/2 : 1;
+            height = (height > 1)? height/2 : 1;
+        }
+
+        int fileSize = sizeof(ImageContainerHeader) + header.dataSize;
+        unsigned char *fileData = (unsigned char *)RL_MALLOC(fileSize);
+        memcpy(fileData, &header, sizeof(ImageContainerHeader));
+        memcpy(fileData + sizeof(ImageContainerHeader), image.data, header.dataSize);
+
+        result = SaveFileData(fileName, fileData, fileSize);
+        RL_FREE(fileData);
+    }
     else TRACELOG(LOG_WARNING, "IMAGE: Export image format requested not supported");
 
     if (allocatedData) RL_FREE(imgData);
@@ -709,17 +1273,31 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
 
     if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return fileData; // Security check
 
-    int channels = 4;
-
-    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-
 #if SUPPORT_IMAGE_EXPORT
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
-        fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        int channels = 4;
+        bool allocatedData = false;
+        unsigned char *imgData = (unsigned char *)image.data;
+
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+        else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+        else
+        {
+            // NOTE: Getting Color array as RGBA unsigned char values
+            imgData = (unsigned char *)LoadImageColors(image);
+            allocatedData = true;
+        }
+
+#if SUPPORT_FILEFORMAT_PNG
+        fileData = EncodePNG(imgData, image.width, image.height, channels, imageCompressionLevel, dataSize);
+#else
+        // NOTE: Multi-threaded PNG encoder requires SUPPORT_FILEFORMAT_PNG, stb_image_write used instead
+        fileData = stbi_write_png_to_mem(imgData, image.width*channels, image.width, image.height, channels, dataSize);
+#endif
+        if (allocatedData) RL_FREE(imgData);
     }
 #else
     TRACELOG(LOG_WARNING, "IMAGE: To export image, enable flag SUPPORT_IMAGE_EXPORT");
@@ -781,1837 +1359,1913 @@ bool ExportImageAsCode(Image image, const char *fileName)
     return result;
 }
 
-//------------------------------------------------------------------------------------
-// Image generation functions
-//------------------------------------------------------------------------------------
-// Generate image: plain color
-Image GenImageColor(int width, int height, Color color)
-{
-    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
-
-    for (int i = 0; i < width*height; i++) pixels[i] = color;
-
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
-
-    return image;
-}
-
-#if SUPPORT_IMAGE_GENERATION
-// Generate image: linear gradient
-// The direction value specifies the direction of the gradient (in degrees)
-// with 0 being vertical (from top to bottom), 90 being horizontal (from left to right)
-// The gradient effectively rotates counter-clockwise by the specified amount
-Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end)
+// Export image data to file on a background thread, returns true if export started
+// NOTE: Image data and file name are copied, export runs synchronously if threads are not supported
+bool ExportImageAsync(Image image, const char *fileName)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    bool result = false;
 
-    float radianDirection = (float)(90 - direction)/180.f*3.14159f;
-    float cosDir = cosf(radianDirection);
-    float sinDir = sinf(radianDirection);
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL) || (fileName == NULL)) return result; // Security check
 
-    // Calculate how far the top-left pixel is along the gradient direction from the center of said gradient
-    float startingPos = 0.5f - (cosDir*width/2) - (sinDir*height/2);
+    // Wait for oldest export if all tasks are running
+    ImageExportTask *task = &imageExportTasks[imageExportTaskIndex];
+    imageExportTaskIndex = (imageExportTaskIndex + 1)%IMAGE_EXPORT_MAX_TASKS;
 
-    // With directions that lie in the first or third quadrant (i.e. from top-left to
-    // bottom-right or vice-versa), pixel (0, 0) is the farthest point on the gradient
-    // (i.e. the pixel which should become one of the gradient's ends color); while for
-    // directions that lie in the second or fourth quadrant, that point is pixel (width, 0)
-    float maxPosValue = ((signbit(sinDir) != 0) == (signbit(cosDir) != 0))? fabsf(startingPos) : fabsf(startingPos + width*cosDir);
-    for (int i = 0; i < width; i++)
+    if (task->active)
     {
-        for (int j = 0; j < height; j++)
-        {
-            // Calculate the relative position of the pixel along the gradient direction
-            float pos = (startingPos + (i*cosDir + j*sinDir))/maxPosValue;
+        JoinImageThread(&task->thread);
+        task->active = false;
+    }
 
-            float factor = pos;
-            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [-1,1]
-            factor = (factor < -1.0f)? -1.0f : factor;  // Clamp to [-1,1]
-            factor = factor/2.0f + 0.5f;
+    task->image = ImageCopy(image);
+    task->fileName = (char *)RL_CALLOC(strlen(fileName) + 1, 1);
+    strcpy(task->fileName, fileName);
 
-            // Generate the color for this pixel
-            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
-            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
-            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
-            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
-        }
+    if (StartImageThread(&task->thread, ExportImageTask, task))
+    {
+        task->active = true;
+        result = true;
     }
+    else
+    {
+        // Exporting on calling thread if thread can not be created
+        result = ExportImage(task->image, task->fileName);
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
+        RL_FREE(task->image.data);      // Image copy is never memory-mapped
+        RL_FREE(task->fileName);
+    }
 
-    return image;
+    return result;
 }
 
-// Generate image: radial gradient
-Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+// Wait for asynchronous image exports to finish
+void WaitImageExports(void)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
-
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
+    for (int i = 0; i < IMAGE_EXPORT_MAX_TASKS; i++)
     {
-        for (int x = 0; x < width; x++)
+        if (imageExportTasks[i].active)
         {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
-
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // Distance can be bigger than radius, so it needs to be checked
-
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+            JoinImageThread(&imageExportTasks[i].thread);
+            imageExportTasks[i].active = false;
         }
     }
+}
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
+// Set image export compression level
+// NOTE: PNG compression level: 0 (store-only, fastest) to 9 (smallest size), 6 by default
+void SetImageCompressionLevel(int level)
+{
+    if (level < 0) level = 0;
+    if (level > 9) level = 9;
 
-    return image;
+    imageCompressionLevel = level;
 }
 
-// Generate image: square gradient
-Image GenImageGradientSquare(int width, int height, float density, Color inner, Color outer)
+//------------------------------------------------------------------------------------
+// Image streaming functions
+//------------------------------------------------------------------------------------
+// Load image stream from file
+// NOTE: PNG (non-interlaced) and QOI images are decoded on demand row-by-row,
+// other file formats are fully decoded into memory on loading
+ImageStream LoadImageStream(const char *fileName)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    ImageStream stream = { 0 };
+    bool streamLoaded = false;
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
+    ImageStreamContext *ctx = (ImageStreamContext *)RL_CALLOC(1, sizeof(ImageStreamContext));
 
-    for (int y = 0; y < height; y++)
+    if (false) { }
+#if SUPPORT_FILEFORMAT_PNG
+    else if (IsFileExtension(fileName, ".png"))
     {
-        for (int x = 0; x < width; x++)
-        {
-            // Calculate the Manhattan distance from the center
-            float distX = fabsf(x - centerX);
-            float distY = fabsf(y - centerY);
-
-            // Normalize the distances by the dimensions of the gradient rectangle
-            float normalizedDistX = distX/centerX;
-            float normalizedDistY = distY/centerY;
+        ctx->file = fopen(fileName, "rb");
 
-            // Calculate the total normalized Manhattan distance
-            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
+        if (ctx->file != NULL)
+        {
+            ctx->buffer = (unsigned char *)RL_MALLOC(IMAGE_STREAM_BUFFER_SIZE);
 
-            // Subtract the density from the manhattanDist, then divide by (1 - density)
-            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
-            float factor = (manhattanDist - density)/(1.0f - density);
+            if (OpenImageStreamPNG(ctx))
+            {
+                stream.ctxType = IMAGE_STREAM_PNG;
+                streamLoaded = true;
+            }
+            else
+            {
+                // File could be interlaced or not supported for streaming, fallback to memory loading
+                RL_FREE(ctx->rowPrevious);
+                RL_FREE(ctx->rowCurrent);
+                RL_FREE(ctx->inflate);
+                RL_FREE(ctx->buffer);
+                fclose(ctx->file);
+                memset(ctx, 0, sizeof(ImageStreamContext));
+            }
+        }
+    }
+#endif
+#if SUPPORT_FILEFORMAT_QOI
+    else if (IsFileExtension(fileName, ".qoi"))
+    {
+        ctx->file = fopen(fileName, "rb");
 
-            // Clamp the factor between 0 and 1
-            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+        if (ctx->file != NULL)
+        {
+            ctx->buffer = (unsigned char *)RL_MALLOC(IMAGE_STREAM_BUFFER_SIZE);
 
-            // Blend the colors based on the calculated factor
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+            if (OpenImageStreamQOI(ctx))
+            {
+                stream.ctxType = IMAGE_STREAM_QOI;
+                streamLoaded = true;
+            }
+            else
+            {
+                RL_FREE(ctx->buffer);
+                fclose(ctx->file);
+                ctx->file = NULL;
+                ctx->buffer = NULL;
+            }
         }
     }
+#endif
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
+    if (!streamLoaded && FileExists(fileName))
+    {
+        // Image format not supporting streaming, full image is loaded into memory
+        Image image = LoadImage(fileName);
 
-    return image;
+        if (IsImageValid(image) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: [%s] Image format does not support streaming, image fully loaded", fileName);
+
+            ctx->image = image;
+            ctx->width = image.width;
+            ctx->height = image.height;
+            ctx->format = image.format;
+            stream.ctxType = IMAGE_STREAM_MEMORY;
+            streamLoaded = true;
+        }
+        else UnloadImage(image);
+    }
+
+    if (streamLoaded)
+    {
+        ctx->rowSize = GetPixelDataSize(ctx->width, 1, ctx->format);
+
+        stream.width = ctx->width;
+        stream.height = ctx->height;
+        stream.format = ctx->format;
+        stream.ctxData = ctx;
+
+        TRACELOG(LOG_INFO, "IMAGE: [%s] Image stream loaded successfully (%ix%i | %s)", fileName, stream.width, stream.height, rlGetPixelFormatName(stream.format));
+    }
+    else
+    {
+        RL_FREE(ctx);
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to load image stream", fileName);
+    }
+
+    return stream;
 }
 
-// Generate image: checked
-Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+// Load image stream from RAW file data
+// NOTE: Rows are read directly from file, any row can be accessed at same cost
+ImageStream LoadImageStreamRaw(const char *fileName, int width, int height, int format, int headerSize)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    ImageStream stream = { 0 };
 
-    for (int y = 0; y < height; y++)
+    if ((width <= 0) || (height <= 0) || (format <= 0) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (headerSize < 0))
     {
-        for (int x = 0; x < width; x++)
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Invalid RAW image stream parameters", fileName);
+        return stream;
+    }
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long fileSize = ftell(file);
+
+        if (((long)headerSize + (long)GetPixelDataSize(width, 1, format)*height) <= fileSize)   // Security check
         {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
+            ImageStreamContext *ctx = (ImageStreamContext *)RL_CALLOC(1, sizeof(ImageStreamContext));
+            ctx->file = file;
+            ctx->dataOffset = headerSize;
+            ctx->width = width;
+            ctx->height = height;
+            ctx->format = format;
+            ctx->rowSize = GetPixelDataSize(width, 1, format);
+
+            stream.width = width;
+            stream.height = height;
+            stream.format = format;
+            stream.ctxType = IMAGE_STREAM_RAW;
+            stream.ctxData = ctx;
+
+            TRACELOG(LOG_INFO, "IMAGE: [%s] Image stream loaded successfully (%ix%i | %s)", fileName, width, height, rlGetPixelFormatName(format));
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: [%s] RAW image data size smaller than expected", fileName);
+            fclose(file);
         }
     }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
+    return stream;
+}
 
-    return image;
+// Check if an image stream is valid (context and parameters)
+bool IsImageStreamValid(ImageStream stream)
+{
+    return ((stream.ctxData != NULL) &&     // Validate context loaded
+            (stream.ctxType > 0) &&         // Validate context type
+            (stream.width > 0) &&           // Validate image width
+            (stream.height > 0) &&          // Validate image height
+            (stream.format > 0));           // Validate image format
 }
 
-// Generate image: white noise
-// NOTE: It requires GetRandomValue(), defined in [rcore]
-Image GenImageWhiteNoise(int width, int height, float factor)
+// Unload image stream, closing file
+void UnloadImageStream(ImageStream stream)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    ImageStreamContext *ctx = (ImageStreamContext *)stream.ctxData;
 
-    for (int i = 0; i < width*height; i++)
+    if (ctx != NULL)
     {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
+        if (ctx->file != NULL) fclose(ctx->file);
+
+        UnloadImage(ctx->image);
+        RL_FREE(ctx->rowPrevious);
+        RL_FREE(ctx->rowCurrent);
+        RL_FREE(ctx->inflate);
+        RL_FREE(ctx->buffer);
+        RL_FREE(ctx);
+    }
+}
+
+// Load a range of image rows from image stream
+// NOTE: Sequential streams (PNG, QOI) restart decoding if rows are requested backwards
+Image LoadImageStreamRows(ImageStream stream, int startRow, int rowCount)
+{
+    Image image = { 0 };
+
+    if (!IsImageStreamValid(stream)) return image;
+
+    // Security checks to validate rows range
+    if (startRow < 0) { rowCount += startRow; startRow = 0; }
+    if ((startRow + rowCount) > stream.height) rowCount = stream.height - startRow;
+    if (rowCount <= 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to load image stream rows, range out of bounds");
+        return image;
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
+    ImageStreamContext *ctx = (ImageStreamContext *)stream.ctxData;
+
+    image.data = RL_MALLOC((size_t)rowCount*ctx->rowSize);
+
+    if ((image.data != NULL) && ReadImageStreamRows(ctx, stream.ctxType, startRow, rowCount, (unsigned char *)image.data))
+    {
+        image.width = stream.width;
+        image.height = rowCount;
+        image.format = stream.format;
+        image.mipmaps = 1;
+    }
+    else
+    {
+        RL_FREE(image.data);
+        image.data = NULL;
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to decode image stream rows");
+    }
 
     return image;
 }
 
-// Generate image: perlin noise
-Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
+// Create an image from an image stream piece
+// NOTE: Only one image row is decoded at a time
+Image ImageFromImageStream(ImageStream stream, Rectangle rec)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    Image result = { 0 };
 
-    float aspectRatio = (float)width/(float)height;
+    if (!IsImageStreamValid(stream)) return result;
 
-    for (int y = 0; y < height; y++)
+    // Security checks to validate rectangle
+    if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
+    if (rec.y < 0) { rec.height += rec.y; rec.y = 0; }
+    if ((rec.x + rec.width) > stream.width) rec.width = stream.width - rec.x;
+    if ((rec.y + rec.height) > stream.height) rec.height = stream.height - rec.y;
+    if (((int)rec.width <= 0) || ((int)rec.height <= 0))
     {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to get image stream piece, rectangle out of bounds");
+        return result;
+    }
 
-            // Apply aspect ratio compensation to wider side
-            if (width > height) nx *= aspectRatio;
-            else ny /= aspectRatio;
+    ImageStreamContext *ctx = (ImageStreamContext *)stream.ctxData;
+    int bytesPerPixel = GetPixelDataSize(1, 1, stream.format);
+    unsigned char *row = (unsigned char *)RL_MALLOC(ctx->rowSize);
 
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+    result.data = RL_MALLOC((int)rec.width*(int)rec.height*bytesPerPixel);
 
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+    for (int y = 0; y < (int)rec.height; y++)
+    {
+        if (!ReadImageStreamRows(ctx, stream.ctxType, (int)rec.y + y, 1, row))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to decode image stream rows");
+            RL_FREE(result.data);
+            result.data = NULL;
+            break;
+        }
 
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
+        memcpy((unsigned char *)result.data + y*(int)rec.width*bytesPerPixel, row + (int)rec.x*bytesPerPixel, (int)rec.width*bytesPerPixel);
+    }
 
-            // Data needs to be normalized from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+    RL_FREE(row);
 
-            unsigned char intensity = (unsigned char)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
+    if (result.data != NULL)
+    {
+        result.width = (int)rec.width;
+        result.height = (int)rec.height;
+        result.format = stream.format;
+        result.mipmaps = 1;
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
-
-    return image;
+    return result;
 }
 
-// Generate image: cellular algorithm. Bigger tileSize means bigger cells
-Image GenImageCellular(int width, int height, int tileSize)
+// Create a resized image from an image stream
+// NOTE: Box filter (area-average) used for downscaling and bilinear filter for upscaling,
+// only the source rows required by the filter are kept in memory
+Image ImageResizeStream(ImageStream stream, int newWidth, int newHeight)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-
-    int seedsPerRow = width/tileSize;
-    int seedsPerCol = height/tileSize;
-    int seedCount = seedsPerRow*seedsPerCol;
+    Image result = { 0 };
 
-    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
+    if (!IsImageStreamValid(stream) || (newWidth <= 0) || (newHeight <= 0)) return result;
 
-    for (int i = 0; i < seedCount; i++)
-    {
-        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        seeds[i] = (Vector2){ (float)x, (float)y };
-    }
+    ImageStreamContext *ctx = (ImageStreamContext *)stream.ctxData;
 
-    for (int y = 0; y < height; y++)
+    // Images with 8 bit per channel are resized directly, any other format is converted to RGBA
+    int channels = 4;
+    if (stream.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (stream.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (stream.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+
+    int *firstX = NULL;
+    int *firstY = NULL;
+    float *weightsX = NULL;
+    float *weightsY = NULL;
+    int tapsX = LoadResampleWeights(stream.width, newWidth, &firstX, &weightsX);
+    int tapsY = LoadResampleWeights(stream.height, newHeight, &firstY, &weightsY);
+
+    // Ring of horizontally resampled source rows, one per vertical filter tap
+    float *ring = (float *)RL_CALLOC(tapsY*newWidth*channels, sizeof(float));
+    unsigned char *srcRow = (unsigned char *)RL_MALLOC(stream.width*channels);
+    unsigned char *rowData = (unsigned char *)RL_MALLOC(ctx->rowSize);
+    unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*channels);
+    int loadedRows = 0;
+    bool success = true;
+
+    for (int y = 0; (y < newHeight) && success; y++)
     {
-        int tileY = y/tileSize;
+        int lastRow = firstY[y] + tapsY - 1;
+        if (lastRow > (stream.height - 1)) lastRow = stream.height - 1;
 
-        for (int x = 0; x < width; x++)
+        // Load required source rows, previous rows are not required anymore
+        while (loadedRows <= lastRow)
         {
-            int tileX = x/tileSize;
+            if (!ReadImageStreamRowsColor(ctx, stream.ctxType, loadedRows, 1, srcRow, rowData, channels)) { success = false; break; }
 
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+            float *dst = ring + (loadedRows%tapsY)*newWidth*channels;
 
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
+            for (int x = 0; x < newWidth; x++)
             {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
+                for (int c = 0; c < channels; c++)
                 {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+                    float value = 0.0f;
 
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+                    for (int t = 0; t < tapsX; t++)
+                    {
+                        int srcX = firstX[x] + t;
+                        if (srcX >= stream.width) break;
+                        value += weightsX[x*tapsX + t]*srcRow[srcX*channels + c];
+                    }
 
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
+                    dst[x*channels + c] = value;
                 }
             }
 
-            // This approach seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            unsigned char intensityUC = (unsigned char)intensity;
-            pixels[y*width + x] = (Color){ intensityUC, intensityUC, intensityUC, 255 };
+            loadedRows++;
         }
-    }
 
-    RL_FREE(seeds);
+        for (int x = 0; (x < newWidth) && success; x++)
+        {
+            for (int c = 0; c < channels; c++)
+            {
+                float value = 0.0f;
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .mipmaps = 1,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-    };
+                for (int t = 0; t < tapsY; t++)
+                {
+                    int srcY = firstY[y] + t;
+                    if (srcY >= stream.height) break;
+                    value += weightsY[y*tapsY + t]*ring[(srcY%tapsY)*newWidth*channels + x*channels + c];
+                }
 
-    return image;
-}
+                value += 0.5f;
+                output[(y*newWidth + x)*channels + c] = (value > 255.0f)? 255 : ((value < 0.0f)? 0 : (unsigned char)value);
+            }
+        }
+    }
 
-// Generate image: grayscale image from text data
-Image GenImageText(int width, int height, const char *text)
-{
-    Image image = { 0 };
+    RL_FREE(firstX);
+    RL_FREE(firstY);
+    RL_FREE(weightsX);
+    RL_FREE(weightsY);
+    RL_FREE(ring);
+    RL_FREE(srcRow);
+    RL_FREE(rowData);
 
-    int imageSize = width*height;
-    image.width = width;
-    image.height = height;
-    image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    image.data = RL_CALLOC(imageSize, 1);
-    image.mipmaps = 1;
+    if (success)
+    {
+        result.data = output;
+        result.width = newWidth;
+        result.height = newHeight;
+        result.mipmaps = 1;
 
-    if (text != NULL)
+        switch (channels)
+        {
+            case 1: result.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
+            case 2: result.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
+            case 3: result.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
+            default: result.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
+        }
+
+        ImageFormat(&result, stream.format);    // Reformat 32bit RGBA image to original format (if required)
+    }
+    else
     {
-        int textLength = (int)strlen(text);
-        memcpy(image.data, text, (textLength > imageSize)? imageSize : textLength);
+        RL_FREE(output);
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to decode image stream rows");
     }
 
-    return image;
+    return result;
 }
-#endif // SUPPORT_IMAGE_GENERATION
 
-//------------------------------------------------------------------------------------
-// Image manipulation functions
-//------------------------------------------------------------------------------------
-// Copy an image to a new image
-Image ImageCopy(Image image)
+// Export image stream data to file row-by-row
+// NOTE: Only a band of rows is kept in memory, supported formats: .png, .qoi, .raw
+bool ExportImageStream(ImageStream stream, const char *fileName)
 {
-    Image newImage = { 0 };
+    bool result = false;
 
-    int width = image.width;
-    int height = image.height;
-    int size = 0;
+    if (!IsImageStreamValid(stream)) return result;
 
-    for (int i = 0; i < image.mipmaps; i++)
+#if SUPPORT_IMAGE_EXPORT
+    ImageStreamContext *ctx = (ImageStreamContext *)stream.ctxData;
+
+    if (false) { } // Required to attach following 'else' cases
+#if SUPPORT_FILEFORMAT_PNG
+    else if (IsFileExtension(fileName, ".png"))
     {
-        size += GetPixelDataSize(width, height, image.format);
+        // PNG is exported with 8 bit per channel, other formats are converted to RGBA
+        int channels = 4;
+        int colorType = 6;
+        if (stream.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) { channels = 1; colorType = 0; }
+        else if (stream.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) { channels = 2; colorType = 4; }
+        else if (stream.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) { channels = 3; colorType = 2; }
+
+        int rowSize = stream.width*channels;
+        int bandRows = IMAGE_STREAM_BAND_SIZE/rowSize;
+        if (bandRows < 1) bandRows = 1;
+
+        unsigned char *band = (unsigned char *)RL_MALLOC(bandRows*rowSize);
+        unsigned char *previousRow = (unsigned char *)RL_MALLOC(rowSize);
+        unsigned char *rowData = (unsigned char *)RL_MALLOC(ctx->rowSize);
+        unsigned char *chunk = (unsigned char *)RL_MALLOC(GetPngBandBound(bandRows, rowSize) + 14);
+        unsigned int adler = 1;
+
+        FILE *file = fopen(fileName, "wb");
+
+        if (file != NULL)
+        {
+            static const unsigned char signature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+            result = (fwrite(signature, 1, 8, file) == 8);
+
+            unsigned char *header = chunk + 8;
+            header[0] = (unsigned char)(stream.width >> 24); header[1] = (unsigned char)(stream.width >> 16);
+            header[2] = (unsigned char)(stream.width >> 8); header[3] = (unsigned char)stream.width;
+            header[4] = (unsigned char)(stream.height >> 24); header[5] = (unsigned char)(stream.height >> 16);
+            header[6] = (unsigned char)(stream.height >> 8); header[7] = (unsigned char)stream.height;
+            header[8] = 8;                  // Bit depth
+            header[9] = (unsigned char)colorType;
+            header[10] = 0;                 // Compression method: DEFLATE
+            header[11] = 0;                 // Filter method: adaptive
+            header[12] = 0;                 // Interlace method: none
+            int chunkSize = SetPngChunk(chunk, "IHDR", 13);
+            if (result) result = (fwrite(chunk, 1, chunkSize, file) == (size_t)chunkSize);
+
+            for (int y = 0; (y < stream.height) && result; y += bandRows)
+            {
+                int rowCount = ((y + bandRows) > stream.height)? (stream.height - y) : bandRows;
 
-        width /= 2;
-        height /= 2;
+                result = ReadImageStreamRowsColor(ctx, stream.ctxType, y, rowCount, band, rowData, channels);
 
-        // Security check for NPOT textures
-        if (width < 1) width = 1;
-        if (height < 1) height = 1;
-    }
+                if (result)
+                {
+                    int dataSize = 0;
 
-    newImage.data = RL_CALLOC(size, 1);
+                    // zlib stream header (DEFLATE, 32KB window) at the beginning of image data
+                    if (y == 0) { chunk[8] = 0x78; chunk[9] = 0x01; dataSize = 2; }
 
-    if (newImage.data != NULL)
-    {
-        // NOTE: Size must be provided in bytes
-        memcpy(newImage.data, image.data, size);
-
-        newImage.width = image.width;
-        newImage.height = image.height;
-        newImage.mipmaps = image.mipmaps;
-        newImage.format = image.format;
-    }
-
-    return newImage;
-}
-
-// Create an image from another image piece
-Image ImageFromImage(Image image, Rectangle rec)
-{
-    Image result = { 0 };
-
-    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+                    dataSize += CompressPngBand(band, rowCount, rowSize, channels, (y == 0)? NULL : previousRow, chunk + 8 + dataSize, imageCompressionLevel, &adler);
+                    chunkSize = SetPngChunk(chunk, "IDAT", dataSize);
+                    result = (fwrite(chunk, 1, chunkSize, file) == (size_t)chunkSize);
 
-    result.width = (int)rec.width;
-    result.height = (int)rec.height;
-    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
-    result.format = image.format;
-    result.mipmaps = 1;
+                    memcpy(previousRow, band + (rowCount - 1)*rowSize, rowSize);
+                }
+            }
 
-    for (int y = 0; y < (int)rec.height; y++)
-    {
-        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
-    }
+            // Final empty DEFLATE block (fixed codes) and zlib stream checksum
+            unsigned char *data = chunk + 8;
+            data[0] = 0x03; data[1] = 0x00;
+            data[2] = (unsigned char)(adler >> 24); data[3] = (unsigned char)(adler >> 16);
+            data[4] = (unsigned char)(adler >> 8); data[5] = (unsigned char)adler;
+            chunkSize = SetPngChunk(chunk, "IDAT", 6);
+            if (result) result = (fwrite(chunk, 1, chunkSize, file) == (size_t)chunkSize);
 
-    return result;
-}
+            chunkSize = SetPngChunk(chunk, "IEND", 0);
+            if (result) result = (fwrite(chunk, 1, chunkSize, file) == (size_t)chunkSize);
 
-// Crop an image to area defined by a rectangle
-// NOTE: Security checks are performed in case rectangle goes out of bounds
-void ImageCrop(Image *image, Rectangle crop)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+            fclose(file);
+        }
 
-    // Security checks to validate crop rectangle
-    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
-    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
-    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
-    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
-    if ((crop.x > image->width) || (crop.y > image->height))
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
-        return;
+        RL_FREE(band);
+        RL_FREE(previousRow);
+        RL_FREE(rowData);
+        RL_FREE(chunk);
     }
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+#endif
+#if SUPPORT_FILEFORMAT_QOI
+    else if (IsFileExtension(fileName, ".qoi"))
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-
-        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
+        int channels = 0;
+        if (stream.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+        else if (stream.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
 
-        // OPTION 1: Move cropped data line-by-line
-        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
-        {
-            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
-            offsetSize += ((int)crop.width*bytesPerPixel);
-        }
+        FILE *file = (channels > 0)? fopen(fileName, "wb") : NULL;
 
-        /*
-        // OPTION 2: Move cropped data pixel-by-pixel or byte-by-byte
-        for (int y = (int)crop.y; y < (int)(crop.y + crop.height); y++)
+        if (file != NULL)
         {
-            for (int x = (int)crop.x; x < (int)(crop.x + crop.width); x++)
+            int bandRows = IMAGE_STREAM_BAND_SIZE/ctx->rowSize;
+            if (bandRows < 1) bandRows = 1;
+
+            unsigned char *band = (unsigned char *)RL_MALLOC(bandRows*ctx->rowSize);
+            unsigned char *output = (unsigned char *)RL_MALLOC(bandRows*stream.width*(channels + 1) + 14);  // Worst case: one extra byte per pixel
+            unsigned char index[64*4] = { 0 };
+            unsigned char previous[4] = { 0, 0, 0, 255 };
+            unsigned char pixel[4] = { 0, 0, 0, 255 };
+            int pixelCount = stream.width*stream.height;
+            int pixelPos = 0;
+            int run = 0;
+
+            // QOI header: magic, width, height, channels, colorspace
+            output[0] = 'q'; output[1] = 'o'; output[2] = 'i'; output[3] = 'f';
+            output[4] = (unsigned char)(stream.width >> 24); output[5] = (unsigned char)(stream.width >> 16);
+            output[6] = (unsigned char)(stream.width >> 8); output[7] = (unsigned char)stream.width;
+            output[8] = (unsigned char)(stream.height >> 24); output[9] = (unsigned char)(stream.height >> 16);
+            output[10] = (unsigned char)(stream.height >> 8); output[11] = (unsigned char)stream.height;
+            output[12] = (unsigned char)channels;
+            output[13] = QOI_SRGB;
+            result = (fwrite(output, 1, 14, file) == 14);
+
+            for (int y = 0; (y < stream.height) && result; y += bandRows)
             {
-                //memcpy(croppedData + ((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) croppedData[((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
-        */
-
-        RL_FREE(image->data);
-        image->data = croppedData;
-        image->width = (int)crop.width;
-        image->height = (int)crop.height;
-    }
-}
+                int rowCount = ((y + bandRows) > stream.height)? (stream.height - y) : bandRows;
+                int size = 0;
 
-// Convert image data to desired format
-void ImageFormat(Image *image, int newFormat)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if ((newFormat != 0) && (image->format != newFormat))
-    {
-        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
-        {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
-
-            RL_FREE(image->data);      // WARNING! Loosing mipmaps data --> Regenerated at the end
-            image->data = NULL;
-            image->format = newFormat;
+                result = ReadImageStreamRows(ctx, stream.ctxType, y, rowCount, band);
 
-            switch (image->format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                for (int i = 0; (i < rowCount*stream.width) && result; i++, pixelPos++)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+                    memcpy(pixel, band + i*channels, channels);
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    if (memcmp(pixel, previous, 4) == 0)
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                        run++;
+                        if ((run == 62) || (pixelPos == (pixelCount - 1)))
+                        {
+                            output[size++] = (unsigned char)(0xc0 | (run - 1));
+                            run = 0;
+                        }
                     }
+                    else
+                    {
+                        if (run > 0)
+                        {
+                            output[size++] = (unsigned char)(0xc0 | (run - 1));
+                            run = 0;
+                        }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+                        int hash = (pixel[0]*3 + pixel[1]*5 + pixel[2]*7 + pixel[3]*11)%64;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                        if (memcmp(index + hash*4, pixel, 4) == 0) output[size++] = (unsigned char)hash;
+                        else
+                        {
+                            memcpy(index + hash*4, pixel, 4);
+
+                            if (pixel[3] == previous[3])
+                            {
+                                signed char vr = (signed char)(pixel[0] - previous[0]);
+                                signed char vg = (signed char)(pixel[1] - previous[1]);
+                                signed char vb = (signed char)(pixel[2] - previous[2]);
+                                signed char vgr = vr - vg;
+                                signed char vgb = vb - vg;
+
+                                if ((vr > -3) && (vr < 2) && (vg > -3) && (vg < 2) && (vb > -3) && (vb < 2))
+                                {
+                                    output[size++] = (unsigned char)(0x40 | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2));
+                                }
+                                else if ((vgr > -9) && (vgr < 8) && (vg > -33) && (vg < 32) && (vgb > -9) && (vgb < 8))
+                                {
+                                    output[size++] = (unsigned char)(0x80 | (vg + 32));
+                                    output[size++] = (unsigned char)(((vgr + 8) << 4) | (vgb + 8));
+                                }
+                                else
+                                {
+                                    output[size++] = 0xfe;
+                                    output[size++] = pixel[0];
+                                    output[size++] = pixel[1];
+                                    output[size++] = pixel[2];
+                                }
+                            }
+                            else
+                            {
+                                output[size++] = 0xff;
+                                memcpy(output + size, pixel, 4);
+                                size += 4;
+                            }
+                        }
                     }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                    memcpy(previous, pixel, 4);
+                }
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+                if (result) result = (fwrite(output, 1, size, file) == (size_t)size);
+            }
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+            // QOI stream end marker
+            static const unsigned char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+            if (result) result = (fwrite(padding, 1, 8, file) == 8);
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+            RL_FREE(band);
+            RL_FREE(output);
+            fclose(file);
+        }
+    }
+#endif
+    else if (IsFileExtension(fileName, ".raw"))
+    {
+        // Export raw pixel data (without header)
+        // NOTE: It's up to the user to track image parameters
+        FILE *file = fopen(fileName, "wb");
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+        if (file != NULL)
+        {
+            int bandRows = IMAGE_STREAM_BAND_SIZE/ctx->rowSize;
+            if (bandRows < 1) bandRows = 1;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+            unsigned char *band = (unsigned char *)RL_MALLOC(bandRows*ctx->rowSize);
+            result = true;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+            for (int y = 0; (y < stream.height) && result; y += bandRows)
+            {
+                int rowCount = ((y + bandRows) > stream.height)? (stream.height - y) : bandRows;
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                result = ReadImageStreamRows(ctx, stream.ctxType, y, rowCount, band);
+                if (result) result = (fwrite(band, ctx->rowSize, rowCount, file) == (size_t)rowCount);
+            }
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+            RL_FREE(band);
+            fclose(file);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Export image format requested not supported");
+#endif // SUPPORT_IMAGE_EXPORT
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    if (result) TRACELOG(LOG_INFO, "FILEIO: [%s] Image stream exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image stream", fileName);
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+    return result;
+}
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+//------------------------------------------------------------------------------------
+// Image generation functions
+//------------------------------------------------------------------------------------
+// Generate image: plain color
+Image GenImageColor(int width, int height, Color color)
+{
+    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+    for (int i = 0; i < width*height; i++) pixels[i] = color;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+    return image;
+}
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+#if SUPPORT_IMAGE_GENERATION
+// Generate image: linear gradient
+// The direction value specifies the direction of the gradient (in degrees)
+// with 0 being vertical (from top to bottom), 90 being horizontal (from left to right)
+// The gradient effectively rotates counter-clockwise by the specified amount
+Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+    float radianDirection = (float)(90 - direction)/180.f*3.14159f;
+    float cosDir = cosf(radianDirection);
+    float sinDir = sinf(radianDirection);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+    // Calculate how far the top-left pixel is along the gradient direction from the center of said gradient
+    float startingPos = 0.5f - (cosDir*width/2) - (sinDir*height/2);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
-
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
-            }
+    // With directions that lie in the first or third quadrant (i.e. from top-left to
+    // bottom-right or vice-versa), pixel (0, 0) is the farthest point on the gradient
+    // (i.e. the pixel which should become one of the gradient's ends color); while for
+    // directions that lie in the second or fourth quadrant, that point is pixel (width, 0)
+    float maxPosValue = ((signbit(sinDir) != 0) == (signbit(cosDir) != 0))? fabsf(startingPos) : fabsf(startingPos + width*cosDir);
+    for (int i = 0; i < width; i++)
+    {
+        for (int j = 0; j < height; j++)
+        {
+            // Calculate the relative position of the pixel along the gradient direction
+            float pos = (startingPos + (i*cosDir + j*sinDir))/maxPosValue;
 
-            RL_FREE(pixels);
-            pixels = NULL;
+            float factor = pos;
+            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [-1,1]
+            factor = (factor < -1.0f)? -1.0f : factor;  // Clamp to [-1,1]
+            factor = factor/2.0f + 0.5f;
 
-            // In case original image had mipmaps, generate mipmaps for formatted image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
-            {
-                image->mipmaps = 1;
-                if (image->data != NULL) ImageMipmaps(image);
-            }
+            // Generate the color for this pixel
+            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
+            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
+            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
+            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
         }
-        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
-}
 
-// Create an image from text (default font)
-Image ImageText(const char *text, int fontSize, Color color)
-{
-    Image imText = { 0 };
-#if SUPPORT_MODULE_RTEXT
-    int defaultFontSize = 10;   // Default Font chars height in pixel
-    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-    int spacing = fontSize/defaultFontSize;
-    imText = ImageTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing, color);   // WARNING: Module required: rtext
-#else
-    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
-    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
-#endif
-    return imText;
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+
+    return image;
 }
 
-// Create an image from text (custom sprite font)
-// WARNING: Module required: rtext
-Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint)
+// Generate image: radial gradient
+Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
 {
-    Image imText = { 0 };
-#if SUPPORT_MODULE_RTEXT
-    if (text == NULL) return imText;
-
-    int textLength = (int)strlen(text); // Get length of text in bytes
-    int textOffsetX = 0;            // Image drawing position X
-    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
-
-    // NOTE: Text image is generated at font base size, later scaled to desired font size
-    Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
-    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
 
-    // Create image to store text
-    imText = GenImageColor((int)imSize.x, (int)imSize.y, BLANK);
+    float centerX = (float)width/2.0f;
+    float centerY = (float)height/2.0f;
 
-    for (int i = 0; i < textLength;)
+    for (int y = 0; y < height; y++)
     {
-        // Get next codepoint from byte string and glyph index in font
-        int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);    // WARNING: Module required: rtext
-        int index = GetGlyphIndex(font, codepoint);                         // WARNING: Module required: rtext
-
-        if (codepoint == '\n')
-        {
-            // NOTE: Fixed line spacing of 1.5 line-height
-            // TODO: Support custom line spacing defined by user
-            textOffsetY += (font.baseSize + font.baseSize/2);
-            textOffsetX = 0;
-        }
-        else
+        for (int x = 0; x < width; x++)
         {
-            if ((codepoint != ' ') && (codepoint != '\t'))
-            {
-                Rectangle rec = { (float)(textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
-                ImageDraw(&imText, font.glyphs[index].image, (Rectangle){ 0, 0, (float)font.glyphs[index].image.width, (float)font.glyphs[index].image.height }, rec, tint);
-            }
+            float dist = hypotf((float)x - centerX, (float)y - centerY);
+            float factor = (dist - radius*density)/(radius*(1.0f - density));
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
-            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
-        }
+            factor = (float)fmax(factor, 0.0f);
+            factor = (float)fmin(factor, 1.f); // Distance can be bigger than radius, so it needs to be checked
 
-        i += codepointByteCount;   // Move text bytes counter to next codepoint
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
     }
 
-    // Scale image depending on text size
-    if (textSize.y != imSize.y)
-    {
-        float scaleFactor = textSize.y/imSize.y;
-        TRACELOG(LOG_INFO, "IMAGE: Text scaled by factor: %f", scaleFactor);
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
 
-        // Using nearest-neighbor scaling algorithm for default font
-        // TODO: Allow defining the preferred scaling mechanism externally
-        if (font.texture.id == GetFontDefault().texture.id) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
-        else ImageResize(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
-    }
-#else
-    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
-    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
-#endif
-    return imText;
+    return image;
 }
 
-// Create an image from a selected channel of another image
-Image ImageFromChannel(Image image, int selectedChannel)
+// Generate image: square gradient
+Image GenImageGradientSquare(int width, int height, float density, Color inner, Color outer)
 {
-    Image result = { 0 };
-
-    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return result; // Security check
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    // Check selected channel is valid
-    if (selectedChannel < 0)
-    {
-        TRACELOG(LOG_WARNING, "Channel cannot be negative. Setting channel to 0.");
-        selectedChannel = 0;
-    }
+    float centerX = (float)width/2.0f;
+    float centerY = (float)height/2.0f;
 
-    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE ||
-        image.format == PIXELFORMAT_UNCOMPRESSED_R32 ||
-        image.format == PIXELFORMAT_UNCOMPRESSED_R16)
+    for (int y = 0; y < height; y++)
     {
-        if (selectedChannel > 0)
+        for (int x = 0; x < width; x++)
         {
-            TRACELOG(LOG_WARNING, "This image has only 1 channel. Setting channel to it.");
-            selectedChannel = 0;
+            // Calculate the Manhattan distance from the center
+            float distX = fabsf(x - centerX);
+            float distY = fabsf(y - centerY);
+
+            // Normalize the distances by the dimensions of the gradient rectangle
+            float normalizedDistX = distX/centerX;
+            float normalizedDistY = distY/centerY;
+
+            // Calculate the total normalized Manhattan distance
+            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
+
+            // Subtract the density from the manhattanDist, then divide by (1 - density)
+            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
+            float factor = (manhattanDist - density)/(1.0f - density);
+
+            // Clamp the factor between 0 and 1
+            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+
+            // Blend the colors based on the calculated factor
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
         }
     }
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+
+    return image;
+}
+
+// Generate image: checked
+Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    for (int y = 0; y < height; y++)
     {
-        if (selectedChannel > 1)
+        for (int x = 0; x < width; x++)
         {
-            TRACELOG(LOG_WARNING, "This image has only 2 channels. Setting channel to alpha.");
-            selectedChannel = 1;
-        }
-    }
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5 ||
-             image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8 ||
-             image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32 ||
-             image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)
-    {
-        if (selectedChannel > 2)
-        {
-            TRACELOG(LOG_WARNING, "This image has only 3 channels. Setting channel to red.");
-            selectedChannel = 0;
+            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
+            else pixels[y*width + x] = col2;
         }
     }
 
-    // Check for RGBA formats
-    if (selectedChannel > 3)
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+
+    return image;
+}
+
+// Generate image: white noise
+// NOTE: It requires GetRandomValue(), defined in [rcore]
+Image GenImageWhiteNoise(int width, int height, float factor)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    for (int i = 0; i < width*height; i++)
     {
-        TRACELOG(LOG_WARNING, "ImageFromChannel supports channels 0 to 3 (RGBA). Setting channel to alpha.");
-        selectedChannel = 3;
+        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
+        else pixels[i] = BLACK;
     }
 
-    // TODO: Consider other one-channel formats: R16, R32
-    result.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    result.height = image.height;
-    result.width = image.width;
-    result.mipmaps = 1;
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
 
-    unsigned char *pixels = (unsigned char *)RL_CALLOC(image.width*image.height, sizeof(unsigned char)); // Values from 0 to 255
+    return image;
+}
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+// Generate image: perlin noise
+Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    float aspectRatio = (float)width/(float)height;
+
+    for (int y = 0; y < height; y++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        for (int x = 0; x < width; x++)
         {
-            float pixelValue = -1;
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixelValue = (float)((unsigned char *)image.data)[i + selectedChannel]/255.0f;
+            float nx = (float)(x + offsetX)*(scale/(float)width);
+            float ny = (float)(y + offsetY)*(scale/(float)height);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixelValue = (float)((unsigned char *)image.data)[k + selectedChannel]/255.0f;
-                    k += 2;
+            // Apply aspect ratio compensation to wider side
+            if (width > height) nx *= aspectRatio;
+            else ny /= aspectRatio;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            // Basic perlin noise implementation (not used)
+            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
 
-                    if (selectedChannel == 0) pixelValue = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    else if (selectedChannel == 1) pixelValue = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    else if (selectedChannel == 2) pixelValue = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    else if (selectedChannel == 3) pixelValue = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+            // Calculate a better perlin noise using fbm (fractal brownian motion)
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
 
-                    if (selectedChannel == 0) pixelValue = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    else if (selectedChannel == 1) pixelValue = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    else if (selectedChannel == 2) pixelValue = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+            // Data needs to be normalized from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            unsigned char intensity = (unsigned char)(np*255.0f);
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
 
-                    if (selectedChannel == 0) pixelValue = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    else if (selectedChannel == 1) pixelValue = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    else if (selectedChannel == 2) pixelValue = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    else if (selectedChannel == 3) pixelValue = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixelValue = (float)((unsigned char *)image.data)[k + selectedChannel]/255.0f;
-                    k += 4;
+    return image;
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixelValue = (float)((unsigned char *)image.data)[k + selectedChannel]/255.0f;
-                    k += 3;
+// Generate image: cellular algorithm. Bigger tileSize means bigger cells
+Image GenImageCellular(int width, int height, int tileSize)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixelValue = ((float *)image.data)[k];
-                    k += 1;
+    int seedsPerRow = width/tileSize;
+    int seedsPerCol = height/tileSize;
+    int seedCount = seedsPerRow*seedsPerCol;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixelValue = ((float *)image.data)[k + selectedChannel];
-                    k += 3;
+    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixelValue = ((float *)image.data)[k + selectedChannel];
-                    k += 4;
+    for (int i = 0; i < seedCount; i++)
+    {
+        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[i] = (Vector2){ (float)x, (float)y };
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k]);
-                    k += 1;
+    for (int y = 0; y < height; y++)
+    {
+        int tileY = y/tileSize;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k+selectedChannel]);
-                    k += 3;
+        for (int x = 0; x < width; x++)
+        {
+            int tileX = x/tileSize;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
                 {
-                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k + selectedChannel]);
-                    k += 4;
+                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
 
-                } break;
-                default: break;
+                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+
+                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
+                    minDistance = (float)fmin(minDistance, dist);
+                }
             }
 
-            pixels[i] = (unsigned char)(pixelValue*255);
+            // This approach seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            unsigned char intensityUC = (unsigned char)intensity;
+            pixels[y*width + x] = (Color){ intensityUC, intensityUC, intensityUC, 255 };
         }
     }
 
-    result.data = pixels;
+    RL_FREE(seeds);
 
-    return result;
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+
+    return image;
 }
 
-// Resize and image to new size using Nearest-Neighbor scaling algorithm
-void ImageResizeNN(Image *image, int newWidth, int newHeight)
+// Generate image: grayscale image from text data
+Image GenImageText(int width, int height, const char *text)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = LoadImageColors(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+    Image image = { 0 };
 
-    // EDIT: added +1 to account for an early rounding problem
-    int xRatio = (int)((image->width << 16)/newWidth) + 1;
-    int yRatio = (int)((image->height << 16)/newHeight) + 1;
+    int imageSize = width*height;
+    image.width = width;
+    image.height = height;
+    image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    image.data = RL_CALLOC(imageSize, 1);
+    image.mipmaps = 1;
 
-    int x2 = 0;
-    int y2 = 0;
-    for (int y = 0; y < newHeight; y++)
+    if (text != NULL)
     {
-        for (int x = 0; x < newWidth; x++)
-        {
-            x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
-
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
-        }
+        int textLength = (int)strlen(text);
+        memcpy(image.data, text, (textLength > imageSize)? imageSize : textLength);
     }
 
-    int format = image->format;
-
-    RL_FREE(image->data);
-
-    image->data = output;
-    image->width = newWidth;
-    image->height = newHeight;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    UnloadImageColors(pixels);
+    return image;
 }
+#endif // SUPPORT_IMAGE_GENERATION
 
-// Resize and image to new size
-// NOTE: Uses stb default scaling filters (both bicubic):
-// STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
-// STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
-void ImageResize(Image *image, int newWidth, int newHeight)
+//------------------------------------------------------------------------------------
+// Image manipulation functions
+//------------------------------------------------------------------------------------
+// Copy an image to a new image
+Image ImageCopy(Image image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    Image newImage = { 0 };
 
-    // Check if a fast path can be used on image scaling
-    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
-    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    int width = image.width;
+    int height = image.height;
+    int size = 0;
+
+    for (int i = 0; i < image.mipmaps; i++)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+        size += GetPixelDataSize(width, height, image.format);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        width /= 2;
+        height /= 2;
 
-        RL_FREE(image->data);
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
     }
-    else
+
+    newImage.data = RL_CALLOC(size, 1);
+
+    if (newImage.data != NULL)
     {
-        // Get data as Color pixels array to work with it
-        Color *pixels = LoadImageColors(*image);
-        Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+        // NOTE: Size must be provided in bytes
+        memcpy(newImage.data, image.data, size);
 
-        // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        newImage.width = image.width;
+        newImage.height = image.height;
+        newImage.mipmaps = image.mipmaps;
+        newImage.format = image.format;
+    }
 
-        int format = image->format;
+    return newImage;
+}
 
-        UnloadImageColors(pixels);
-        RL_FREE(image->data);
+// Create an image from another image piece
+Image ImageFromImage(Image image, Rectangle rec)
+{
+    Image result = { 0 };
 
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
-        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
 
-        ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+    result.width = (int)rec.width;
+    result.height = (int)rec.height;
+    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
+    result.format = image.format;
+    result.mipmaps = 1;
+
+    for (int y = 0; y < (int)rec.height; y++)
+    {
+        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
     }
+
+    return result;
 }
 
-// Resize canvas and fill with color
-// NOTE: Resize offset is relative to the top-left corner of the original image
-void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill)
+// Crop an image to area defined by a rectangle
+// NOTE: Security checks are performed in case rectangle goes out of bounds
+void ImageCrop(Image *image, Rectangle crop)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Security checks to validate crop rectangle
+    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
+    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
+    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
+    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
+    if ((crop.x > image->width) || (crop.y > image->height))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
+        return;
+    }
+
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else if ((newWidth != image->width) || (newHeight != image->height))
+    else
     {
-        Rectangle srcRec = { 0, 0, (float)image->width, (float)image->height };
-        Vector2 dstPos = { (float)offsetX, (float)offsetY };
-
-        if (offsetX < 0)
-        {
-            srcRec.x = (float)-offsetX;
-            srcRec.width += (float)offsetX;
-            dstPos.x = 0;
-        }
-        else if ((offsetX + image->width) > newWidth) srcRec.width = (float)(newWidth - offsetX);
-
-        if (offsetY < 0)
-        {
-            srcRec.y = (float)-offsetY;
-            srcRec.height += (float)offsetY;
-            dstPos.y = 0;
-        }
-        else if ((offsetY + image->height) > newHeight) srcRec.height = (float)(newHeight - offsetY);
-
-        if (newWidth < srcRec.width) srcRec.width = (float)newWidth;
-        if (newHeight < srcRec.height) srcRec.height = (float)newHeight;
-
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *resizedData = (unsigned char *)RL_CALLOC(newWidth*newHeight*bytesPerPixel, 1);
 
-        // Fill resized canvas with fill color
-        // Set first pixel with image->format
-        SetPixelColor(resizedData, fill, image->format);
+        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
 
-        // Fill remaining bytes of first row
-        for (int x = 1; x < newWidth; x++)
-        {
-            memcpy(resizedData + x*bytesPerPixel, resizedData, bytesPerPixel);
-        }
-        // Copy the first row into the other rows
-        for (int y = 1; y < newHeight; y++)
+        // OPTION 1: Move cropped data line-by-line
+        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
         {
-            memcpy(resizedData + y*newWidth*bytesPerPixel, resizedData, newWidth*bytesPerPixel);
+            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
+            offsetSize += ((int)crop.width*bytesPerPixel);
         }
 
-        // Copy old image to resized canvas
-        int dstOffsetSize = ((int)dstPos.y*newWidth + (int)dstPos.x)*bytesPerPixel;
-
-        for (int y = 0; y < (int)srcRec.height; y++)
+        /*
+        // OPTION 2: Move cropped data pixel-by-pixel or byte-by-byte
+        for (int y = (int)crop.y; y < (int)(crop.y + crop.height); y++)
         {
-            memcpy(resizedData + dstOffsetSize, ((unsigned char *)image->data) + ((y + (int)srcRec.y)*image->width + (int)srcRec.x)*bytesPerPixel, (int)srcRec.width*bytesPerPixel);
-            dstOffsetSize += (newWidth*bytesPerPixel);
+            for (int x = (int)crop.x; x < (int)(crop.x + crop.width); x++)
+            {
+                //memcpy(croppedData + ((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
+                for (int i = 0; i < bytesPerPixel; i++) croppedData[((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
+            }
         }
+        */
 
-        RL_FREE(image->data);
-        image->data = resizedData;
-        image->width = newWidth;
-        image->height = newHeight;
+        UnloadImage(*image);
+        image->data = croppedData;
+        image->width = (int)crop.width;
+        image->height = (int)crop.height;
     }
 }
 
-// Convert image to POT (power-of-two)
-// NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
-void ImageToPOT(Image *image, Color fill)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    // Calculate next power-of-two values
-    // NOTE: Add the required amount of pixels at the right and bottom sides of image...
-    int potWidth = (int)powf(2, ceilf(logf((float)image->width)/logf(2)));
-    int potHeight = (int)powf(2, ceilf(logf((float)image->height)/logf(2)));
-
-    // Check if POT texture generation is required (if texture is not already POT)
-    if ((potWidth != image->width) || (potHeight != image->height)) ImageResizeCanvas(image, potWidth, potHeight, 0, 0, fill);
-}
-
-// Crop image depending on alpha value
-// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
-void ImageAlphaCrop(Image *image, float threshold)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Rectangle crop = GetImageAlphaBorder(*image, threshold);
-
-    // Crop if rectangle is valid
-    if (((int)crop.width != 0) && ((int)crop.height != 0)) ImageCrop(image, crop);
-}
-
-// Clear alpha channel to desired color
-// NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
-void ImageAlphaClear(Image *image, Color color, float threshold)
+// Convert image data to desired format
+void ImageFormat(Image *image, int newFormat)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+    if ((newFormat != 0) && (image->format != newFormat))
     {
-        switch (image->format)
+        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+
+            UnloadImage(*image);      // WARNING! Loosing mipmaps data --> Regenerated at the end
+            image->data = NULL;
+            image->format = newFormat;
+
+            switch (image->format)
             {
-                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
-                for (int i = 1; i < image->width*image->height*2; i += 2)
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
                 {
-                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+
+                    for (int i = 0; i < image->width*image->height; i++)
                     {
-                        ((unsigned char *)image->data)[i - 1] = color.r;
-                        ((unsigned char *)image->data)[i] = color.a;
+                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-            {
-                unsigned char thresholdValue = ((threshold < 0.5f)? 0 : 1);
-
-                unsigned char r = (unsigned char)(round((float)color.r*31.0f));
-                unsigned char g = (unsigned char)(round((float)color.g*31.0f));
-                unsigned char b = (unsigned char)(round((float)color.b*31.0f));
-                unsigned char a = (color.a < 128)? 0 : 1;
 
-                for (int i = 0; i < image->width*image->height; i++)
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
                 {
-                    if ((((unsigned short *)image->data)[i] & 0b0000000000000001) <= thresholdValue)
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
                     {
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-            {
-                unsigned char thresholdValue = (unsigned char)(threshold*15.0f);
-
-                unsigned char r = (unsigned char)(round((float)color.r*15.0f));
-                unsigned char g = (unsigned char)(round((float)color.g*15.0f));
-                unsigned char b = (unsigned char)(round((float)color.b*15.0f));
-                unsigned char a = (unsigned char)(round((float)color.a*15.0f));
 
-                for (int i = 0; i < image->width*image->height; i++)
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                 {
-                    if ((((unsigned short *)image->data)[i] & 0x000f) <= thresholdValue)
-                    {
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        r = (unsigned char)(round(pixels[i].x*31.0f));
+                        g = (unsigned char)(round(pixels[i].y*63.0f));
+                        b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                    }
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                    {
+                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                    }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+                    unsigned char a = 0;
+
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        r = (unsigned char)(round(pixels[i].x*31.0f));
+                        g = (unsigned char)(round(pixels[i].y*31.0f));
+                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                    }
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+                    unsigned char a = 0;
+
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        r = (unsigned char)(round(pixels[i].x*15.0f));
+                        g = (unsigned char)(round(pixels[i].y*15.0f));
+                        b = (unsigned char)(round(pixels[i].z*15.0f));
+                        a = (unsigned char)(round(pixels[i].w*15.0f));
+
                         ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-            {
-                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
-                for (int i = 3; i < image->width*image->height*4; i += 4)
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                 {
-                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
                     {
-                        ((unsigned char *)image->data)[i - 3] = color.r;
-                        ((unsigned char *)image->data)[i - 2] = color.g;
-                        ((unsigned char *)image->data)[i - 1] = color.b;
-                        ((unsigned char *)image->data)[i] = color.a;
+                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-            {
-                for (int i = 3; i < image->width*image->height*4; i += 4)
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
                 {
-                    if (((float *)image->data)[i] <= threshold)
+                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+
+                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+
+                    for (int i = 0; i < image->width*image->height; i++)
                     {
-                        ((float *)image->data)[i - 3] = (float)color.r/255.0f;
-                        ((float *)image->data)[i - 2] = (float)color.g/255.0f;
-                        ((float *)image->data)[i - 1] = (float)color.b/255.0f;
-                        ((float *)image->data)[i] = (float)color.a/255.0f;
+                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-            {
-                for (int i = 3; i < image->width*image->height*4; i += 4)
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                 {
-                    if (HalfToFloat(((unsigned short *)image->data)[i]) <= threshold)
+                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
                     {
-                        ((unsigned short *)image->data)[i - 3] = FloatToHalf((float)color.r/255.0f);
-                        ((unsigned short *)image->data)[i - 2] = FloatToHalf((float)color.g/255.0f);
-                        ((unsigned short *)image->data)[i - 1] = FloatToHalf((float)color.b/255.0f);
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)color.a/255.0f);
+                        ((float *)image->data)[i] = pixels[k].x;
+                        ((float *)image->data)[i + 1] = pixels[k].y;
+                        ((float *)image->data)[i + 2] = pixels[k].z;
                     }
-                }
-            } break;
-            default: break;
-        }
-    }
-}
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-// Apply alpha mask to image
-// NOTE 1: Returned image is GRAY_ALPHA (16bit) or RGBA (32bit)
-// NOTE 2: alphaMask should be same size as image
-void ImageAlphaMask(Image *image, Image alphaMask)
-{
-    if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask must be same size as image");
-    }
-    else if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask can not be applied to compressed data formats");
-    }
-    else
-    {
-        // Force mask to be Grayscale
-        Image mask = ImageCopy(alphaMask);
-        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    {
+                        ((float *)image->data)[i] = pixels[k].x;
+                        ((float *)image->data)[i + 1] = pixels[k].y;
+                        ((float *)image->data)[i + 2] = pixels[k].z;
+                        ((float *)image->data)[i + 3] = pixels[k].w;
+                    }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
 
-        // In case image is only grayscale, add alpha channel
-        if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-        {
-            unsigned char *data = (unsigned char *)RL_MALLOC(image->width*image->height*2);
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-            // Apply alpha mask to alpha channel
-            for (int i = 0, k = 0; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 2)
-            {
-                data[k] = ((unsigned char *)image->data)[i];
-                data[k + 1] = ((unsigned char *)mask.data)[i];
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+                    }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                    {
+                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                    }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    {
+                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
+                    }
+                } break;
+                default: break;
             }
 
-            RL_FREE(image->data);
-            image->data = data;
-            image->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
-        }
-        else
-        {
-            // Convert image to RGBA
-            if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            RL_FREE(pixels);
+            pixels = NULL;
 
-            // Apply alpha mask to alpha channel
-            for (int i = 0, k = 3; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 4)
+            // In case original image had mipmaps, generate mipmaps for formatted image
+            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+            if (image->mipmaps > 1)
             {
-                ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i];
+                image->mipmaps = 1;
+                if (image->data != NULL) ImageMipmaps(image);
             }
         }
-
-        UnloadImage(mask);
+        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
 
-// Premultiply alpha channel
-void ImageAlphaPremultiply(Image *image)
+// Create an image from text (default font)
+Image ImageText(const char *text, int fontSize, Color color)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    Image imText = { 0 };
+#if SUPPORT_MODULE_RTEXT
+    int defaultFontSize = 10;   // Default Font chars height in pixel
+    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+    int spacing = fontSize/defaultFontSize;
+    imText = ImageTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing, color);   // WARNING: Module required: rtext
+#else
+    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
+    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
+#endif
+    return imText;
+}
 
-    float alpha = 0.0f;
-    Color *pixels = LoadImageColors(*image);
+// Create an image from text (custom sprite font)
+// WARNING: Module required: rtext
+Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint)
+{
+    Image imText = { 0 };
+#if SUPPORT_MODULE_RTEXT
+    if (text == NULL) return imText;
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        if (pixels[i].a == 0)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-        }
-        else if (pixels[i].a < 255)
-        {
-            alpha = (float)pixels[i].a/255.0f;
-            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-        }
-    }
-
-    RL_FREE(image->data);
-
-    int format = image->format;
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
-
-// Apply box blur to image
-void ImageBlurGaussian(Image *image, int blurSize)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    int textLength = (int)strlen(text); // Get length of text in bytes
+    int textOffsetX = 0;            // Image drawing position X
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float kerningOffsetX = 0.0f;    // Line kerning adjustments, accumulated to avoid rounding drift
+    int previous = 0;               // Previous codepoint in line, for kerning
 
-    ImageAlphaPremultiply(image);
+    // NOTE: Text image is generated at font base size, later scaled to desired font size
+    Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
+    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
 
-    Color *pixels = LoadImageColors(*image);
+    // Create image to store text
+    imText = GenImageColor((int)imSize.x, (int)imSize.y, BLANK);
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = (Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = (Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    // Fast path: glyphs coverage drawn directly, generic image drawing used for fonts without coverage glyph images
+    bool coverageDrawn = DrawImageTextCoverage(&imText, font, text, (Vector2){ 0.0f, 0.0f }, (float)font.baseSize, spacing, tint);
 
-    for (int i = 0; i < (image->height*image->width); i++)
+    for (int i = 0; (i < textLength) && !coverageDrawn;)
     {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);    // WARNING: Module required: rtext
+        int index = GetGlyphIndex(font, codepoint);                         // WARNING: Module required: rtext
 
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
-    {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
+        if (codepoint == '\n')
         {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+            // NOTE: Fixed line spacing of 1.5 line-height
+            // TODO: Support custom line spacing defined by user
+            textOffsetY += (font.baseSize + font.baseSize/2);
+            textOffsetX = 0;
+            kerningOffsetX = 0.0f;
+            previous = 0;
+        }
+        else
+        {
+            // NOTE: Kerning rounded down to keep glyphs within measured text width
+            if (previous != 0) kerningOffsetX += GetGlyphKerning(font, previous, codepoint); // WARNING: Module required: rtext
+            previous = codepoint;
 
-            for (int i = 0; i < blurSize; i++)
+            if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
+                Rectangle rec = { (float)(textOffsetX + (int)floorf(kerningOffsetX) + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
+                ImageDraw(&imText, font.glyphs[index].image, (Rectangle){ 0, 0, (float)font.glyphs[index].image.width, (float)font.glyphs[index].image.height }, rec, tint);
             }
 
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
+            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
+            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
+        }
 
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
 
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
+    // Scale image depending on text size
+    if (textSize.y != imSize.y)
+    {
+        float scaleFactor = textSize.y/imSize.y;
+        TRACELOG(LOG_INFO, "IMAGE: Text scaled by factor: %f", scaleFactor);
 
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+        // Using nearest-neighbor scaling algorithm for default font
+        // TODO: Allow defining the preferred scaling mechanism externally
+        if (font.texture.id == GetFontDefault().texture.id) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
+        else ImageResize(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
+    }
+#else
+    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
+    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
+#endif
+    return imText;
+}
 
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+// Create an image from a selected channel of another image
+Image ImageFromChannel(Image image, int selectedChannel)
+{
+    Image result = { 0 };
 
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return result; // Security check
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+    // Check selected channel is valid
+    if (selectedChannel < 0)
+    {
+        TRACELOG(LOG_WARNING, "Channel cannot be negative. Setting channel to 0.");
+        selectedChannel = 0;
     }
 
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE ||
+        image.format == PIXELFORMAT_UNCOMPRESSED_R32 ||
+        image.format == PIXELFORMAT_UNCOMPRESSED_R16)
     {
-        if (pixelsCopy1[i].w == 0.0f)
+        if (selectedChannel > 0)
         {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
+            TRACELOG(LOG_WARNING, "This image has only 1 channel. Setting channel to it.");
+            selectedChannel = 0;
         }
-        else if (pixelsCopy1[i].w <= 255.0f)
+    }
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+    {
+        if (selectedChannel > 1)
         {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)fminf((float)pixelsCopy1[i].x/alpha, 255.0);
-            pixels[i].g = (unsigned char)fminf((float)pixelsCopy1[i].y/alpha, 255.0);
-            pixels[i].b = (unsigned char)fminf((float)pixelsCopy1[i].z/alpha, 255.0);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
+            TRACELOG(LOG_WARNING, "This image has only 2 channels. Setting channel to alpha.");
+            selectedChannel = 1;
         }
     }
-
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
-
-// Apply custom square convolution kernel to image
-// NOTE: The convolution kernel matrix is expected to be square
-void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
-{
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
-
-    int kernelWidth = (int)sqrtf((float)kernelSize);
-
-    if (kernelWidth*kernelWidth != kernelSize)
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5 ||
+             image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8 ||
+             image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32 ||
+             image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)
     {
-        TRACELOG(LOG_WARNING, "IMAGE: Convolution kernel must be square to be applied");
-        return;
+        if (selectedChannel > 2)
+        {
+            TRACELOG(LOG_WARNING, "This image has only 3 channels. Setting channel to red.");
+            selectedChannel = 0;
+        }
     }
 
-    Color *pixels = LoadImageColors(*image);
-
-    Vector4 *imageCopy2 = (Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = (Vector4 *)RL_MALLOC(kernelSize*sizeof(Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
+    // Check for RGBA formats
+    if (selectedChannel > 3)
     {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
+        TRACELOG(LOG_WARNING, "ImageFromChannel supports channels 0 to 3 (RGBA). Setting channel to alpha.");
+        selectedChannel = 3;
     }
 
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+    // TODO: Consider other one-channel formats: R16, R32
+    result.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    result.height = image.height;
+    result.width = image.width;
+    result.mipmaps = 1;
 
-    int startRange = 0, endRange = 0;
+    unsigned char *pixels = (unsigned char *)RL_CALLOC(image.width*image.height, sizeof(unsigned char)); // Values from 0 to 255
 
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
     else
     {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
-
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
         {
-            for (int xk = startRange; xk < endRange; xk++)
+            float pixelValue = -1;
+            switch (image.format)
             {
-                for (int yk = startRange; yk < endRange; yk++)
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
                 {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
+                    pixelValue = (float)((unsigned char *)image.data)[i + selectedChannel]/255.0f;
 
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixelValue = (float)((unsigned char *)image.data)[k + selectedChannel]/255.0f;
+                    k += 2;
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
+                    if (selectedChannel == 0) pixelValue = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    else if (selectedChannel == 1) pixelValue = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    else if (selectedChannel == 2) pixelValue = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    else if (selectedChannel == 3) pixelValue = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
 
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
+                    if (selectedChannel == 0) pixelValue = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    else if (selectedChannel == 1) pixelValue = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    else if (selectedChannel == 2) pixelValue = (float)(pixel & 0b0000000000011111)*(1.0f/31);
 
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
-    }
+                    if (selectedChannel == 0) pixelValue = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    else if (selectedChannel == 1) pixelValue = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    else if (selectedChannel == 2) pixelValue = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    else if (selectedChannel == 3) pixelValue = (float)(pixel & 0b0000000000001111)*(1.0f/15);
 
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixelValue = (float)((unsigned char *)image.data)[k + selectedChannel]/255.0f;
+                    k += 4;
 
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixelValue = (float)((unsigned char *)image.data)[k + selectedChannel]/255.0f;
+                    k += 3;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixelValue = ((float *)image.data)[k];
+                    k += 1;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixelValue = ((float *)image.data)[k + selectedChannel];
+                    k += 3;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixelValue = ((float *)image.data)[k + selectedChannel];
+                    k += 4;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k]);
+                    k += 1;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k+selectedChannel]);
+                    k += 3;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    pixelValue = HalfToFloat(((unsigned short *)image.data)[k + selectedChannel]);
+                    k += 4;
+
+                } break;
+                default: break;
+            }
+
+            pixels[i] = (unsigned char)(pixelValue*255);
+        }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    result.data = pixels;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    ImageFormat(image, format);
+    return result;
 }
 
-// Generate all mipmap levels for a provided image
-// NOTE 1: Supports POT and NPOT images
-// NOTE 2: image.data is scaled to include mipmap levels
-// NOTE 3: Mipmaps format is the same as base image
-void ImageMipmaps(Image *image)
+// Resize and image to new size using Nearest-Neighbor scaling algorithm
+void ImageResizeNN(Image *image, int newWidth, int newHeight)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    int mipCount = 1;                   // Required mipmap levels count (including base level)
-    int mipWidth = image->width;        // Base image width
-    int mipHeight = image->height;      // Base image height
-    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
+    // EDIT: added +1 to account for an early rounding problem
+    int xRatio = (int)((image->width << 16)/newWidth) + 1;
+    int yRatio = (int)((image->height << 16)/newHeight) + 1;
 
-    // Count mipmap levels required
-    while ((mipWidth != 1) || (mipHeight != 1))
+    if (image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        if (mipWidth != 1) mipWidth /= 2;
-        if (mipHeight != 1) mipHeight /= 2;
+        // Uncompressed formats: copy source pixel bytes directly, no format conversion required
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *pixels = (unsigned char *)image->data;
+        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+        int *offsetX = (int *)RL_MALLOC(newWidth*sizeof(int));
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
+        for (int x = 0; x < newWidth; x++) offsetX[x] = ((x*xRatio) >> 16)*bytesPerPixel;
 
-        TRACELOG(LOG_DEBUG, "IMAGE: Next mipmap level: %i x %i - current size %i", mipWidth, mipHeight, mipSize);
+        for (int y = 0; y < newHeight; y++)
+        {
+            const unsigned char *srcRow = pixels + (size_t)((y*yRatio) >> 16)*image->width*bytesPerPixel;
+            unsigned char *dstRow = output + (size_t)y*newWidth*bytesPerPixel;
 
-        mipCount++;
-        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
-    }
+            switch (bytesPerPixel)
+            {
+                case 1: for (int x = 0; x < newWidth; x++) dstRow[x] = srcRow[offsetX[x]]; break;
+                case 4: for (int x = 0; x < newWidth; x++) memcpy(dstRow + x*4, srcRow + offsetX[x], 4); break;
+                default: for (int x = 0; x < newWidth; x++) memcpy(dstRow + x*bytesPerPixel, srcRow + offsetX[x], bytesPerPixel); break;
+            }
+        }
 
-    if (image->mipmaps < mipCount)
-    {
-        // Create second buffer and copy data manually to it
-        void *temp = RL_CALLOC(mipSize, 1);
-        memcpy(temp, image->data, GetPixelDataSize(image->width, image->height, image->format));
-        RL_FREE(image->data);
-        image->data = temp;
+        RL_FREE(offsetX);
+        UnloadImage(*image);
 
-        // Pointer to allocated memory point where store next mipmap level data
-        unsigned char *nextmip = (unsigned char *)image->data;
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+        return;
+    }
 
-        mipWidth = image->width;
-        mipHeight = image->height;
-        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+    Color *pixels = LoadImageColors(*image);
+    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
-        for (int i = 1; i < mipCount; i++)
+    int x2 = 0;
+    int y2 = 0;
+    for (int y = 0; y < newHeight; y++)
+    {
+        for (int x = 0; x < newWidth; x++)
         {
-            nextmip += mipSize;
-
-            mipWidth /= 2;
-            mipHeight /= 2;
+            x2 = ((x*xRatio) >> 16);
+            y2 = ((y*yRatio) >> 16);
 
-            // Security check for NPOT textures
-            if (mipWidth < 1) mipWidth = 1;
-            if (mipHeight < 1) mipHeight = 1;
+            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
+        }
+    }
 
-            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+    int format = image->format;
 
-            if (i < image->mipmaps) continue;
+    UnloadImage(*image);
 
-            TRACELOG(LOG_DEBUG, "IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
-            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
-            memcpy(nextmip, imCopy.data, mipSize);
-        }
+    image->data = output;
+    image->width = newWidth;
+    image->height = newHeight;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-        UnloadImage(imCopy);
+    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
 
-        image->mipmaps = mipCount;
-    }
-    else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
+    UnloadImageColors(pixels);
 }
 
-// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
-// NOTE: In case selected bpp do not represent a known 16bit format,
-// dithered data is stored in the LSB part of the unsigned short
-void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
+// Resize and image to new size
+// NOTE: Uses stb default scaling filters (both bicubic):
+// STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
+// STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
+// NOTE: 2x and 4x downscaling of GRAYSCALE and R8G8B8A8 images uses box filtering, ImageResizeBox()
+void ImageResize(Image *image, int newWidth, int newHeight)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    // Check if integer factor downscaling can be used, averaging source pixels blocks
+    if (((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) &&
+        (newWidth > 0) && (newHeight > 0) && ((image->width == newWidth*2) || (image->width == newWidth*4)) &&
+        ((image->width/newWidth) == (image->height/newHeight)) && ((image->height%newHeight) == 0))
     {
-        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be dithered");
+        ImageResizeBox(image, newWidth, newHeight);
         return;
     }
 
-    if ((rBpp + gBpp + bBpp + aBpp) > 16)
+    // Check if a fast path can be used on image scaling
+    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
     {
-        TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
-    }
-    else
-    {
-        Color *pixels = LoadImageColors(*image);
-
-        RL_FREE(image->data);      // free old image data
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        switch (image->format)
         {
-            TRACELOG(LOG_WARNING, "IMAGE: Format is already 16bpp or lower, dithering could have no effect");
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
+            default: break;
         }
 
-        // Define new image format, check if desired bpp match internal known format
-        if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
-        else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
-        else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) image->format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
-        else
-        {
-            image->format = 0;
-            TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
-        }
+        UnloadImage(*image);
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+    }
+    else
+    {
+        // Get data as Color pixels array to work with it
+        Color *pixels = LoadImageColors(*image);
+        Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
-        // NOTE: Storing the dithered data as unsigned short (16bpp)
-        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+        // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
+        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
 
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
+        int format = image->format;
 
-        int rError = 0;
-        int gError = 0;
-        int bError = 0;
-        unsigned short rPixel = 0;   // Used for 16bit pixel composition
-        unsigned short gPixel = 0;
-        unsigned short bPixel = 0;
-        unsigned short aPixel = 0;
+        UnloadImageColors(pixels);
+        UnloadImage(*image);
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
+        ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+    }
+}
 
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+// Resize image (Bilinear filtering)
+// NOTE: Fixed-point implementation for 8 bit per channel formats, rows processed on multiple threads,
+// other formats are resized with ImageResize()
+void ImageResizeBilinear(Image *image, int newWidth, int newHeight)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-                // NOTE: Error must be computed between new and old pixel but using same number of bits,
-                // to know how much color precision has been lost
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+    int channels = GetImageChannels8(image->format);
 
-                pixels[y*image->width + x] = newPixel;
+    if ((channels > 0) && (newWidth > 0) && (newHeight > 0))
+    {
+        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*channels);
 
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
+        ResizeImageFixed((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, channels, true);
 
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
+        UnloadImage(*image);
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+    }
+    else ImageResize(image, newWidth, newHeight);
+}
 
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
+// Resize image (Box filtering, area-average)
+// NOTE: Fixed-point implementation for 8 bit per channel formats, rows processed on multiple threads,
+// integer downscale factors use a specialized path, upscaling uses bilinear filtering,
+// other formats are resized with ImageResize()
+void ImageResizeBox(Image *image, int newWidth, int newHeight)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
+    int channels = GetImageChannels8(image->format);
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+    if ((channels > 0) && (newWidth > 0) && (newHeight > 0))
+    {
+        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*channels);
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
-        }
+        ResizeImageFixed((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, channels, false);
 
-        UnloadImageColors(pixels);
+        UnloadImage(*image);
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
     }
+    else ImageResize(image, newWidth, newHeight);
 }
 
-// Flip image vertically
-void ImageFlipVertical(Image *image)
+// Resize canvas and fill with color
+// NOTE: Resize offset is relative to the top-left corner of the original image
+void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+    else if ((newWidth != image->width) || (newHeight != image->height))
     {
+        Rectangle srcRec = { 0, 0, (float)image->width, (float)image->height };
+        Vector2 dstPos = { (float)offsetX, (float)offsetY };
+
+        if (offsetX < 0)
+        {
+            srcRec.x = (float)-offsetX;
+            srcRec.width += (float)offsetX;
+            dstPos.x = 0;
+        }
+        else if ((offsetX + image->width) > newWidth) srcRec.width = (float)(newWidth - offsetX);
+
+        if (offsetY < 0)
+        {
+            srcRec.y = (float)-offsetY;
+            srcRec.height += (float)offsetY;
+            dstPos.y = 0;
+        }
+        else if ((offsetY + image->height) > newHeight) srcRec.height = (float)(newHeight - offsetY);
+
+        if (newWidth < srcRec.width) srcRec.width = (float)newWidth;
+        if (newHeight < srcRec.height) srcRec.height = (float)newHeight;
+
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        unsigned char *resizedData = (unsigned char *)RL_CALLOC(newWidth*newHeight*bytesPerPixel, 1);
 
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        // Fill resized canvas with fill color
+        // Set first pixel with image->format
+        SetPixelColor(resizedData, fill, image->format);
+
+        // Fill remaining bytes of first row
+        for (int x = 1; x < newWidth; x++)
         {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
+            memcpy(resizedData + x*bytesPerPixel, resizedData, bytesPerPixel);
+        }
+        // Copy the first row into the other rows
+        for (int y = 1; y < newHeight; y++)
+        {
+            memcpy(resizedData + y*newWidth*bytesPerPixel, resizedData, newWidth*bytesPerPixel);
         }
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+        // Copy old image to resized canvas
+        int dstOffsetSize = ((int)dstPos.y*newWidth + (int)dstPos.x)*bytesPerPixel;
+
+        for (int y = 0; y < (int)srcRec.height; y++)
+        {
+            memcpy(resizedData + dstOffsetSize, ((unsigned char *)image->data) + ((y + (int)srcRec.y)*image->width + (int)srcRec.x)*bytesPerPixel, (int)srcRec.width*bytesPerPixel);
+            dstOffsetSize += (newWidth*bytesPerPixel);
+        }
+
+        UnloadImage(*image);
+        image->data = resizedData;
+        image->width = newWidth;
+        image->height = newHeight;
     }
 }
 
-// Flip image horizontally
-void ImageFlipHorizontal(Image *image)
+// Convert image to POT (power-of-two)
+// NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
+void ImageToPOT(Image *image, Color fill)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+    // Calculate next power-of-two values
+    // NOTE: Add the required amount of pixels at the right and bottom sides of image...
+    int potWidth = (int)powf(2, ceilf(logf((float)image->width)/logf(2)));
+    int potHeight = (int)powf(2, ceilf(logf((float)image->height)/logf(2)));
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
+    // Check if POT texture generation is required (if texture is not already POT)
+    if ((potWidth != image->width) || (potHeight != image->height)) ImageResizeCanvas(image, potWidth, potHeight, 0, 0, fill);
+}
 
-                // OPTION 2: Copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
+// Crop image depending on alpha value
+// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
+void ImageAlphaCrop(Image *image, float threshold)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+    Rectangle crop = GetImageAlphaBorder(*image, threshold);
 
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
-            {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
-            }
-        }
-        */
-    }
+    // Crop if rectangle is valid
+    if (((int)crop.width != 0) && ((int)crop.height != 0)) ImageCrop(image, crop);
 }
 
-// Rotate image in degrees
-void ImageRotate(Image *image, int degrees)
+// Clear alpha channel to desired color
+// NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
+void ImageAlphaClear(Image *image, Color color, float threshold)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2620,268 +3274,322 @@ void ImageRotate(Image *image, int degrees)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        float rad = degrees*PI/180.0f;
-        float sinRadius = sinf(rad);
-        float cosRadius = cosf(rad);
-
-        int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
-        int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
-
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
-
-        for (int y = 0; y < height; y++)
+        switch (image->format)
         {
-            for (int x = 0; x < width; x++)
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
             {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
-
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
+                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
+                for (int i = 1; i < image->width*image->height*2; i += 2)
+                {
+                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    {
+                        ((unsigned char *)image->data)[i - 1] = color.r;
+                        ((unsigned char *)image->data)[i] = color.a;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned char thresholdValue = ((threshold < 0.5f)? 0 : 1);
 
-                    float px = oldX - x1;
-                    float py = oldY - y1;
+                unsigned char r = (unsigned char)(round((float)color.r*31.0f));
+                unsigned char g = (unsigned char)(round((float)color.g*31.0f));
+                unsigned char b = (unsigned char)(round((float)color.b*31.0f));
+                unsigned char a = (color.a < 128)? 0 : 1;
 
-                    for (int i = 0; i < bytesPerPixel; i++)
+                for (int i = 0; i < image->width*image->height; i++)
+                {
+                    if ((((unsigned short *)image->data)[i] & 0b0000000000000001) <= thresholdValue)
                     {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned char thresholdValue = (unsigned char)(threshold*15.0f);
 
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+                unsigned char r = (unsigned char)(round((float)color.r*15.0f));
+                unsigned char g = (unsigned char)(round((float)color.g*15.0f));
+                unsigned char b = (unsigned char)(round((float)color.b*15.0f));
+                unsigned char a = (unsigned char)(round((float)color.a*15.0f));
 
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
+                for (int i = 0; i < image->width*image->height; i++)
+                {
+                    if ((((unsigned short *)image->data)[i] & 0x000f) <= thresholdValue)
+                    {
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
                     }
                 }
-            }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
+                for (int i = 3; i < image->width*image->height*4; i += 4)
+                {
+                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    {
+                        ((unsigned char *)image->data)[i - 3] = color.r;
+                        ((unsigned char *)image->data)[i - 2] = color.g;
+                        ((unsigned char *)image->data)[i - 1] = color.b;
+                        ((unsigned char *)image->data)[i] = color.a;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                for (int i = 3; i < image->width*image->height*4; i += 4)
+                {
+                    if (((float *)image->data)[i] <= threshold)
+                    {
+                        ((float *)image->data)[i - 3] = (float)color.r/255.0f;
+                        ((float *)image->data)[i - 2] = (float)color.g/255.0f;
+                        ((float *)image->data)[i - 1] = (float)color.b/255.0f;
+                        ((float *)image->data)[i] = (float)color.a/255.0f;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                for (int i = 3; i < image->width*image->height*4; i += 4)
+                {
+                    if (HalfToFloat(((unsigned short *)image->data)[i]) <= threshold)
+                    {
+                        ((unsigned short *)image->data)[i - 3] = FloatToHalf((float)color.r/255.0f);
+                        ((unsigned short *)image->data)[i - 2] = FloatToHalf((float)color.g/255.0f);
+                        ((unsigned short *)image->data)[i - 1] = FloatToHalf((float)color.b/255.0f);
+                        ((unsigned short *)image->data)[i] = FloatToHalf((float)color.a/255.0f);
+                    }
+                }
+            } break;
+            default: break;
         }
-
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        image->width = width;
-        image->height = height;
     }
 }
 
-// Rotate image clockwise 90deg
-void ImageRotateCW(Image *image)
+// Apply alpha mask to image
+// NOTE 1: Returned image is GRAY_ALPHA (16bit) or RGBA (32bit)
+// NOTE 2: alphaMask should be same size as image
+void ImageAlphaMask(Image *image, Image alphaMask)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask must be same size as image");
+    }
+    else if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask can not be applied to compressed data formats");
+    }
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        // Force mask to be Grayscale
+        Image mask = ImageCopy(alphaMask);
+        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
 
-        for (int y = 0; y < image->height; y++)
+        // In case image is only grayscale, add alpha channel
+        if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
         {
-            for (int x = 0; x < image->width; x++)
+            unsigned char *data = (unsigned char *)RL_MALLOC(image->width*image->height*2);
+
+            // Apply alpha mask to alpha channel
+            for (int i = 0, k = 0; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 2)
             {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
+                data[k] = ((unsigned char *)image->data)[i];
+                data[k + 1] = ((unsigned char *)mask.data)[i];
             }
-        }
-
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
-
-        image->width = height;
-        image->height = width;
-    }
-}
-
-// Rotate image counter-clockwise 90deg
-void ImageRotateCCW(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
+            UnloadImage(*image);
+            image->data = data;
+            image->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        }
+        else
         {
-            for (int x = 0; x < image->width; x++)
+            // Convert image to RGBA
+            if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            // Apply alpha mask to alpha channel
+            for (int i = 0, k = 3; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 4)
             {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
+                ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i];
             }
         }
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
-
-        image->width = height;
-        image->height = width;
+        UnloadImage(mask);
     }
 }
 
-// Modify image color: tint
-void ImageColorTint(Image *image, Color color)
+// Premultiply alpha channel
+void ImageAlphaPremultiply(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    float alpha = 0.0f;
     Color *pixels = LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
-
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
+        if (pixels[i].a == 0)
+        {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+        }
+        else if (pixels[i].a < 255)
+        {
+            alpha = (float)pixels[i].a/255.0f;
+            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+        }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
+    int format = image->format;
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);
 }
 
-// Modify image color: invert
-void ImageColorInvert(Image *image)
+// Apply box blur to image
+void ImageBlurGaussian(Image *image, int blurSize)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    ImageAlphaPremultiply(image);
+
     Color *pixels = LoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
+    // Loop switches between pixelsCopy1 and pixelsCopy2
+    Vector4 *pixelsCopy1 = (Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    Vector4 *pixelsCopy2 = (Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+
+    for (int i = 0; i < (image->height*image->width); i++)
     {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
+        pixelsCopy1[i].x = pixels[i].r;
+        pixelsCopy1[i].y = pixels[i].g;
+        pixelsCopy1[i].z = pixels[i].b;
+        pixelsCopy1[i].w = pixels[i].a;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
+    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
+    {
+        // Horizontal motion blur
+        for (int row = 0; row < image->height; row++)
+        {
+            float avgR = 0.0f;
+            float avgG = 0.0f;
+            float avgB = 0.0f;
+            float avgAlpha = 0.0f;
+            int convolutionSize = blurSize;
 
-// Modify image color: grayscale
-void ImageColorGrayscale(Image *image)
-{
-    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
-}
+            for (int i = 0; i < blurSize; i++)
+            {
+                avgR += pixelsCopy1[row*image->width + i].x;
+                avgG += pixelsCopy1[row*image->width + i].y;
+                avgB += pixelsCopy1[row*image->width + i].z;
+                avgAlpha += pixelsCopy1[row*image->width + i].w;
+            }
 
-// Modify image color: contrast
-// NOTE: Contrast values between -100 and 100
-void ImageColorContrast(Image *image, float contrast)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
+            for (int x = 0; x < image->width; x++)
+            {
+                if (x-blurSize-1 >= 0)
+                {
+                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
+                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
+                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
+                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
+                    convolutionSize--;
+                }
 
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
+                if (x+blurSize < image->width)
+                {
+                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
+                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
+                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
+                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
+                    convolutionSize++;
+                }
 
-    Color *pixels = LoadImageColors(*image);
+                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
+                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
+                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
+                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
+            }
+        }
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
+        // Vertical motion blur
+        for (int col = 0; col < image->width; col++)
+        {
+            float avgR = 0.0f;
+            float avgG = 0.0f;
+            float avgB = 0.0f;
+            float avgAlpha = 0.0f;
+            int convolutionSize = blurSize;
 
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
+            for (int i = 0; i < blurSize; i++)
+            {
+                avgR += pixelsCopy2[i*image->width + col].x;
+                avgG += pixelsCopy2[i*image->width + col].y;
+                avgB += pixelsCopy2[i*image->width + col].z;
+                avgAlpha += pixelsCopy2[i*image->width + col].w;
+            }
 
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
+            for (int y = 0; y < image->height; y++)
+            {
+                if (y-blurSize-1 >= 0)
+                {
+                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
+                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
+                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
+                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
+                    convolutionSize--;
+                }
+                if (y+blurSize < image->height)
+                {
+                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
+                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
+                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
+                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
+                    convolutionSize++;
+                }
 
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
+                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
+                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
+                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
+                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
+            }
+        }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
-
-// Modify image color: brightness
-// NOTE: Brightness values between -255 and 255
-void ImageColorBrightness(Image *image, int brightness)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+    // Reverse premultiply
+    for (int i = 0; i < (image->width)*(image->height); i++)
     {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
-
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
-
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
+        if (pixelsCopy1[i].w == 0.0f)
+        {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+            pixels[i].a = 0;
+        }
+        else if (pixelsCopy1[i].w <= 255.0f)
+        {
+            float alpha = (float)pixelsCopy1[i].w/255.0f;
+            pixels[i].r = (unsigned char)fminf((float)pixelsCopy1[i].x/alpha, 255.0);
+            pixels[i].g = (unsigned char)fminf((float)pixelsCopy1[i].y/alpha, 255.0);
+            pixels[i].b = (unsigned char)fminf((float)pixelsCopy1[i].z/alpha, 255.0);
+            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
+        }
     }
 
     int format = image->format;
-    RL_FREE(image->data);
+    UnloadImage(*image);
+    RL_FREE(pixelsCopy1);
+    RL_FREE(pixelsCopy2);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2889,2695 +3597,5916 @@ void ImageColorBrightness(Image *image, int brightness)
     ImageFormat(image, format);
 }
 
-// Modify image color: replace color
-void ImageColorReplace(Image *image, Color color, Color replace)
+// Apply custom square convolution kernel to image
+// NOTE: The convolution kernel matrix is expected to be square
+void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
 
-    Color *pixels = LoadImageColors(*image);
+    int kernelWidth = (int)sqrtf((float)kernelSize);
 
-    for (int i = 0; i < image->width*image->height; i++)
+    if (kernelWidth*kernelWidth != kernelSize)
     {
-        if ((pixels[i].r == color.r) &&
-            (pixels[i].g == color.g) &&
-            (pixels[i].b == color.b) &&
-            (pixels[i].a == color.a))
-        {
-            pixels[i].r = replace.r;
-            pixels[i].g = replace.g;
-            pixels[i].b = replace.b;
-            pixels[i].a = replace.a;
-        }
+        TRACELOG(LOG_WARNING, "IMAGE: Convolution kernel must be square to be applied");
+        return;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    Color *pixels = LoadImageColors(*image);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    Vector4 *imageCopy2 = (Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    Vector4 *temp = (Vector4 *)RL_MALLOC(kernelSize*sizeof(Vector4));
 
-    // Only convert back to original format if it supported alpha
-    if ((format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
-        (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-        (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
-        (format == PIXELFORMAT_COMPRESSED_DXT1_RGB) ||
-        (format == PIXELFORMAT_COMPRESSED_ETC1_RGB) ||
-        (format == PIXELFORMAT_COMPRESSED_ETC2_RGB) ||
-        (format == PIXELFORMAT_COMPRESSED_PVRT_RGB)) ImageFormat(image, format);
-}
+    for (int i = 0; i < kernelSize; i++)
+    {
+        temp[i].x = 0.0f;
+        temp[i].y = 0.0f;
+        temp[i].z = 0.0f;
+        temp[i].w = 0.0f;
+    }
 
-// Load color data from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImageColors();
-Color *LoadImageColors(Image image)
-{
-    if ((image.width == 0) || (image.height == 0)) return NULL; // Security check
+    float rRes = 0.0f;
+    float gRes = 0.0f;
+    float bRes = 0.0f;
+    float aRes = 0.0f;
 
-    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+    int startRange = 0, endRange = 0;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    if (kernelWidth%2 == 0)
+    {
+        startRange = -kernelWidth/2;
+        endRange = kernelWidth/2;
+    }
     else
     {
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
-
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+        startRange = -kernelWidth/2;
+        endRange = kernelWidth/2 + 1;
+    }
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+    for (int x = 0; x < image->height; x++)
+    {
+        for (int y = 0; y < image->width; y++)
         {
-            switch (image.format)
+            for (int xk = startRange; xk < endRange; xk++)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                for (int yk = startRange; yk < endRange; yk++)
                 {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+                    int xkabs = xk + kernelWidth/2;
+                    int ykabs = yk + kernelWidth/2;
+                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    if (imgindex >= (unsigned int)(image->width*image->height))
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
+                    }
+                    else
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                    }
+                }
+            }
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+            for (int i = 0; i < kernelSize; i++)
+            {
+                rRes += temp[i].x;
+                gRes += temp[i].y;
+                bRes += temp[i].z;
+                aRes += temp[i].w;
+            }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            if (rRes < 0.0f) rRes = 0.0f;
+            if (gRes < 0.0f) gRes = 0.0f;
+            if (bRes < 0.0f) bRes = 0.0f;
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
+            if (rRes > 1.0f) rRes = 1.0f;
+            if (gRes > 1.0f) gRes = 1.0f;
+            if (bRes > 1.0f) bRes = 1.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            imageCopy2[image->width*x + y].x = rRes;
+            imageCopy2[image->width*x + y].y = gRes;
+            imageCopy2[image->width*x + y].z = bRes;
+            imageCopy2[image->width*x + y].w = aRes;
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+            rRes = 0.0f;
+            gRes = 0.0f;
+            bRes = 0.0f;
+            aRes = 0.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+            for (int i = 0; i < kernelSize; i++)
+            {
+                temp[i].x = 0.0f;
+                temp[i].y = 0.0f;
+                temp[i].z = 0.0f;
+                temp[i].w = 0.0f;
+            }
+        }
+    }
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
+    for (int i = 0; i < (image->width*image->height); i++)
+    {
+        float alpha = (float)imageCopy2[i].w;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
+        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
+        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
+        pixels[i].a = (unsigned char)((alpha)*255.0f);
+    }
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+    int format = image->format;
+    UnloadImage(*image);
+    RL_FREE(imageCopy2);
+    RL_FREE(temp);
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    ImageFormat(image, format);
+}
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+// Generate all mipmap levels for a provided image
+// NOTE 1: Supports POT and NPOT images
+// NOTE 2: image.data is scaled to include mipmap levels
+// NOTE 3: Mipmaps format is the same as base image
+void ImageMipmaps(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
+    int mipCount = 1;                   // Required mipmap levels count (including base level)
+    int mipWidth = image->width;        // Base image width
+    int mipHeight = image->height;      // Base image height
+    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+    // Count mipmap levels required
+    while ((mipWidth != 1) || (mipHeight != 1))
+    {
+        if (mipWidth != 1) mipWidth /= 2;
+        if (mipHeight != 1) mipHeight /= 2;
 
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+
+        TRACELOG(LOG_DEBUG, "IMAGE: Next mipmap level: %i x %i - current size %i", mipWidth, mipHeight, mipSize);
+
+        mipCount++;
+        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
     }
 
-    return pixels;
+    if (image->mipmaps < mipCount)
+    {
+        // Create second buffer and copy data manually to it
+        void *temp = RL_CALLOC(mipSize, 1);
+        memcpy(temp, image->data, GetPixelDataSize(image->width, image->height, image->format));
+        UnloadImage(*image);
+        image->data = temp;
+
+        // Pointer to allocated memory point where store next mipmap level data
+        unsigned char *nextmip = (unsigned char *)image->data;
+
+        mipWidth = image->width;
+        mipHeight = image->height;
+        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+        Image imCopy = ImageCopy(*image);
+
+        for (int i = 1; i < mipCount; i++)
+        {
+            nextmip += mipSize;
+
+            mipWidth /= 2;
+            mipHeight /= 2;
+
+            // Security check for NPOT textures
+            if (mipWidth < 1) mipWidth = 1;
+            if (mipHeight < 1) mipHeight = 1;
+
+            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+
+            if (i < image->mipmaps) continue;
+
+            TRACELOG(LOG_DEBUG, "IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+            memcpy(nextmip, imCopy.data, mipSize);
+        }
+
+        UnloadImage(imCopy);
+
+        image->mipmaps = mipCount;
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
 }
 
-// Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
-Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+// NOTE: In case selected bpp do not represent a known 16bit format,
+// dithered data is stored in the LSB part of the unsigned short
+void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    int palCount = 0;
-    Color *palette = NULL;
-    Color *pixels = LoadImageColors(image);
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be dithered");
+        return;
+    }
 
-    if (pixels != NULL)
+    if ((rBpp + gBpp + bBpp + aBpp) > 16)
     {
-        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+        TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
+    }
+    else
+    {
+        Color *pixels = LoadImageColors(*image);
 
-        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+        UnloadImage(*image);      // free old image data
 
-        for (int i = 0; i < image.width*image.height; i++)
+        if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
         {
-            if (pixels[i].a > 0)
-            {
-                bool colorInPalette = false;
+            TRACELOG(LOG_WARNING, "IMAGE: Format is already 16bpp or lower, dithering could have no effect");
+        }
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
+        // Define new image format, check if desired bpp match internal known format
+        if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+        else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+        else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) image->format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+        else
+        {
+            image->format = 0;
+            TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
+        }
+
+        // NOTE: Storing the dithered data as unsigned short (16bpp)
+        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+        Color oldPixel = WHITE;
+        Color newPixel = WHITE;
+
+        int rError = 0;
+        int gError = 0;
+        int bError = 0;
+        unsigned short rPixel = 0;   // Used for 16bit pixel composition
+        unsigned short gPixel = 0;
+        unsigned short bPixel = 0;
+        unsigned short aPixel = 0;
+
+        #define MIN(a,b) (((a)<(b))?(a):(b))
+
+        for (int y = 0; y < image->height; y++)
+        {
+            for (int x = 0; x < image->width; x++)
+            {
+                oldPixel = pixels[y*image->width + x];
+
+                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
+                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+
+                // NOTE: Error must be computed between new and old pixel but using same number of bits,
+                // to know how much color precision has been lost
+                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+
+                pixels[y*image->width + x] = newPixel;
+
+                // NOTE: Some cases are out of the array and should be ignored
+                if (x < (image->width - 1))
+                {
+                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
                 }
 
-                // Store color if not on the palette
-                if (!colorInPalette)
+                if ((x > 0) && (y < (image->height - 1)))
                 {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+                }
 
-                    // Reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
+                if (y < (image->height - 1))
+                {
+                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
+                }
+
+                if ((x < (image->width - 1)) && (y < (image->height - 1)))
+                {
+                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+                }
+
+                rPixel = (unsigned short)newPixel.r;
+                gPixel = (unsigned short)newPixel.g;
+                bPixel = (unsigned short)newPixel.b;
+                aPixel = (unsigned short)newPixel.a;
+
+                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+            }
+        }
+
+        UnloadImageColors(pixels);
+    }
+}
+
+// Flip image vertically
+void ImageFlipVertical(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+
+        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        {
+            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
+            offsetSize += image->width*bytesPerPixel;
+        }
+
+        UnloadImage(*image);
+        image->data = flippedData;
+    }
+}
+
+// Flip image horizontally
+void ImageFlipHorizontal(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+
+        for (int y = 0; y < image->height; y++)
+        {
+            for (int x = 0; x < image->width; x++)
+            {
+                // OPTION 1: Move pixels with memcpy()
+                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
+
+                // OPTION 2: Copy data pixel by pixel
+                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
+            }
+        }
+
+        UnloadImage(*image);
+        image->data = flippedData;
+
+        /*
+        // OPTION 3: Faster implementation (specific for 32bit pixels)
+        // NOTE: It does not require additional allocations
+        uint32_t *ptr = (uint32_t *)image->data;
+        for (int y = 0; y < image->height; y++)
+        {
+            for (int x = 0; x < image->width/2; x++)
+            {
+                uint32_t backup = ptr[y*image->width + x];
+                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
+                ptr[y*image->width + (image->width - 1 - x)] = backup;
+            }
+        }
+        */
+    }
+}
+
+// Rotate image in degrees
+void ImageRotate(Image *image, int degrees)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        float rad = degrees*PI/180.0f;
+        float sinRadius = sinf(rad);
+        float cosRadius = cosf(rad);
+
+        int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
+        int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
+
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
+                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
+
+                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
+                {
+                    int x1 = (int)floorf(oldX);
+                    int y1 = (int)floorf(oldY);
+                    int x2 = MIN(x1 + 1, image->width - 1);
+                    int y2 = MIN(y1 + 1, image->height - 1);
+
+                    float px = oldX - x1;
+                    float py = oldY - y1;
+
+                    for (int i = 0; i < bytesPerPixel; i++)
                     {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
+                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
+                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
+                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
+
+                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+
+                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
                     }
                 }
-            }
-        }
+            }
+        }
+
+        UnloadImage(*image);
+        image->data = rotatedData;
+        image->width = width;
+        image->height = height;
+    }
+}
+
+// Rotate image clockwise 90deg
+void ImageRotateCW(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+
+        for (int y = 0; y < image->height; y++)
+        {
+            for (int x = 0; x < image->width; x++)
+            {
+                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
+                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
+            }
+        }
+
+        UnloadImage(*image);
+        image->data = rotatedData;
+        int width = image->width;
+        int height = image-> height;
+
+        image->width = height;
+        image->height = width;
+    }
+}
+
+// Rotate image counter-clockwise 90deg
+void ImageRotateCCW(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+
+        for (int y = 0; y < image->height; y++)
+        {
+            for (int x = 0; x < image->width; x++)
+            {
+                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
+                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
+            }
+        }
+
+        UnloadImage(*image);
+        image->data = rotatedData;
+        int width = image->width;
+        int height = image-> height;
+
+        image->width = height;
+        image->height = width;
+    }
+}
+
+// Modify image color: tint
+void ImageColorTint(Image *image, Color color)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    Color *pixels = LoadImageColors(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
+        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
+        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
+        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+
+        pixels[i].r = r;
+        pixels[i].g = g;
+        pixels[i].b = b;
+        pixels[i].a = a;
+    }
+
+    int format = image->format;
+    UnloadImage(*image);
+
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    ImageFormat(image, format);
+}
+
+// Modify image color: invert
+void ImageColorInvert(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    Color *pixels = LoadImageColors(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        pixels[i].r = 255 - pixels[i].r;
+        pixels[i].g = 255 - pixels[i].g;
+        pixels[i].b = 255 - pixels[i].b;
+    }
+
+    int format = image->format;
+    UnloadImage(*image);
+
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    ImageFormat(image, format);
+}
+
+// Modify image color: grayscale
+void ImageColorGrayscale(Image *image)
+{
+    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+}
+
+// Modify image color: contrast
+// NOTE: Contrast values between -100 and 100
+void ImageColorContrast(Image *image, float contrast)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+
+    Color *pixels = LoadImageColors(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        float pR = (float)pixels[i].r/255.0f;
+        pR -= 0.5f;
+        pR *= contrast;
+        pR += 0.5f;
+        pR *= 255;
+        if (pR < 0) pR = 0;
+        if (pR > 255) pR = 255;
+
+        float pG = (float)pixels[i].g/255.0f;
+        pG -= 0.5f;
+        pG *= contrast;
+        pG += 0.5f;
+        pG *= 255;
+        if (pG < 0) pG = 0;
+        if (pG > 255) pG = 255;
+
+        float pB = (float)pixels[i].b/255.0f;
+        pB -= 0.5f;
+        pB *= contrast;
+        pB += 0.5f;
+        pB *= 255;
+        if (pB < 0) pB = 0;
+        if (pB > 255) pB = 255;
+
+        pixels[i].r = (unsigned char)pR;
+        pixels[i].g = (unsigned char)pG;
+        pixels[i].b = (unsigned char)pB;
+    }
+
+    int format = image->format;
+    UnloadImage(*image);
+
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    ImageFormat(image, format);
+}
+
+// Modify image color: brightness
+// NOTE: Brightness values between -255 and 255
+void ImageColorBrightness(Image *image, int brightness)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    Color *pixels = LoadImageColors(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        int cR = pixels[i].r + brightness;
+        int cG = pixels[i].g + brightness;
+        int cB = pixels[i].b + brightness;
+
+        if (cR < 0) cR = 1;
+        if (cR > 255) cR = 255;
+
+        if (cG < 0) cG = 1;
+        if (cG > 255) cG = 255;
+
+        if (cB < 0) cB = 1;
+        if (cB > 255) cB = 255;
+
+        pixels[i].r = (unsigned char)cR;
+        pixels[i].g = (unsigned char)cG;
+        pixels[i].b = (unsigned char)cB;
+    }
+
+    int format = image->format;
+    UnloadImage(*image);
+
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    ImageFormat(image, format);
+}
+
+// Modify image color: replace color
+void ImageColorReplace(Image *image, Color color, Color replace)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    Color *pixels = LoadImageColors(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        if ((pixels[i].r == color.r) &&
+            (pixels[i].g == color.g) &&
+            (pixels[i].b == color.b) &&
+            (pixels[i].a == color.a))
+        {
+            pixels[i].r = replace.r;
+            pixels[i].g = replace.g;
+            pixels[i].b = replace.b;
+            pixels[i].a = replace.a;
+        }
+    }
+
+    int format = image->format;
+    UnloadImage(*image);
+
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    // Only convert back to original format if it supported alpha
+    if ((format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+        (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+        (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+        (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+        (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+        (format == PIXELFORMAT_COMPRESSED_DXT1_RGB) ||
+        (format == PIXELFORMAT_COMPRESSED_ETC1_RGB) ||
+        (format == PIXELFORMAT_COMPRESSED_ETC2_RGB) ||
+        (format == PIXELFORMAT_COMPRESSED_PVRT_RGB)) ImageFormat(image, format);
+}
+
+// Load color data from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImageColors();
+Color *LoadImageColors(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL; // Security check
+
+    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[i];
+                    pixels[i].g = ((unsigned char *)image.data)[i];
+                    pixels[i].b = ((unsigned char *)image.data)[i];
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k];
+                    pixels[i].b = ((unsigned char *)image.data)[k];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+// Load colors palette from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImagePalette()
+Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+{
+    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = LoadImageColors(image);
+
+    if (pixels != NULL)
+    {
+        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+
+        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+
+        for (int i = 0; i < image.width*image.height; i++)
+        {
+            if (pixels[i].a > 0)
+            {
+                bool colorInPalette = false;
+
+                // Check if the color is already on palette
+                for (int j = 0; j < maxPaletteSize; j++)
+                {
+                    if (COLOR_EQUAL(pixels[i], palette[j]))
+                    {
+                        colorInPalette = true;
+                        break;
+                    }
+                }
+
+                // Store color if not on the palette
+                if (!colorInPalette)
+                {
+                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
+                    palCount++;
+
+                    // Reached the limit of colors supported by palette
+                    if (palCount >= maxPaletteSize)
+                    {
+                        i = image.width*image.height;   // Finish palette get
+                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                    }
+                }
+            }
+        }
+
+        UnloadImageColors(pixels);
+    }
+
+    *colorCount = palCount;
+
+    return palette;
+}
+
+// Unload color data loaded with LoadImageColors()
+void UnloadImageColors(Color *colors)
+{
+    RL_FREE(colors);
+}
+
+// Unload colors palette loaded with LoadImagePalette()
+void UnloadImagePalette(Color *colors)
+{
+    RL_FREE(colors);
+}
+
+// Get image alpha border rectangle
+// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
+Rectangle GetImageAlphaBorder(Image image, float threshold)
+{
+    Rectangle crop = { 0 };
+
+    Color *pixels = LoadImageColors(image);
+
+    if (pixels != NULL)
+    {
+        int xMin = 65536;   // Define a big enough number
+        int xMax = 0;
+        int yMin = 65536;
+        int yMax = 0;
+
+        for (int y = 0; y < image.height; y++)
+        {
+            for (int x = 0; x < image.width; x++)
+            {
+                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
+                {
+                    if (x < xMin) xMin = x;
+                    if (x > xMax) xMax = x;
+                    if (y < yMin) yMin = y;
+                    if (y > yMax) yMax = y;
+                }
+            }
+        }
+
+        // Check for empty blank image
+        if ((xMin != 65536) && (xMax != 65536))
+        {
+            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+        }
+
+        UnloadImageColors(pixels);
+    }
+
+    return crop;
+}
+
+// Get image pixel color at (x, y) position
+Color GetImageColor(Image image, int x, int y)
+{
+    Color color = { 0 };
+
+    if ((x >=0) && (x < image.width) && (y >= 0) && (y < image.height))
+    {
+        switch (image.format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                color.r = ((unsigned char *)image.data)[y*image.width + x];
+                color.g = ((unsigned char *)image.data)[y*image.width + x];
+                color.b = ((unsigned char *)image.data)[y*image.width + x];
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                color.r = ((unsigned char *)image.data)[(y*image.width + x)*2];
+                color.g = ((unsigned char *)image.data)[(y*image.width + x)*2];
+                color.b = ((unsigned char *)image.data)[(y*image.width + x)*2];
+                color.a = ((unsigned char *)image.data)[(y*image.width + x)*2 + 1];
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
+
+                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                color.g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                color.b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                color.a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
+
+                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                color.g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                color.b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
+
+                color.r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                color.g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                color.b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                color.a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                color.r = ((unsigned char *)image.data)[(y*image.width + x)*4];
+                color.g = ((unsigned char *)image.data)[(y*image.width + x)*4 + 1];
+                color.b = ((unsigned char *)image.data)[(y*image.width + x)*4 + 2];
+                color.a = ((unsigned char *)image.data)[(y*image.width + x)*4 + 3];
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                color.r = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3];
+                color.g = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 1];
+                color.b = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 2];
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                color.r = (unsigned char)(((float *)image.data)[y*image.width + x]*255.0f);
+                color.g = 0;
+                color.b = 0;
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*3]*255.0f);
+                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 1]*255.0f);
+                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 2]*255.0f);
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
+                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 1]*255.0f);
+                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 2]*255.0f);
+                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 3]*255.0f);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
+                color.g = 0;
+                color.b = 0;
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
+                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
+                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 1])*255.0f);
+                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 2])*255.0f);
+                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 3])*255.0f);
+
+            } break;
+            default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
+        }
+    }
+    else TRACELOG(LOG_WARNING, "Requested image pixel (%i, %i) out of bounds", x, y);
+
+    return color;
+}
+
+//------------------------------------------------------------------------------------
+// Image pipeline functions
+//------------------------------------------------------------------------------------
+// Load image pipeline, empty by default (no operations recorded)
+ImagePipeline LoadImagePipeline(void)
+{
+    ImagePipeline pipeline = { 0 };
+
+    return pipeline;
+}
+
+// Unload image pipeline operations data
+void UnloadImagePipeline(ImagePipeline pipeline)
+{
+    RL_FREE(pipeline.ops);
+}
+
+// Set image pipeline output size, image is resized before applying recorded operations
+// NOTE: Area-average filtering used for downscaling, bilinear filtering for upscaling
+void ImagePipelineResize(ImagePipeline *pipeline, int newWidth, int newHeight)
+{
+    pipeline->width = newWidth;
+    pipeline->height = newHeight;
+}
+
+// Set image pipeline output pixel format, converted after applying recorded operations
+void ImagePipelineFormat(ImagePipeline *pipeline, int newFormat)
+{
+    pipeline->format = newFormat;
+}
+
+// Record image pipeline operation: tint
+void ImagePipelineColorTint(ImagePipeline *pipeline, Color color)
+{
+    ImagePipelineOp op = { IMAGE_PIPELINE_OP_TINT, color };
+    AddImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: invert
+void ImagePipelineColorInvert(ImagePipeline *pipeline)
+{
+    ImagePipelineOp op = { IMAGE_PIPELINE_OP_INVERT };
+    AddImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: grayscale
+// NOTE: Color channels are set to luminance, alpha and pixel format are kept
+void ImagePipelineColorGrayscale(ImagePipeline *pipeline)
+{
+    ImagePipelineOp op = { IMAGE_PIPELINE_OP_GRAYSCALE };
+    AddImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: contrast (-100 to 100)
+void ImagePipelineColorContrast(ImagePipeline *pipeline, float contrast)
+{
+    ImagePipelineOp op = { IMAGE_PIPELINE_OP_CONTRAST };
+
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    op.value = (100.0f + contrast)/100.0f;
+    op.value *= op.value;
+
+    AddImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: brightness (-255 to 255)
+void ImagePipelineColorBrightness(ImagePipeline *pipeline, int brightness)
+{
+    ImagePipelineOp op = { IMAGE_PIPELINE_OP_BRIGHTNESS };
+
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    op.value = (float)brightness;
+
+    AddImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: replace color
+void ImagePipelineColorReplace(ImagePipeline *pipeline, Color color, Color replace)
+{
+    ImagePipelineOp op = { IMAGE_PIPELINE_OP_REPLACE, color, replace };
+    AddImagePipelineOp(pipeline, op);
+}
+
+// Record image pipeline operation: premultiply alpha
+void ImagePipelineAlphaPremultiply(ImagePipeline *pipeline)
+{
+    ImagePipelineOp op = { IMAGE_PIPELINE_OP_PREMULTIPLY };
+    AddImagePipelineOp(pipeline, op);
+}
+
+// Apply image pipeline to image in a single pass over pixel data
+// NOTE: Consecutive per-channel operations (tint, invert, contrast, brightness) are fused into
+// lookup tables, rows are processed in bands on multiple threads, only base mipmap level is kept
+void ImageApplyPipeline(Image *image, ImagePipeline pipeline)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pipeline can not be applied to compressed image formats");
+        return;
+    }
+
+    int width = (pipeline.width > 0)? pipeline.width : image->width;
+    int height = (pipeline.height > 0)? pipeline.height : image->height;
+    int format = (pipeline.format > 0)? pipeline.format : image->format;
+
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pipeline output format must be uncompressed");
+        return;
+    }
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "IMAGE: Pipeline only applied to base mipmap level, mipmaps discarded");
+
+    ImagePipelineJob job = { 0 };
+    job.src = *image;
+    job.dst.width = width;
+    job.dst.height = height;
+    job.dst.format = format;
+    job.dst.mipmaps = 1;
+
+    // Same size and format pipelines are applied in-place, rows are processed independently
+    bool inPlace = ((width == image->width) && (height == image->height) && (format == image->format));
+    job.dst.data = inPlace? image->data : RL_MALLOC(GetPixelDataSize(width, height, format));
+
+    // Compile recorded operations into stages, per-channel operations fused into lookup tables
+    job.stages = (ImagePipelineStage *)RL_CALLOC(pipeline.opCount + 1, sizeof(ImagePipelineStage));
+    ImagePipelineOp *ops = (ImagePipelineOp *)pipeline.ops;
+
+    for (int i = 0; i < pipeline.opCount; i++)
+    {
+        ImagePipelineStage *stage = &job.stages[job.stageCount];
+
+        if ((ops[i].type == IMAGE_PIPELINE_OP_GRAYSCALE) ||
+            (ops[i].type == IMAGE_PIPELINE_OP_REPLACE) ||
+            (ops[i].type == IMAGE_PIPELINE_OP_PREMULTIPLY))
+        {
+            if (stage->type == IMAGE_PIPELINE_OP_LUT) stage = &job.stages[++job.stageCount];
+
+            stage->type = ops[i].type;
+            stage->color = ops[i].color;
+            stage->replace = ops[i].replace;
+            job.stageCount++;
+            continue;
+        }
+
+        if (stage->type != IMAGE_PIPELINE_OP_LUT)
+        {
+            stage->type = IMAGE_PIPELINE_OP_LUT;
+            for (int c = 0; c < 4; c++) for (int v = 0; v < 256; v++) stage->lut[c][v] = (unsigned char)v;
+        }
+
+        for (int c = 0; c < 4; c++)
+        {
+            for (int v = 0; v < 256; v++)
+            {
+                int value = stage->lut[c][v];
+
+                switch (ops[i].type)
+                {
+                    case IMAGE_PIPELINE_OP_TINT: value = (value*((unsigned char *)&ops[i].color)[c])/255; break;
+                    case IMAGE_PIPELINE_OP_INVERT: if (c < 3) value = 255 - value; break;
+                    case IMAGE_PIPELINE_OP_CONTRAST:
+                    {
+                        if (c < 3)
+                        {
+                            float p = ((((float)value/255.0f) - 0.5f)*ops[i].value + 0.5f)*255;
+                            if (p < 0) p = 0;
+                            if (p > 255) p = 255;
+                            value = (int)p;
+                        }
+                    } break;
+                    case IMAGE_PIPELINE_OP_BRIGHTNESS:
+                    {
+                        if (c < 3)
+                        {
+                            value += (int)ops[i].value;
+                            if (value < 0) value = 1;
+                            if (value > 255) value = 255;
+                        }
+                    } break;
+                    default: break;
+                }
+
+                stage->lut[c][v] = (unsigned char)value;
+            }
+        }
+    }
+
+    if (job.stages[job.stageCount].type == IMAGE_PIPELINE_OP_LUT) job.stageCount++;
+
+    // Resampling contributions, computed once for all rows
+    if ((width != image->width) || (height != image->height))
+    {
+        job.tapsX = LoadResampleWeights(image->width, width, &job.firstX, &job.weightsX);
+        job.tapsY = LoadResampleWeights(image->height, height, &job.firstY, &job.weightsY);
+    }
+
+    // Process rows in bands sized to keep working set in cache
+    int bandRows = IMAGE_JOB_BAND_SIZE/(width*(int)sizeof(Color));
+    if (bandRows < 1) bandRows = 1;
+
+    RunImageJob(ProcessImagePipelineRows, &job, height, bandRows);
+
+    RL_FREE(job.stages);
+    RL_FREE(job.firstX);
+    RL_FREE(job.weightsX);
+    RL_FREE(job.firstY);
+    RL_FREE(job.weightsY);
+
+    if (!inPlace) UnloadImage(*image);
+
+    *image = job.dst;
+}
+
+//------------------------------------------------------------------------------------
+// Image drawing functions
+//------------------------------------------------------------------------------------
+// Clear image background with given color
+void ImageClearBackground(Image *dst, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    // Fill in first pixel based on image format
+    ImageDrawPixel(dst, 0, 0, color);
+
+    unsigned char *pSrcPixel = (unsigned char *)dst->data;
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    int totalPixels = dst->width*dst->height;
+
+    // Repeat the first pixel data throughout the image,
+    // doubling the pixels copied on each iteration
+    for (int i = 1; i < totalPixels; i *= 2)
+    {
+        int pixelsToCopy = MIN(i, totalPixels - i);
+        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, pixelsToCopy*bytesPerPixel);
+    }
+}
+
+// Draw pixel within an image
+// NOTE: Compressed image formats not supported
+void ImageDrawPixel(Image *dst, int x, int y, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
+
+    switch (dst->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
+
+        } break;
+        default: break;
+    }
+}
+
+// Draw pixel within an image (Vector version)
+void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
+{
+    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
+}
+
+// Draw line within an image
+void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
+{
+    // Calculate differences in coordinates
+    int shortLen = endPosY - startPosY;
+    int longLen = endPosX - startPosX;
+    bool yLonger = false;
+
+    // Determine if the line is more vertical than horizontal
+    if (abs(shortLen) > abs(longLen))
+    {
+        // Swap the lengths if the line is more vertical
+        int temp = shortLen;
+        shortLen = longLen;
+        longLen = temp;
+        yLonger = true;
+    }
+
+    // Initialize variables for drawing loop
+    int endVal = longLen;
+    int sgnInc = 1;
+
+    // Adjust direction increment based on longLen sign
+    if (longLen < 0)
+    {
+        longLen = -longLen;
+        sgnInc = -1;
+    }
+
+    // Calculate fixed-point increment for shorter length
+    int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
+
+    // Draw the line pixel by pixel
+    if (yLonger)
+    {
+        // If line is more vertical, iterate over y-axis
+        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
+        {
+            // Calculate pixel position and draw it
+            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
+        }
+    }
+    else
+    {
+        // If line is more horizontal, iterate over x-axis
+        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
+        {
+            // Calculate pixel position and draw it
+            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
+        }
+    }
+}
+
+// Draw line within an image (Vector version)
+void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
+{
+    // Round start and end positions to nearest integer coordinates
+    int x1 = (int)(start.x + 0.5f);
+    int y1 = (int)(start.y + 0.5f);
+    int x2 = (int)(end.x + 0.5f);
+    int y2 = (int)(end.y + 0.5f);
+
+    // Draw a vertical line using ImageDrawLine function
+    ImageDrawLine(dst, x1, y1, x2, y2, color);
+}
+
+// Draw a line defining thickness within an image
+void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color color)
+{
+    // Round start and end positions to nearest integer coordinates
+    int x1 = (int)(start.x + 0.5f);
+    int y1 = (int)(start.y + 0.5f);
+    int x2 = (int)(end.x + 0.5f);
+    int y2 = (int)(end.y + 0.5f);
+
+    // Calculate differences in x and y coordinates
+    int dx = x2 - x1;
+    int dy = y2 - y1;
+
+    // Determine if the line is more horizontal or vertical
+    if ((dx != 0) && (abs(dy/dx) < 1))
+    {
+        // Line is more horizontal
+
+        // How many additional lines to draw
+        int wy = thick - 1;
+
+        // Draw the main line and lower half
+        for (int i = 0; i <= ((wy+1)/2); i++)
+        {
+            ImageDrawLine(dst, x1, y1 + i, x2, y2 + i, color);
+        }
+
+        // Draw the upper half
+        for (int i = 1; i <= (wy/2); i++)
+        {
+            ImageDrawLine(dst, x1, y1 - i, x2, y2 - i, color);
+        }
+    }
+    else if (dy != 0)
+    {
+        // Line is more vertical or perfectly horizontal
+
+        // How many additional lines to draw
+        int wx = thick - 1;
+
+        //Draw the main line and right half
+        for (int i = 0; i <= ((wx+1)/2); i++)
+        {
+            ImageDrawLine(dst, x1 + i, y1, x2 + i, y2, color);
+        }
+
+        // Draw the left half
+        for (int i = 1; i <= (wx/2); i++)
+        {
+            ImageDrawLine(dst, x1 - i, y1, x2 - i, y2, color);
+        }
+    }
+}
+
+// Draw circle within an image
+void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color)
+{
+    int x = 0;
+    int y = radius;
+    int decesionParameter = 3 - 2*radius;
+
+    while (y >= x)
+    {
+        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
+        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
+        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
+        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        x++;
+
+        if (decesionParameter > 0)
+        {
+            y--;
+            decesionParameter = decesionParameter + 4*(x - y) + 10;
+        }
+        else decesionParameter = decesionParameter + 4*x + 6;
+    }
+}
+
+// Draw circle within an image (Vector version)
+void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color)
+{
+    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
+}
+
+// Draw circle outline within an image
+void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
+{
+    int x = 0;
+    int y = radius;
+    int decesionParameter = 3 - 2*radius;
+
+    while (y >= x)
+    {
+        ImageDrawPixel(dst, centerX + x, centerY + y, color);
+        ImageDrawPixel(dst, centerX - x, centerY + y, color);
+        ImageDrawPixel(dst, centerX + x, centerY - y, color);
+        ImageDrawPixel(dst, centerX - x, centerY - y, color);
+        ImageDrawPixel(dst, centerX + y, centerY + x, color);
+        ImageDrawPixel(dst, centerX - y, centerY + x, color);
+        ImageDrawPixel(dst, centerX + y, centerY - x, color);
+        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        x++;
+
+        if (decesionParameter > 0)
+        {
+            y--;
+            decesionParameter = decesionParameter + 4*(x - y) + 10;
+        }
+        else decesionParameter = decesionParameter + 4*x + 6;
+    }
+}
+
+// Draw circle outline within an image (Vector version)
+void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color)
+{
+    ImageDrawCircleLines(dst, (int)center.x, (int)center.y, radius, color);
+}
+
+// Draw rectangle within an image
+void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
+{
+    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
+}
+
+// Draw rectangle within an image (Vector version)
+void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
+{
+    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
+}
+
+// Draw rectangle within an image
+void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    // Security check to avoid drawing out of bounds in case of bad user data
+    if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
+    if (rec.y < 0) { rec.height += rec.y; rec.y = 0; }
+    if (rec.width < 0) rec.width = 0;
+    if (rec.height < 0) rec.height = 0;
+
+    // Clamp the size the the image bounds
+    if ((rec.x + rec.width) >= dst->width) rec.width = dst->width - rec.x;
+    if ((rec.y + rec.height) >= dst->height) rec.height = dst->height - rec.y;
+
+    // Check if the rect is even inside the image
+    if ((rec.x >= dst->width) || (rec.y >= dst->height)) return;
+    if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return;
+
+    int sy = (int)rec.y;
+    int sx = (int)rec.x;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+
+    // Fill in the first pixel of the first row based on image format
+    ImageDrawPixel(dst, sx, sy, color);
+
+    int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
+    unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
+
+    // Repeat the first pixel data throughout the row
+    for (int x = 1; x < (int)rec.width; x *= 2)
+    {
+        int pixelsToCopy = MIN(x, (int)rec.width - x);
+        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, pixelsToCopy*bytesPerPixel);
+    }
+
+    // Repeat the first row data for all other rows
+    int bytesPerRow = bytesPerPixel*(int)rec.width;
+    for (int y = 1; y < (int)rec.height; y++)
+    {
+        memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
+    }
+}
+
+// Draw rectangle lines within an image
+void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
+{
+    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
+}
+
+// Draw triangle within an image
+void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    // Calculate the 2D bounding box of the triangle
+    // Determine the minimum and maximum x and y coordinates of the triangle vertices
+    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
+    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
+    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
+    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
+
+    // Clamp the bounding box to the image dimensions
+    if (xMin < 0) xMin = 0;
+    if (yMin < 0) yMin = 0;
+    if (xMax > dst->width) xMax = dst->width;
+    if (yMax > dst->height) yMax = dst->height;
+
+    // Check the order of the vertices to determine if it's a front or back face
+    // NOTE: if signedArea is equal to 0, the face is degenerate
+    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
+    bool isBackFace = (signedArea > 0);
+
+    // Barycentric interpolation setup
+    // Calculate the step increments for the barycentric coordinates
+    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
+    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
+    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+
+    // If the triangle is a back face, invert the steps
+    if (isBackFace)
+    {
+        w1XStep = -w1XStep, w1YStep = -w1YStep;
+        w2XStep = -w2XStep, w2YStep = -w2YStep;
+        w3XStep = -w3XStep, w3YStep = -w3YStep;
+    }
+
+    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
+    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
+    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
+    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+
+    // Rasterization loop
+    // Iterate through each pixel in the bounding box
+    for (int y = yMin; y <= yMax; y++)
+    {
+        int w1 = w1Row;
+        int w2 = w2Row;
+        int w3 = w3Row;
+
+        for (int x = xMin; x <= xMax; x++)
+        {
+            // Check if the pixel is inside the triangle using barycentric coordinates
+            // If it is, the pixel can be drawn with the given color
+            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
+
+            // Increment the barycentric coordinates for the next pixel
+            w1 += w1XStep;
+            w2 += w2XStep;
+            w3 += w3XStep;
+        }
+
+        // Move to the next row in the bounding box
+        w1Row += w1YStep;
+        w2Row += w2YStep;
+        w3Row += w3YStep;
+    }
+}
+
+// Draw triangle with interpolated colors within an image
+void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3)
+{
+    // Calculate the 2D bounding box of the triangle
+    // Determine the minimum and maximum x and y coordinates of the triangle vertices
+    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
+    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
+    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
+    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
+
+    // Clamp the bounding box to the image dimensions
+    if (xMin < 0) xMin = 0;
+    if (yMin < 0) yMin = 0;
+    if (xMax > dst->width) xMax = dst->width;
+    if (yMax > dst->height) yMax = dst->height;
+
+    // Check the order of the vertices to determine if it's a front or back face
+    // NOTE: if signedArea is equal to 0, the face is degenerate
+    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
+    bool isBackFace = (signedArea > 0);
+
+    // Barycentric interpolation setup
+    // Calculate the step increments for the barycentric coordinates
+    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
+    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
+    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+
+    // If the triangle is a back face, invert the steps
+    if (isBackFace)
+    {
+        w1XStep = -w1XStep, w1YStep = -w1YStep;
+        w2XStep = -w2XStep, w2YStep = -w2YStep;
+        w3XStep = -w3XStep, w3YStep = -w3YStep;
+    }
+
+    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
+    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
+    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
+    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+
+    // Calculate the inverse of the sum of the barycentric coordinates for normalization
+    float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
+
+    // Rasterization loop
+    // Iterate through each pixel in the bounding box
+    for (int y = yMin; y <= yMax; y++)
+    {
+        int w1 = w1Row;
+        int w2 = w2Row;
+        int w3 = w3Row;
+
+        for (int x = xMin; x <= xMax; x++)
+        {
+            // Check if the pixel is inside the triangle using barycentric coordinates
+            if ((w1 | w2 | w3) >= 0)
+            {
+                // Compute the normalized barycentric coordinates
+                unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
+                unsigned char aW2 = (unsigned char)((float)w2*wInvSum);
+                unsigned char aW3 = (unsigned char)((float)w3*wInvSum);
+
+                // Interpolate the color using the barycentric coordinates
+                Color finalColor = { 0 };
+                finalColor.r = (c1.r*aW1 + c2.r*aW2 + c3.r*aW3)/255;
+                finalColor.g = (c1.g*aW1 + c2.g*aW2 + c3.g*aW3)/255;
+                finalColor.b = (c1.b*aW1 + c2.b*aW2 + c3.b*aW3)/255;
+                finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
+
+                // Draw the pixel with the interpolated color
+                ImageDrawPixel(dst, x, y, finalColor);
+            }
+
+            // Increment the barycentric coordinates for the next pixel
+            w1 += w1XStep;
+            w2 += w2XStep;
+            w3 += w3XStep;
+        }
+
+        // Move to the next row in the bounding box
+        w1Row += w1YStep;
+        w2Row += w2YStep;
+        w3Row += w3YStep;
+    }
+}
+
+// Draw triangle outline within an image
+void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    ImageDrawLine(dst, (int)v1.x, (int)v1.y, (int)v2.x, (int)v2.y, color);
+    ImageDrawLine(dst, (int)v2.x, (int)v2.y, (int)v3.x, (int)v3.y, color);
+    ImageDrawLine(dst, (int)v3.x, (int)v3.y, (int)v1.x, (int)v1.y, color);
+}
+
+// Draw a triangle fan defined by points within an image (first vertex is the center)
+void ImageDrawTriangleFan(Image *dst, const Vector2 *points, int pointCount, Color color)
+{
+    if (pointCount >= 3)
+    {
+        for (int i = 1; i < pointCount - 1; i++)
+        {
+            ImageDrawTriangle(dst, points[0], points[i], points[i + 1], color);
+        }
+    }
+}
+
+// Draw a triangle strip defined by points within an image
+void ImageDrawTriangleStrip(Image *dst, const Vector2 *points, int pointCount, Color color)
+{
+    if (pointCount >= 3)
+    {
+        for (int i = 2; i < pointCount; i++)
+        {
+            if ((i%2) == 0) ImageDrawTriangle(dst, points[i], points[i - 2], points[i - 1], color);
+            else ImageDrawTriangle(dst, points[i], points[i - 1], points[i - 2], color);
+        }
+    }
+}
+
+// Draw an image (source) within an image (destination)
+// NOTE: Color tint is applied to source image
+void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    else
+    {
+        Image srcMod = { 0 };       // Source copy (in case it was required)
+        Image *srcPtr = &src;       // Pointer to source image
+        bool useSrcMod = false;     // Track source copy required
+
+        // Source rectangle out-of-bounds security checks
+        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
+        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
+        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
+        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+
+        // Check if source rectangle needs to be resized to destination rectangle
+        // In that case, make a copy of source, and apply all required transform
+        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+        {
+            srcMod = ImageFromImage(src, srcRec); // Create image from another image
+            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height); // Resize to destination rectangle
+            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+
+            srcPtr = &srcMod;
+            useSrcMod = true;
+        }
+
+        // Destination rectangle out-of-bounds security checks
+        if (dstRec.x < 0)
+        {
+            srcRec.x -= dstRec.x;
+            srcRec.width += dstRec.x;
+            dstRec.x = 0;
+        }
+        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+
+        if (dstRec.y < 0)
+        {
+            srcRec.y -= dstRec.y;
+            srcRec.height += dstRec.y;
+            dstRec.y = 0;
+        }
+        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
+
+        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
+        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+
+        // This blitting method is quite fast! The process followed is:
+        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
+        // Some optimization ideas:
+        //    [x] Avoid creating source copy if not required (no resize required)
+        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
+        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
+        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
+        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
+        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
+        //    [ ] TODO: Support 16bit and 32bit (float) channels drawing
+
+        Color colSrc = { 0 };
+        Color colDst = { 0 };
+        Color blend = { 0 };
+        bool blendRequired = true;
+
+        // Fast path: Avoid blend if source has no alpha to blend
+        if ((tint.a == 255) &&
+            ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)))
+            blendRequired = false;
+
+        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
+        int bytesPerPixelDst = strideDst/(dst->width);
+
+        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
+        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+
+        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
+        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+
+        for (int y = 0; y < (int)srcRec.height; y++)
+        {
+            unsigned char *pSrc = pSrcBase;
+            unsigned char *pDst = pDstBase;
+
+            // Fast path: Avoid moving pixel by pixel if no blend required and same format
+            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            else
+            {
+                for (int x = 0; x < (int)srcRec.width; x++)
+                {
+                    colSrc = GetPixelColor(pSrc, srcPtr->format);
+                    colDst = GetPixelColor(pDst, dst->format);
+
+                    // Fast path: Avoid blend if source has no alpha to blend
+                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
+                    else blend = colSrc;
+
+                    SetPixelColor(pDst, blend, dst->format);
+
+                    pDst += bytesPerPixelDst;
+                    pSrc += bytesPerPixelSrc;
+                }
+            }
+
+            pSrcBase += strideSrc;
+            pDstBase += strideDst;
+        }
+
+        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+
+        if ((dst->mipmaps > 1) && (src.mipmaps > 1))
+        {
+            Image mipmapDst = *dst;
+            mipmapDst.data = (char *)mipmapDst.data + GetPixelDataSize(mipmapDst.width, mipmapDst.height, mipmapDst.format);
+            mipmapDst.width /= 2;
+            mipmapDst.height /= 2;
+            mipmapDst.mipmaps--;
+
+            Image mipmapSrc = src;
+            mipmapSrc.data = (char *)mipmapSrc.data + GetPixelDataSize(mipmapSrc.width, mipmapSrc.height, mipmapSrc.format);
+            mipmapSrc.width /= 2;
+            mipmapSrc.height /= 2;
+            mipmapSrc.mipmaps--;
+
+            Rectangle mipmapSrcRec = srcRec;
+            mipmapSrcRec.width /= 2;
+            mipmapSrcRec.height /= 2;
+            mipmapSrcRec.x /= 2;
+            mipmapSrcRec.y /= 2;
+
+            Rectangle mipmapDstRec = dstRec;
+            mipmapDstRec.width /= 2;
+            mipmapDstRec.height /= 2;
+            mipmapDstRec.x /= 2;
+            mipmapDstRec.y /= 2;
+
+            ImageDraw(&mipmapDst, mipmapSrc, mipmapSrcRec, mipmapDstRec, tint);
+        }
+    }
+}
+
+// Draw text (default font) within an image (destination)
+void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
+{
+#if SUPPORT_MODULE_RTEXT
+    // Make sure default font is loaded to be used on image text drawing
+    if (GetFontDefault().texture.id == 0) LoadFontDefault();
+
+    Vector2 position = { (float)posX, (float)posY };
+    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, 1.0f, color);   // WARNING: Module required: rtext
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
+#endif
+}
+
+// Draw text (custom sprite font) within an image (destination)
+void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    // Fast path: glyphs coverage blended directly into destination, scaled to fontSize, no text image required
+    if (DrawImageTextCoverage(dst, font, text, position, fontSize, spacing, tint)) return;
+
+    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
+
+    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
+    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+
+    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
+
+    UnloadImage(imText);
+}
+
+//------------------------------------------------------------------------------------
+// Texture loading functions
+//------------------------------------------------------------------------------------
+// Load texture from file into GPU memory (VRAM)
+Texture2D LoadTexture(const char *fileName)
+{
+    Texture2D texture = { 0 };
+
+    Image image = LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    return texture;
+}
+
+// Load a texture from image data
+// NOTE: image is not unloaded, it must be done manually
+Texture2D LoadTextureFromImage(Image image)
+{
+    Texture2D texture = { 0 };
+
+    if ((image.width != 0) && (image.height != 0))
+    {
+        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format = image.format;
+
+    return texture;
+}
+
+// Load cubemap from image, multiple image cubemap layouts supported
+TextureCubemap LoadTextureCubemap(Image image, int layout)
+{
+    TextureCubemap cubemap = { 0 };
+
+    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
+    {
+        // Check image width/height to determine the type of cubemap provided
+        if (image.width > image.height)
+        {
+            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
+            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
+        }
+        else if (image.height > image.width)
+        {
+            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
+            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+        }
+    }
+    else
+    {
+        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL) cubemap.width = image.height/6;
+        if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.width/6;
+        if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
+        if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE) cubemap.width = image.width/4;
+    }
+
+    cubemap.height = cubemap.width;
+
+    // Layout provided or already auto-detected
+    if (layout != CUBEMAP_LAYOUT_AUTO_DETECT)
+    {
+        int size = cubemap.width;
+
+        Image faces = { 0 };                // Vertical column image
+        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
+
+        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, (float)size, (float)size };
+
+        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
+        {
+            faces = ImageCopy(image);       // Image data already follows expected convention
+        }
+        /*else if (layout == CUBEMAP_LAYOUT_PANORAMA)
+        {
+            // TODO: Implement panorama by converting image to square faces...
+            // REF: https://github.com/denivip/panorama/blob/master/panorama.cpp
+        } */
+        else
+        {
+            if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
+            else if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR)
+            {
+                faceRecs[0].x = (float)size; faceRecs[0].y = (float)size;
+                faceRecs[1].x = (float)size; faceRecs[1].y = (float)size*3;
+                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
+                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
+                faceRecs[4].x = 0; faceRecs[4].y = (float)size;
+                faceRecs[5].x = (float)size*2; faceRecs[5].y = (float)size;
+            }
+            else if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE)
+            {
+                faceRecs[0].x = (float)size*2; faceRecs[0].y = (float)size;
+                faceRecs[1].x = 0; faceRecs[1].y = (float)size;
+                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
+                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
+                faceRecs[4].x = (float)size; faceRecs[4].y = (float)size;
+                faceRecs[5].x = (float)size*3; faceRecs[5].y = (float)size;
+            }
+
+            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
+            // NOTE: Image formatting does not work with compressed textures
+            faces = GenImageColor(size, size*6, MAGENTA);
+            ImageFormat(&faces, image.format);
+
+            Image mipmapped = ImageCopy(image);
+            if (image.mipmaps > 1)
+            {
+                ImageMipmaps(&mipmapped);
+                ImageMipmaps(&faces);
+            }
+
+            for (int i = 0; i < 6; i++) ImageDraw(&faces, mipmapped, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
+
+            UnloadImage(mipmapped);
+        }
+
+        // NOTE: Cubemap data is expected to be provided as 6 images in a single data array,
+        // one after the other (that's a vertical image), following convention: +X, -X, +Y, -Y, +Z, -Z
+        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format, faces.mipmaps);
+
+        if (cubemap.id != 0)
+        {
+            cubemap.format = faces.format;
+            cubemap.mipmaps = faces.mipmaps;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
+
+        UnloadImage(faces);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
+
+    return cubemap;
+}
+
+// Load texture for rendering (framebuffer)
+// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
+RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    RenderTexture2D target = { 0 };
+
+    target.id = rlLoadFramebuffer(); // Load an empty framebuffer
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        // Create color texture (default to RGBA)
+        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        target.texture.mipmaps = 1;
+
+        // Create depth renderbuffer/texture
+        target.depth.id = rlLoadTextureDepth(width, height, true);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+
+        // Attach color texture and depth renderbuffer/texture to FBO
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        // Check if fbo is complete with attachments (valid)
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+
+    return target;
+}
+
+// Check if a texture is valid (loaded in GPU)
+bool IsTextureValid(Texture2D texture)
+{
+    bool result = false;
+
+    if ((texture.id > 0) &&         // Validate OpenGL id (texture uplaoded to GPU)
+        (texture.width > 0) &&      // Validate texture width
+        (texture.height > 0) &&     // Validate texture height
+        (texture.format > 0) &&     // Validate texture pixel format
+        (texture.mipmaps > 0)) result = true; // Validate texture mipmaps (at least 1 for basic mipmap level)
+
+    return result;
+}
+
+// Unload texture from GPU memory (VRAM)
+void UnloadTexture(Texture2D texture)
+{
+    if (texture.id > 0)
+    {
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Check if a render texture is valid (loaded in GPU)
+bool IsRenderTextureValid(RenderTexture2D target)
+{
+    bool result = false;
+
+    if ((target.id > 0) &&                  // Validate OpenGL id (loaded on GPU)
+        IsTextureValid(target.depth) &&     // Validate FBO depth texture/renderbuffer attachment
+        IsTextureValid(target.texture)) result = true; // Validate FBO texture attachment
+
+    return result;
+}
+
+// Unload render texture from GPU memory (VRAM)
+void UnloadRenderTexture(RenderTexture2D target)
+{
+    if (target.id > 0)
+    {
+        if (target.texture.id > 0)
+        {
+            // Color texture attached to FBO is deleted
+            rlUnloadTexture(target.texture.id);
+        }
+
+        // NOTE: Depth texture/renderbuffer is automatically
+        // queried and deleted before deleting framebuffer
+        rlUnloadFramebuffer(target.id);
+    }
+}
+
+// Update GPU texture with new data
+// NOTE 1: pixels data must match texture.format
+// NOTE 2: pixels data must contain at least as many pixels as texture
+void UpdateTexture(Texture2D texture, const void *pixels)
+{
+    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle with new data
+// NOTE 1: pixels data must match texture.format
+// NOTE 2: pixels data must contain as many pixels as rec contains
+// NOTE 3: rec must fit completely within texture's width and height
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+{
+    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
+//------------------------------------------------------------------------------------
+// Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void SetTextureWrap(Texture2D texture, int wrap)
+{
+    switch (wrap)
+    {
+        case TEXTURE_WRAP_REPEAT:
+        {
+            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
+        } break;
+        case TEXTURE_WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+        } break;
+        case TEXTURE_WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+        } break;
+        case TEXTURE_WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a texture
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a texture with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a texture with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+
+        if (dest.width < 0) dest.width *= -1;
+        if (dest.height < 0) dest.height *= -1;
+
+        Vector2 topLeft = { 0 };
+        Vector2 topRight = { 0 };
+        Vector2 bottomLeft = { 0 };
+        Vector2 bottomRight = { 0 };
+
+        // Only calculate rotation if needed
+        if (rotation == 0.0f)
+        {
+            float x = dest.x - origin.x;
+            float y = dest.y - origin.y;
+            topLeft = (Vector2){ x, y };
+            topRight = (Vector2){ x + dest.width, y };
+            bottomLeft = (Vector2){ x, y + dest.height };
+            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+        }
+        else
+        {
+            float sinRotation = sinf(rotation*DEG2RAD);
+            float cosRotation = cosf(rotation*DEG2RAD);
+            float x = dest.x;
+            float y = dest.y;
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            topLeft.x = x + dx*cosRotation - dy*sinRotation;
+            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+
+            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
+            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+
+            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
+            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+
+            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
+            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+        }
+
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            // Top-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            else rlTexCoord2f(source.x/width, source.y/height);
+            rlVertex2f(topLeft.x, topLeft.y);
+
+            // Bottom-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+            // Bottom-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            // Top-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            rlVertex2f(topRight.x, topRight.y);
+
+        rlEnd();
+        rlSetTexture(0);
+
+        // NOTE: Vertex position can be transformed using matrices
+        // but the process is way more costly than calculating
+        // the vertex positions manually, like done above
+        // Old implementation is left here for educational purposes,
+        // in case someone wants to do some performance test
+        /*
+        rlSetTexture(texture.id);
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(0.0f, dest.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(dest.width, dest.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(dest.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+        rlSetTexture(0);
+        */
+    }
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
+        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+
+        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
+        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+
+        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        Vector2 vertA = { 0 };
+        Vector2 vertB = { 0 };
+        Vector2 vertC = { 0 };
+        Vector2 vertD = { 0 };
+        vertA.x = 0.0f;                             // Outer left
+        vertA.y = 0.0f;                             // Outer top
+        vertB.x = leftBorder;                       // Inner left
+        vertB.y = topBorder;                        // Inner top
+        vertC.x = patchWidth  - rightBorder;        // Inner right
+        vertC.y = patchHeight - bottomBorder;       // Inner bottom
+        vertD.x = patchWidth;                       // Outer right
+        vertD.y = patchHeight;                      // Outer bottom
+
+        Vector2 coordA = { 0 };
+        Vector2 coordB = { 0 };
+        Vector2 coordC = { 0 };
+        Vector2 coordD = { 0 };
+        coordA.x = nPatchInfo.source.x/width;
+        coordA.y = nPatchInfo.source.y/height;
+        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
+        coordB.y = (nPatchInfo.source.y + topBorder)/height;
+        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
+        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
+        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
+        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+
+        rlSetTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
+                        // ------------------------------------------------------------
+                        // MIDDLE-LEFT QUAD
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        if (drawCenter)
+                        {
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
 
-        UnloadImageColors(pixels);
+        rlSetTexture(0);
     }
-
-    *colorCount = palCount;
-
-    return palette;
 }
 
-// Unload color data loaded with LoadImageColors()
-void UnloadImageColors(Color *colors)
+// Check if two colors are equal
+bool ColorIsEqual(Color col1, Color col2)
 {
-    RL_FREE(colors);
-}
+    bool result = false;
 
-// Unload colors palette loaded with LoadImagePalette()
-void UnloadImagePalette(Color *colors)
-{
-    RL_FREE(colors);
+    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+
+    return result;
 }
 
-// Get image alpha border rectangle
-// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
-Rectangle GetImageAlphaBorder(Image image, float threshold)
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color Fade(Color color, float alpha)
 {
-    Rectangle crop = { 0 };
-
-    Color *pixels = LoadImageColors(image);
-
-    if (pixels != NULL)
-    {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
-
-        for (int y = 0; y < image.height; y++)
-        {
-            for (int x = 0; x < image.width; x++)
-            {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
-            }
-        }
+    Color result = color;
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
-        {
-            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
-        }
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
 
-        UnloadImageColors(pixels);
-    }
+    result.a = (unsigned char)(255.0f*alpha);
 
-    return crop;
+    return result;
 }
 
-// Get image pixel color at (x, y) position
-Color GetImageColor(Image image, int x, int y)
+// Get hexadecimal value for a Color
+int ColorToInt(Color color)
 {
-    Color color = { 0 };
-
-    if ((x >=0) && (x < image.width) && (y >= 0) && (y < image.height))
-    {
-        switch (image.format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-            {
-                color.r = ((unsigned char *)image.data)[y*image.width + x];
-                color.g = ((unsigned char *)image.data)[y*image.width + x];
-                color.b = ((unsigned char *)image.data)[y*image.width + x];
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*2 + 1];
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                color.b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                color.a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                color.b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                color.g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                color.b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                color.a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*4];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*4 + 1];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*4 + 2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*4 + 3];
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-            {
-                color.r = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3];
-                color.g = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 1];
-                color.b = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 2];
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[y*image.width + x]*255.0f);
-                color.g = 0;
-                color.b = 0;
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*3]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 1]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 2]*255.0f);
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 1]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 2]*255.0f);
-                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 3]*255.0f);
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
-                color.g = 0;
-                color.b = 0;
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 1])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 2])*255.0f);
-                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 3])*255.0f);
+    int result = 0;
 
-            } break;
-            default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
-        }
-    }
-    else TRACELOG(LOG_WARNING, "Requested image pixel (%i, %i) out of bounds", x, y);
+    result = (int)(((unsigned int)color.r << 24) |
+                   ((unsigned int)color.g << 16) |
+                   ((unsigned int)color.b << 8) |
+                    (unsigned int)color.a);
 
-    return color;
+    return result;
 }
 
-//------------------------------------------------------------------------------------
-// Image drawing functions
-//------------------------------------------------------------------------------------
-// Clear image background with given color
-void ImageClearBackground(Image *dst, Color color)
+// Get color normalized as float [0..1]
+Vector4 ColorNormalize(Color color)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
-
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
+    Vector4 result;
 
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
-    int totalPixels = dst->width*dst->height;
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
 
-    // Repeat the first pixel data throughout the image,
-    // doubling the pixels copied on each iteration
-    for (int i = 1; i < totalPixels; i *= 2)
-    {
-        int pixelsToCopy = MIN(i, totalPixels - i);
-        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, pixelsToCopy*bytesPerPixel);
-    }
+    return result;
 }
 
-// Draw pixel within an image
-// NOTE: Compressed image formats not supported
-void ImageDrawPixel(Image *dst, int x, int y, Color color)
+// Get color from normalized values [0..1]
+Color ColorFromNormalized(Vector4 normalized)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
-
-    switch (dst->format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    Color result;
 
-            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    return result;
+}
 
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+// Get HSV values for a Color
+// NOTE: Hue is returned as degrees [0..360]
+Vector3 ColorToHSV(Color color)
+{
+    Vector3 hsv = { 0 };
+    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min = 0.0f;
+    float max = 0.0f;
+    float delta = 0.0f;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    min = (rgb.x < rgb.y)? rgb.x : rgb.y;
+    min = (min < rgb.z)? min : rgb.z;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+    max = (rgb.x > rgb.y)? rgb.x : rgb.y;
+    max = (max > rgb.z)? max : rgb.z;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    hsv.z = max; // Value
+    delta = max - min;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    if (delta < 0.00001f)
+    {
+        hsv.y = 0.0f;
+        hsv.x = 0.0f; // Undefined, maybe NAN?
+        return hsv;
+    }
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max); // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = NAN; // Undefined
+        return hsv;
+    }
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta; // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta; // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta; // Between magenta & cyan
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    hsv.x *= 60.0f; // Convert to degrees
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+    return hsv;
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
+// Get a Color from HSV values
+// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
+// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
+// Hue is provided in degrees: [0..360]
+// Saturation/Value are provided normalized: [0.0f..1.0f]
+Color ColorFromHSV(float hue, float saturation, float value)
+{
+    Color color = { 0, 0, 0, 255 };
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
+    // Red channel
+    float k = fmodf((5.0f + hue/60.0f), 6);
+    float t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    // Green channel
+    k = fmodf((3.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
 
-            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+    // Blue channel
+    k = fmodf((1.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    return color;
+}
 
-            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+// Get color multiplied with another color
+Color ColorTint(Color color, Color tint)
+{
+    Color result = color;
 
-            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
+    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    result.r = r;
+    result.g = g;
+    result.b = b;
+    result.a = a;
 
-            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+    return result;
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
+Color ColorBrightness(Color color, float factor)
+{
+    Color result = color;
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    if (factor > 1.0f) factor = 1.0f;
+    else if (factor < -1.0f) factor = -1.0f;
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
+    float red = (float)color.r;
+    float green = (float)color.g;
+    float blue = (float)color.b;
 
-        } break;
-        default: break;
+    if (factor < 0.0f)
+    {
+        factor = 1.0f + factor;
+        red *= factor;
+        green *= factor;
+        blue *= factor;
+    }
+    else
+    {
+        red = (255 - red)*factor + red;
+        green = (255 - green)*factor + green;
+        blue = (255 - blue)*factor + blue;
     }
-}
 
-// Draw pixel within an image (Vector version)
-void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
-{
-    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
+    result.r = (unsigned char)red;
+    result.g = (unsigned char)green;
+    result.b = (unsigned char)blue;
+
+    return result;
 }
 
-// Draw line within an image
-void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
+// Get color with contrast correction
+// NOTE: Contrast values between -1.0f and 1.0f
+Color ColorContrast(Color color, float contrast)
 {
-    // Calculate differences in coordinates
-    int shortLen = endPosY - startPosY;
-    int longLen = endPosX - startPosX;
-    bool yLonger = false;
+    Color result = color;
 
-    // Determine if the line is more vertical than horizontal
-    if (abs(shortLen) > abs(longLen))
-    {
-        // Swap the lengths if the line is more vertical
-        int temp = shortLen;
-        shortLen = longLen;
-        longLen = temp;
-        yLonger = true;
-    }
+    if (contrast < -1.0f) contrast = -1.0f;
+    else if (contrast > 1.0f) contrast = 1.0f;
 
-    // Initialize variables for drawing loop
-    int endVal = longLen;
-    int sgnInc = 1;
+    contrast = (1.0f + contrast);
+    contrast *= contrast;
 
-    // Adjust direction increment based on longLen sign
-    if (longLen < 0)
-    {
-        longLen = -longLen;
-        sgnInc = -1;
-    }
+    float pR = (float)color.r/255.0f;
+    pR -= 0.5f;
+    pR *= contrast;
+    pR += 0.5f;
+    pR *= 255;
+    if (pR < 0) pR = 0;
+    else if (pR > 255) pR = 255;
+
+    float pG = (float)color.g/255.0f;
+    pG -= 0.5f;
+    pG *= contrast;
+    pG += 0.5f;
+    pG *= 255;
+    if (pG < 0) pG = 0;
+    else if (pG > 255) pG = 255;
 
-    // Calculate fixed-point increment for shorter length
-    int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
+    float pB = (float)color.b/255.0f;
+    pB -= 0.5f;
+    pB *= contrast;
+    pB += 0.5f;
+    pB *= 255;
+    if (pB < 0) pB = 0;
+    else if (pB > 255) pB = 255;
 
-    // Draw the line pixel by pixel
-    if (yLonger)
-    {
-        // If line is more vertical, iterate over y-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
-        }
-    }
-    else
-    {
-        // If line is more horizontal, iterate over x-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
-        }
-    }
+    result.r = (unsigned char)pR;
+    result.g = (unsigned char)pG;
+    result.b = (unsigned char)pB;
+
+    return result;
 }
 
-// Draw line within an image (Vector version)
-void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color ColorAlpha(Color color, float alpha)
 {
-    // Round start and end positions to nearest integer coordinates
-    int x1 = (int)(start.x + 0.5f);
-    int y1 = (int)(start.y + 0.5f);
-    int x2 = (int)(end.x + 0.5f);
-    int y2 = (int)(end.y + 0.5f);
+    Color result = color;
 
-    // Draw a vertical line using ImageDrawLine function
-    ImageDrawLine(dst, x1, y1, x2, y2, color);
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
 }
 
-// Draw a line defining thickness within an image
-void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color color)
+// Get src alpha-blended into dst color with tint
+Color ColorAlphaBlend(Color dst, Color src, Color tint)
 {
-    // Round start and end positions to nearest integer coordinates
-    int x1 = (int)(start.x + 0.5f);
-    int y1 = (int)(start.y + 0.5f);
-    int x2 = (int)(end.x + 0.5f);
-    int y2 = (int)(end.y + 0.5f);
+    Color result = WHITE;
 
-    // Calculate differences in x and y coordinates
-    int dx = x2 - x1;
-    int dy = y2 - y1;
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
 
-    // Determine if the line is more horizontal or vertical
-    if ((dx != 0) && (abs(dy/dx) < 1))
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) result = dst;
+    else if (src.a == 255) result = src;
+    else
     {
-        // Line is more horizontal
-
-        // How many additional lines to draw
-        int wy = thick - 1;
-
-        // Draw the main line and lower half
-        for (int i = 0; i <= ((wy+1)/2); i++)
-        {
-            ImageDrawLine(dst, x1, y1 + i, x2, y2 + i, color);
-        }
+        unsigned int alpha = (unsigned int)src.a + 1; // Shifting by 8 (dividing by 256), so need to take that excess into account
+        result.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
 
-        // Draw the upper half
-        for (int i = 1; i <= (wy/2); i++)
+        if (result.a > 0)
         {
-            ImageDrawLine(dst, x1, y1 - i, x2, y2 - i, color);
+            result.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/result.a) >> 8);
+            result.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/result.a) >> 8);
+            result.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/result.a) >> 8);
         }
     }
-    else if (dy != 0)
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) result = dst;
+    else if (src.a == 255) result = src;
+    else
     {
-        // Line is more vertical or perfectly horizontal
+        Vector4 fdst = ColorNormalize(dst);
+        Vector4 fsrc = ColorNormalize(src);
+        Vector4 ftint = ColorNormalize(tint);
+        Vector4 fout = { 0 };
 
-        // How many additional lines to draw
-        int wx = thick - 1;
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
 
-        //Draw the main line and right half
-        for (int i = 0; i <= ((wx+1)/2); i++)
+        if (fout.w > 0.0f)
         {
-            ImageDrawLine(dst, x1 + i, y1, x2 + i, y2, color);
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
         }
 
-        // Draw the left half
-        for (int i = 1; i <= (wx/2); i++)
-        {
-            ImageDrawLine(dst, x1 - i, y1, x2 - i, y2, color);
-        }
+        result = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
     }
+#endif
+
+    return result;
 }
 
-// Draw circle within an image
-void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color)
+// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
+Color ColorLerp(Color color1, Color color2, float factor)
 {
-    int x = 0;
-    int y = radius;
-    int decesionParameter = 3 - 2*radius;
+    Color color = { 0 };
 
-    while (y >= x)
-    {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
-        x++;
+    if (factor < 0.0f) factor = 0.0f;
+    else if (factor > 1.0f) factor = 1.0f;
 
-        if (decesionParameter > 0)
-        {
-            y--;
-            decesionParameter = decesionParameter + 4*(x - y) + 10;
-        }
-        else decesionParameter = decesionParameter + 4*x + 6;
-    }
-}
+    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
+    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
+    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
+    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
 
-// Draw circle within an image (Vector version)
-void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color)
-{
-    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
+    return color;
 }
 
-// Draw circle outline within an image
-void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
+// Get a Color struct from hexadecimal value
+Color GetColor(unsigned int hexValue)
 {
-    int x = 0;
-    int y = radius;
-    int decesionParameter = 3 - 2*radius;
-
-    while (y >= x)
-    {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
-        x++;
+    Color color;
 
-        if (decesionParameter > 0)
-        {
-            y--;
-            decesionParameter = decesionParameter + 4*(x - y) + 10;
-        }
-        else decesionParameter = decesionParameter + 4*x + 6;
-    }
-}
+    color.r = (unsigned char)(hexValue >> 24) & 0xff;
+    color.g = (unsigned char)(hexValue >> 16) & 0xff;
+    color.b = (unsigned char)(hexValue >> 8) & 0xff;
+    color.a = (unsigned char)hexValue & 0xff;
 
-// Draw circle outline within an image (Vector version)
-void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color)
-{
-    ImageDrawCircleLines(dst, (int)center.x, (int)center.y, radius, color);
+    return color;
 }
 
-// Draw rectangle within an image
-void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
+// Get color from a pixel from certain format
+Color GetPixelColor(void *srcPtr, int format)
 {
-    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
-}
+    Color color = { 0 };
 
-// Draw rectangle within an image (Vector version)
-void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
-{
-    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
-}
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = 255;
 
-// Draw rectangle within an image
-void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
-{
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
 
-    // Security check to avoid drawing out of bounds in case of bad user data
-    if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
-    if (rec.y < 0) { rec.height += rec.y; rec.y = 0; }
-    if (rec.width < 0) rec.width = 0;
-    if (rec.height < 0) rec.height = 0;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
+            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
 
-    // Clamp the size the the image bounds
-    if ((rec.x + rec.width) >= dst->width) rec.width = dst->width - rec.x;
-    if ((rec.y + rec.height) >= dst->height) rec.height = dst->height - rec.y;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.a = 255;
 
-    // Check if the rect is even inside the image
-    if ((rec.x >= dst->width) || (rec.y >= dst->height)) return;
-    if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = 255;
 
-    int sy = (int)rec.y;
-    int sx = (int)rec.x;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.a = 255;
 
-    // Fill in the first pixel of the first row based on image format
-    ImageDrawPixel(dst, sx, sy, color);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = 255;
 
-    int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
-    unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
 
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x *= 2)
-    {
-        int pixelsToCopy = MIN(x, (int)rec.width - x);
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, pixelsToCopy*bytesPerPixel);
+        } break;
+        default: break;
     }
 
-    // Repeat the first row data for all other rows
-    int bytesPerRow = bytesPerPixel*(int)rec.width;
-    for (int y = 1; y < (int)rec.height; y++)
-    {
-        memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
-    }
+    return color;
 }
 
-// Draw rectangle lines within an image
-void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
+// Set pixel color formatted into destination pointer
+void SetPixelColor(void *dstPtr, Color color, int format)
 {
-    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
-}
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
 
-// Draw triangle within an image
-void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
-{
-    // Calculate the 2D bounding box of the triangle
-    // Determine the minimum and maximum x and y coordinates of the triangle vertices
-    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
-    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
-    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
-    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
+            ((unsigned char *)dstPtr)[0] = gray;
 
-    // Clamp the bounding box to the image dimensions
-    if (xMin < 0) xMin = 0;
-    if (yMin < 0) yMin = 0;
-    if (xMax > dst->width) xMax = dst->width;
-    if (yMax > dst->height) yMax = dst->height;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
 
-    // Check the order of the vertices to determine if it's a front or back face
-    // NOTE: if signedArea is equal to 0, the face is degenerate
-    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
-    bool isBackFace = (signedArea > 0);
+            ((unsigned char *)dstPtr)[0] = gray;
+            ((unsigned char *)dstPtr)[1] = color.a;
 
-    // Barycentric interpolation setup
-    // Calculate the step increments for the barycentric coordinates
-    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
-    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
-    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-    // If the triangle is a back face, invert the steps
-    if (isBackFace)
-    {
-        w1XStep = -w1XStep, w1YStep = -w1YStep;
-        w2XStep = -w2XStep, w2YStep = -w2YStep;
-        w3XStep = -w3XStep, w3YStep = -w3YStep;
-    }
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
 
-    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
-    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
-    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
-    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
 
-    // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
-    {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-        for (int x = xMin; x <= xMax; x++)
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
         {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            // If it is, the pixel can be drawn with the given color
-            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
 
-        // Move to the next row in the bounding box
-        w1Row += w1YStep;
-        w2Row += w2YStep;
-        w3Row += w3YStep;
-    }
-}
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
 
-// Draw triangle with interpolated colors within an image
-void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3)
-{
-    // Calculate the 2D bounding box of the triangle
-    // Determine the minimum and maximum x and y coordinates of the triangle vertices
-    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
-    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
-    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
-    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
 
-    // Clamp the bounding box to the image dimensions
-    if (xMin < 0) xMin = 0;
-    if (yMin < 0) yMin = 0;
-    if (xMax > dst->width) xMax = dst->width;
-    if (yMax > dst->height) yMax = dst->height;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+            ((unsigned char *)dstPtr)[3] = color.a;
 
-    // Check the order of the vertices to determine if it's a front or back face
-    // NOTE: if signedArea is equal to 0, the face is degenerate
-    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
-    bool isBackFace = (signedArea > 0);
+        } break;
+        default: break;
+    }
+}
 
-    // Barycentric interpolation setup
-    // Calculate the step increments for the barycentric coordinates
-    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
-    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
-    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
+// Get pixel data size in bytes for certain format
+// NOTE: Size can be requested for Image or Texture data
+int GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
 
-    // If the triangle is a back face, invert the steps
-    if (isBackFace)
+    switch (format)
     {
-        w1XStep = -w1XStep, w1YStep = -w1YStep;
-        w2XStep = -w2XStep, w2YStep = -w2YStep;
-        w3XStep = -w3XStep, w3YStep = -w3YStep;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
     }
 
-    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
-    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
-    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
-    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
-
-    // Calculate the inverse of the sum of the barycentric coordinates for normalization
-    float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
+    double bytesPerPixel = (double)bpp/8.0;
+    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
 
-    // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
+    // Most compressed formats works on 4x4 blocks,
+    // if texture is smaller, minimum dataSize is 8 or 16
+    if ((width < 4) && (height < 4))
     {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
+        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+    }
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            if ((w1 | w2 | w3) >= 0)
-            {
-                // Compute the normalized barycentric coordinates
-                unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
-                unsigned char aW2 = (unsigned char)((float)w2*wInvSum);
-                unsigned char aW3 = (unsigned char)((float)w3*wInvSum);
+    return dataSize;
+}
 
-                // Interpolate the color using the barycentric coordinates
-                Color finalColor = { 0 };
-                finalColor.r = (c1.r*aW1 + c2.r*aW2 + c3.r*aW3)/255;
-                finalColor.g = (c1.g*aW1 + c2.g*aW2 + c3.g*aW3)/255;
-                finalColor.b = (c1.b*aW1 + c2.b*aW2 + c3.b*aW3)/255;
-                finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Convert half-float (stored as unsigned short) to float
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+static float HalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
 
-                // Draw the pixel with the interpolated color
-                ImageDrawPixel(dst, x, y, finalColor);
-            }
+    union {
+        float fm;
+        unsigned int ui;
+    } uni;
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+    const unsigned int e = (x & 0x7c00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03ff) << 13; // Mantissa
+    uni.fm = (float)m;
+    const unsigned int v = uni.ui >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    uni.ui = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007fe000)); // sign : normalized : denormalized
 
-        // Move to the next row in the bounding box
-        w1Row += w1YStep;
-        w2Row += w2YStep;
-        w3Row += w3YStep;
-    }
-}
+    result = uni.fm;
 
-// Draw triangle outline within an image
-void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
-{
-    ImageDrawLine(dst, (int)v1.x, (int)v1.y, (int)v2.x, (int)v2.y, color);
-    ImageDrawLine(dst, (int)v2.x, (int)v2.y, (int)v3.x, (int)v3.y, color);
-    ImageDrawLine(dst, (int)v3.x, (int)v3.y, (int)v1.x, (int)v1.y, color);
+    return result;
 }
 
-// Draw a triangle fan defined by points within an image (first vertex is the center)
-void ImageDrawTriangleFan(Image *dst, const Vector2 *points, int pointCount, Color color)
+// Convert float to half-float (stored as unsigned short)
+static unsigned short FloatToHalf(float x)
 {
-    if (pointCount >= 3)
-    {
-        for (int i = 1; i < pointCount - 1; i++)
-        {
-            ImageDrawTriangle(dst, points[0], points[i], points[i + 1], color);
-        }
-    }
-}
+    unsigned short result = 0;
 
-// Draw a triangle strip defined by points within an image
-void ImageDrawTriangleStrip(Image *dst, const Vector2 *points, int pointCount, Color color)
-{
-    if (pointCount >= 3)
-    {
-        for (int i = 2; i < pointCount; i++)
-        {
-            if ((i%2) == 0) ImageDrawTriangle(dst, points[i], points[i - 2], points[i - 1], color);
-            else ImageDrawTriangle(dst, points[i], points[i - 1], points[i - 2], color);
-        }
-    }
+    union {
+        float fm;
+        unsigned int ui;
+    } uni;
+    uni.fm = x;
+
+    const unsigned int b = uni.ui + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7f800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007fffff; // Mantissa; in line below: 0x007ff000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7c00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007ff000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7fff; // sign : normalized : denormalized : saturate
+
+    return result;
 }
 
-// Draw an image (source) within an image (destination)
-// NOTE: Color tint is applied to source image
-void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+// Get pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
-        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
 
-    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
     else
     {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
-
-        // Source rectangle out-of-bounds security checks
-        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
-        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
-        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
-        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
-
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, make a copy of source, and apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
         {
-            srcMod = ImageFromImage(src, srcRec); // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height); // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
 
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
 
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
-        {
-            srcRec.x -= dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
-        }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        if (dstRec.y < 0)
-        {
-            srcRec.y -= dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
 
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] TODO: Support 16bit and 32bit (float) channels drawing
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
 
-        Color colSrc = { 0 };
-        Color colDst = { 0 };
-        Color blend = { 0 };
-        bool blendRequired = true;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) &&
-            ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)))
-            blendRequired = false;
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
-        {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
                 {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
 
-                    SetPixelColor(pDst, blend, dst->format);
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = 1.0f;
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
+                    k += 4;
+                } break;
+                default: break;
+            }
         }
+    }
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
-
-        if ((dst->mipmaps > 1) && (src.mipmaps > 1))
-        {
-            Image mipmapDst = *dst;
-            mipmapDst.data = (char *)mipmapDst.data + GetPixelDataSize(mipmapDst.width, mipmapDst.height, mipmapDst.format);
-            mipmapDst.width /= 2;
-            mipmapDst.height /= 2;
-            mipmapDst.mipmaps--;
+    return pixels;
+}
 
-            Image mipmapSrc = src;
-            mipmapSrc.data = (char *)mipmapSrc.data + GetPixelDataSize(mipmapSrc.width, mipmapSrc.height, mipmapSrc.format);
-            mipmapSrc.width /= 2;
-            mipmapSrc.height /= 2;
-            mipmapSrc.mipmaps--;
 
-            Rectangle mipmapSrcRec = srcRec;
-            mipmapSrcRec.width /= 2;
-            mipmapSrcRec.height /= 2;
-            mipmapSrcRec.x /= 2;
-            mipmapSrcRec.y /= 2;
+// Read data from image stream file (buffered)
+static int ImageStreamReadData(ImageStreamContext *ctx, unsigned char *data, int size)
+{
+    int readSize = 0;
 
-            Rectangle mipmapDstRec = dstRec;
-            mipmapDstRec.width /= 2;
-            mipmapDstRec.height /= 2;
-            mipmapDstRec.x /= 2;
-            mipmapDstRec.y /= 2;
+    while (readSize < size)
+    {
+        if (ctx->bufferPos >= ctx->bufferSize)
+        {
+            ctx->bufferOffset += ctx->bufferSize;
+            ctx->bufferSize = (int)fread(ctx->buffer, 1, IMAGE_STREAM_BUFFER_SIZE, ctx->file);
+            ctx->bufferPos = 0;
 
-            ImageDraw(&mipmapDst, mipmapSrc, mipmapSrcRec, mipmapDstRec, tint);
+            if (ctx->bufferSize <= 0)
+            {
+                ctx->bufferSize = 0;
+                break;
+            }
         }
+
+        int count = ctx->bufferSize - ctx->bufferPos;
+        if (count > (size - readSize)) count = size - readSize;
+
+        memcpy(data + readSize, ctx->buffer + ctx->bufferPos, count);
+        ctx->bufferPos += count;
+        readSize += count;
     }
+
+    return readSize;
 }
 
-// Draw text (default font) within an image (destination)
-void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
+// Read one byte from image stream file (buffered), -1 on end of file
+static int ImageStreamReadByte(ImageStreamContext *ctx)
 {
-#if SUPPORT_MODULE_RTEXT
-    // Make sure default font is loaded to be used on image text drawing
-    if (GetFontDefault().texture.id == 0) LoadFontDefault();
+    if (ctx->bufferPos < ctx->bufferSize) return ctx->buffer[ctx->bufferPos++];
 
-    Vector2 position = { (float)posX, (float)posY };
-    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, 1.0f, color);   // WARNING: Module required: rtext
-#else
-    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
-#endif
+    unsigned char value = 0;
+    return (ImageStreamReadData(ctx, &value, 1) == 1)? value : -1;
 }
 
-// Draw text (custom sprite font) within an image (destination)
-void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+// Set image stream file read position
+static void ImageStreamSeek(ImageStreamContext *ctx, long offset)
 {
-    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
-
-    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
-    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+    fseek(ctx->file, offset, SEEK_SET);
 
-    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
-
-    UnloadImage(imText);
+    ctx->bufferOffset = offset;
+    ctx->bufferSize = 0;
+    ctx->bufferPos = 0;
 }
 
-//------------------------------------------------------------------------------------
-// Texture loading functions
-//------------------------------------------------------------------------------------
-// Load texture from file into GPU memory (VRAM)
-Texture2D LoadTexture(const char *fileName)
+// Read image stream rows into provided buffer
+static bool ReadImageStreamRows(ImageStreamContext *ctx, int type, int startRow, int rowCount, unsigned char *data)
 {
-    Texture2D texture = { 0 };
-
-    Image image = LoadImage(fileName);
+    bool result = false;
 
-    if (image.data != NULL)
+    switch (type)
     {
-        texture = LoadTextureFromImage(image);
-        UnloadImage(image);
-    }
+        case IMAGE_STREAM_RAW:
+        {
+            if (fseek(ctx->file, ctx->dataOffset + (long)startRow*ctx->rowSize, SEEK_SET) == 0)
+            {
+                result = (fread(data, ctx->rowSize, rowCount, ctx->file) == (size_t)rowCount);
+            }
+        } break;
+        case IMAGE_STREAM_MEMORY:
+        {
+            memcpy(data, (unsigned char *)ctx->image.data + startRow*ctx->rowSize, rowCount*ctx->rowSize);
+            result = true;
+        } break;
+#if SUPPORT_FILEFORMAT_PNG
+        case IMAGE_STREAM_PNG:
+        {
+            result = true;
 
-    return texture;
-}
+            // Decoding is sequential, restart it if required rows were already decoded
+            if (startRow < ctx->nextRow) result = RewindImageStreamPNG(ctx);
 
-// Load a texture from image data
-// NOTE: image is not unloaded, it must be done manually
-Texture2D LoadTextureFromImage(Image image)
-{
-    Texture2D texture = { 0 };
+            // Skip rows up to the first one required, using first output row as scratch buffer
+            while (result && (ctx->nextRow < startRow)) result = ReadImageStreamRowPNG(ctx, data);
 
-    if ((image.width != 0) && (image.height != 0))
-    {
-        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
-    }
-    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+            for (int i = 0; (i < rowCount) && result; i++) result = ReadImageStreamRowPNG(ctx, data + i*ctx->rowSize);
+        } break;
+#endif
+#if SUPPORT_FILEFORMAT_QOI
+        case IMAGE_STREAM_QOI:
+        {
+            result = true;
 
-    texture.width = image.width;
-    texture.height = image.height;
-    texture.mipmaps = image.mipmaps;
-    texture.format = image.format;
+            if (startRow < ctx->nextRow) RewindImageStreamQOI(ctx);
 
-    return texture;
+            while (result && (ctx->nextRow < startRow)) result = ReadImageStreamRowQOI(ctx, data);
+
+            for (int i = 0; (i < rowCount) && result; i++) result = ReadImageStreamRowQOI(ctx, data + i*ctx->rowSize);
+        } break;
+#endif
+        default: break;
+    }
+
+    return result;
 }
 
-// Load cubemap from image, multiple image cubemap layouts supported
-TextureCubemap LoadTextureCubemap(Image image, int layout)
+// Read image stream rows as 8 bit per channel pixels (1 to 4 channels)
+// NOTE: Image formats with 8 bit per channel are read directly, any other format is converted to RGBA,
+// rowData must be able to hold one source row
+static bool ReadImageStreamRowsColor(ImageStreamContext *ctx, int type, int startRow, int rowCount, unsigned char *data, unsigned char *rowData, int channels)
 {
-    TextureCubemap cubemap = { 0 };
+    bool result = true;
 
-    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
+    if ((ctx->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+        (ctx->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+        (ctx->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+        (ctx->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
     {
-        // Check image width/height to determine the type of cubemap provided
-        if (image.width > image.height)
-        {
-            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
-            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
-        }
-        else if (image.height > image.width)
-        {
-            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
-            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
-        }
+        result = ReadImageStreamRows(ctx, type, startRow, rowCount, data);
     }
     else
     {
-        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL) cubemap.width = image.height/6;
-        if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.width/6;
-        if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
-        if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE) cubemap.width = image.width/4;
-    }
-
-    cubemap.height = cubemap.width;
-
-    // Layout provided or already auto-detected
-    if (layout != CUBEMAP_LAYOUT_AUTO_DETECT)
-    {
-        int size = cubemap.width;
-
-        Image faces = { 0 };                // Vertical column image
-        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
-
-        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, (float)size, (float)size };
+        int bytesPerPixel = GetPixelDataSize(1, 1, ctx->format);
 
-        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
-        {
-            faces = ImageCopy(image);       // Image data already follows expected convention
-        }
-        /*else if (layout == CUBEMAP_LAYOUT_PANORAMA)
-        {
-            // TODO: Implement panorama by converting image to square faces...
-            // REF: https://github.com/denivip/panorama/blob/master/panorama.cpp
-        } */
-        else
+        for (int i = 0; (i < rowCount) && result; i++)
         {
-            if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
-            else if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR)
-            {
-                faceRecs[0].x = (float)size; faceRecs[0].y = (float)size;
-                faceRecs[1].x = (float)size; faceRecs[1].y = (float)size*3;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = 0; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*2; faceRecs[5].y = (float)size;
-            }
-            else if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE)
-            {
-                faceRecs[0].x = (float)size*2; faceRecs[0].y = (float)size;
-                faceRecs[1].x = 0; faceRecs[1].y = (float)size;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = (float)size; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*3; faceRecs[5].y = (float)size;
-            }
-
-            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
-            // NOTE: Image formatting does not work with compressed textures
-            faces = GenImageColor(size, size*6, MAGENTA);
-            ImageFormat(&faces, image.format);
+            result = ReadImageStreamRows(ctx, type, startRow + i, 1, rowData);
 
-            Image mipmapped = ImageCopy(image);
-            if (image.mipmaps > 1)
+            for (int x = 0; (x < ctx->width) && result; x++)
             {
-                ImageMipmaps(&mipmapped);
-                ImageMipmaps(&faces);
+                Color color = GetPixelColor(rowData + x*bytesPerPixel, ctx->format);
+                memcpy(data + (i*ctx->width + x)*channels, &color, channels);
             }
-
-            for (int i = 0; i < 6; i++) ImageDraw(&faces, mipmapped, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
-
-            UnloadImage(mipmapped);
-        }
-
-        // NOTE: Cubemap data is expected to be provided as 6 images in a single data array,
-        // one after the other (that's a vertical image), following convention: +X, -X, +Y, -Y, +Z, -Z
-        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format, faces.mipmaps);
-
-        if (cubemap.id != 0)
-        {
-            cubemap.format = faces.format;
-            cubemap.mipmaps = faces.mipmaps;
-        }
-        else TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
-
-        UnloadImage(faces);
+        }
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
 
-    return cubemap;
+    return result;
 }
 
-// Load texture for rendering (framebuffer)
-// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
-RenderTexture2D LoadRenderTexture(int width, int height)
+#if SUPPORT_FILEFORMAT_PNG
+// Read PNG header and chunks up to image data
+// NOTE: Interlaced images are not supported for streaming
+static bool OpenImageStreamPNG(ImageStreamContext *ctx)
 {
-    RenderTexture2D target = { 0 };
+    static const unsigned char signature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+    unsigned char header[13] = { 0 };
+    bool headerFound = false;
+    bool dataFound = false;
 
-    target.id = rlLoadFramebuffer(); // Load an empty framebuffer
+    ImageStreamSeek(ctx, 0);
+    if ((ImageStreamReadData(ctx, header, 8) != 8) || (memcmp(header, signature, 8) != 0)) return false;
 
-    if (target.id > 0)
+    for (int i = 0; i < 256*4; i++) ctx->palette[i] = ((i%4) == 3)? 255 : 0;
+
+    while (!dataFound)
     {
-        rlEnableFramebuffer(target.id);
+        long chunkOffset = ctx->bufferOffset + ctx->bufferPos;
+        unsigned char chunk[8] = { 0 };
 
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-        target.texture.mipmaps = 1;
+        if (ImageStreamReadData(ctx, chunk, 8) != 8) break;
 
-        // Create depth renderbuffer/texture
-        target.depth.id = rlLoadTextureDepth(width, height, true);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
+        unsigned int length = ((unsigned int)chunk[0] << 24) | ((unsigned int)chunk[1] << 16) | ((unsigned int)chunk[2] << 8) | chunk[3];
 
-        // Attach color texture and depth renderbuffer/texture to FBO
-        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
-        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+        if (memcmp(chunk + 4, "IHDR", 4) == 0)
+        {
+            if ((length != 13) || (ImageStreamReadData(ctx, header, 13) != 13)) break;
 
-        // Check if fbo is complete with attachments (valid)
-        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+            ctx->width = (header[0] << 24) | (header[1] << 16) | (header[2] << 8) | header[3];
+            ctx->height = (header[4] << 24) | (header[5] << 16) | (header[6] << 8) | header[7];
+            ctx->bitDepth = header[8];
+            ctx->colorType = header[9];
+            headerFound = true;
 
-        rlDisableFramebuffer();
-    }
-    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+            // Only non-interlaced images can be decoded row-by-row
+            if ((header[10] != 0) || (header[11] != 0) || (header[12] != 0)) break;
+            if ((ctx->width <= 0) || (ctx->height <= 0)) break;
 
-    return target;
-}
+            switch (ctx->colorType)
+            {
+                case 0: ctx->channels = 1; break;
+                case 2: ctx->channels = 3; break;
+                case 3: ctx->channels = 1; break;
+                case 4: ctx->channels = 2; break;
+                case 6: ctx->channels = 4; break;
+                default: ctx->channels = 0; break;
+            }
 
-// Check if a texture is valid (loaded in GPU)
-bool IsTextureValid(Texture2D texture)
-{
-    bool result = false;
+            if (ctx->channels == 0) break;
+            if ((ctx->bitDepth != 1) && (ctx->bitDepth != 2) && (ctx->bitDepth != 4) && (ctx->bitDepth != 8) && (ctx->bitDepth != 16)) break;
+            if ((ctx->bitDepth < 8) && (ctx->colorType != 0) && (ctx->colorType != 3)) break;
+            if ((ctx->bitDepth == 16) && (ctx->colorType == 3)) break;
 
-    if ((texture.id > 0) &&         // Validate OpenGL id (texture uplaoded to GPU)
-        (texture.width > 0) &&      // Validate texture width
-        (texture.height > 0) &&     // Validate texture height
-        (texture.format > 0) &&     // Validate texture pixel format
-        (texture.mipmaps > 0)) result = true; // Validate texture mipmaps (at least 1 for basic mipmap level)
+            ImageStreamSeek(ctx, chunkOffset + 12 + length);    // Skip chunk CRC
+        }
+        else if (memcmp(chunk + 4, "PLTE", 4) == 0)
+        {
+            unsigned char palette[256*3] = { 0 };
+            if ((length > 256*3) || (ImageStreamReadData(ctx, palette, length) != (int)length)) break;
 
-    return result;
-}
+            for (unsigned int i = 0; i < length/3; i++) memcpy(ctx->palette + i*4, palette + i*3, 3);
 
-// Unload texture from GPU memory (VRAM)
-void UnloadTexture(Texture2D texture)
-{
-    if (texture.id > 0)
-    {
-        rlUnloadTexture(texture.id);
+            ImageStreamSeek(ctx, chunkOffset + 12 + length);
+        }
+        else if (memcmp(chunk + 4, "tRNS", 4) == 0)
+        {
+            unsigned char trans[256] = { 0 };
+            if ((length > 256) || (ImageStreamReadData(ctx, trans, length) != (int)length)) break;
 
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+            if (ctx->colorType == 3)
+            {
+                for (unsigned int i = 0; i < length; i++) ctx->palette[i*4 + 3] = trans[i];
+                ctx->transparency = true;
+            }
+            else if ((ctx->colorType == 0) && (length == 2))
+            {
+                ctx->transKey[0] = (trans[0] << 8) | trans[1];
+                ctx->transparency = true;
+            }
+            else if ((ctx->colorType == 2) && (length == 6))
+            {
+                for (int i = 0; i < 3; i++) ctx->transKey[i] = (trans[i*2] << 8) | trans[i*2 + 1];
+                ctx->transparency = true;
+            }
+
+            ImageStreamSeek(ctx, chunkOffset + 12 + length);
+        }
+        else if (memcmp(chunk + 4, "IDAT", 4) == 0)
+        {
+            ctx->dataOffset = chunkOffset;
+            dataFound = true;
+        }
+        else if (memcmp(chunk + 4, "IEND", 4) == 0) break;
+        else ImageStreamSeek(ctx, chunkOffset + 12 + length);    // Skip ancillary chunk
     }
-}
 
-// Check if a render texture is valid (loaded in GPU)
-bool IsRenderTextureValid(RenderTexture2D target)
-{
-    bool result = false;
+    if (!headerFound || !dataFound || (ctx->channels == 0)) return false;
 
-    if ((target.id > 0) &&                  // Validate OpenGL id (loaded on GPU)
-        IsTextureValid(target.depth) &&     // Validate FBO depth texture/renderbuffer attachment
-        IsTextureValid(target.texture)) result = true; // Validate FBO texture attachment
+    // Output format matches image channels, transparency adds an alpha channel
+    switch (ctx->colorType)
+    {
+        case 0: ctx->format = ctx->transparency? PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
+        case 2: ctx->format = ctx->transparency? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
+        case 3: ctx->format = ctx->transparency? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
+        case 4: ctx->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
+        case 6: ctx->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
+        default: break;
+    }
 
-    return result;
+    ctx->filterStride = (ctx->channels*ctx->bitDepth)/8;
+    if (ctx->filterStride < 1) ctx->filterStride = 1;
+
+    // Filtered and output rows sizes must fit in int, output rows use up to 4 bytes per pixel
+    long long rawRowSize = ((long long)ctx->width*ctx->channels*ctx->bitDepth + 7)/8;
+    if ((rawRowSize > INT_MAX) || (ctx->width > INT_MAX/4)) return false;
+
+    ctx->rawRowSize = (int)rawRowSize;
+    ctx->rowPrevious = (unsigned char *)RL_MALLOC(ctx->rawRowSize);
+    ctx->rowCurrent = (unsigned char *)RL_MALLOC(ctx->rawRowSize);
+    ctx->inflate = (InflateState *)RL_MALLOC(sizeof(InflateState));
+
+    if ((ctx->rowPrevious == NULL) || (ctx->rowCurrent == NULL) || (ctx->inflate == NULL)) return false;
+
+    return RewindImageStreamPNG(ctx);
 }
 
-// Unload render texture from GPU memory (VRAM)
-void UnloadRenderTexture(RenderTexture2D target)
+// Read next byte of PNG image data, going through IDAT chunks, -1 if no more data
+static int ReadPngDataByte(ImageStreamContext *ctx)
 {
-    if (target.id > 0)
+    while (ctx->chunkRemaining == 0)
     {
-        if (target.texture.id > 0)
-        {
-            // Color texture attached to FBO is deleted
-            rlUnloadTexture(target.texture.id);
-        }
+        unsigned char chunk[8] = { 0 };
 
-        // NOTE: Depth texture/renderbuffer is automatically
-        // queried and deleted before deleting framebuffer
-        rlUnloadFramebuffer(target.id);
+        if (ctx->chunksEnded) return -1;
+        if (ctx->chunkCrcPending && (ImageStreamReadData(ctx, chunk, 4) != 4)) { ctx->chunksEnded = true; return -1; }
+        if ((ImageStreamReadData(ctx, chunk, 8) != 8) || (memcmp(chunk + 4, "IDAT", 4) != 0)) { ctx->chunksEnded = true; return -1; }
+
+        ctx->chunkRemaining = ((unsigned int)chunk[0] << 24) | ((unsigned int)chunk[1] << 16) | ((unsigned int)chunk[2] << 8) | chunk[3];
+        ctx->chunkCrcPending = true;
     }
-}
 
-// Update GPU texture with new data
-// NOTE 1: pixels data must match texture.format
-// NOTE 2: pixels data must contain at least as many pixels as texture
-void UpdateTexture(Texture2D texture, const void *pixels)
-{
-    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+    ctx->chunkRemaining--;
+    return ImageStreamReadByte(ctx);
 }
 
-// Update GPU texture rectangle with new data
-// NOTE 1: pixels data must match texture.format
-// NOTE 2: pixels data must contain as many pixels as rec contains
-// NOTE 3: rec must fit completely within texture's width and height
-void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+// Restart PNG image data decoding
+static bool RewindImageStreamPNG(ImageStreamContext *ctx)
 {
-    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+    InflateState *inflate = ctx->inflate;
+
+    ImageStreamSeek(ctx, ctx->dataOffset);
+    ctx->chunkRemaining = 0;
+    ctx->chunkCrcPending = false;
+    ctx->chunksEnded = false;
+    ctx->nextRow = 0;
+    memset(ctx->rowPrevious, 0, ctx->rawRowSize);
+
+    inflate->bits = 0;
+    inflate->bitCount = 0;
+    inflate->blockType = -1;
+    inflate->lastBlock = false;
+    inflate->finished = false;
+    inflate->storedLength = 0;
+    inflate->matchLength = 0;
+    inflate->matchDistance = 0;
+    inflate->windowPos = 0;
+    memset(inflate->window, 0, sizeof(inflate->window));
+
+    // Check zlib stream header: DEFLATE method, no preset dictionary
+    int cmf = ReadPngDataByte(ctx);
+    int flg = ReadPngDataByte(ctx);
+
+    if ((cmf < 0) || (flg < 0) || ((cmf & 0x0f) != 8) || ((flg & 0x20) != 0) || ((((cmf << 8) | flg)%31) != 0))
+    {
+        inflate->finished = true;
+        return false;
+    }
+
+    return true;
 }
 
-//------------------------------------------------------------------------------------
-// Texture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
+// Get PNG Paeth filter predictor
+static int GetPaethPredictor(int a, int b, int c)
 {
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+
+    if ((pa <= pb) && (pa <= pc)) return a;
+    else if (pb <= pc) return b;
+    else return c;
 }
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filter)
+// Decode next PNG row into output pixel format
+static bool ReadImageStreamRowPNG(ImageStreamContext *ctx, unsigned char *row)
 {
+    unsigned char filter = 0;
+
+    if (InflateRead(ctx, &filter, 1) != 1) return false;
+    if (InflateRead(ctx, ctx->rowCurrent, ctx->rawRowSize) != ctx->rawRowSize) return false;
+
+    // Reconstruct filtered row bytes
+    unsigned char *cur = ctx->rowCurrent;
+    const unsigned char *prev = ctx->rowPrevious;
+    int stride = ctx->filterStride;
+    int size = ctx->rawRowSize;
+
     switch (filter)
     {
-        case TEXTURE_FILTER_POINT:
+        case 0: break;
+        case 1: for (int i = stride; i < size; i++) cur[i] += cur[i - stride]; break;
+        case 2: for (int i = 0; i < size; i++) cur[i] += prev[i]; break;
+        case 3:
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
-
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
+            for (int i = 0; i < stride; i++) cur[i] += prev[i] >> 1;
+            for (int i = stride; i < size; i++) cur[i] += (unsigned char)((cur[i - stride] + prev[i]) >> 1);
         } break;
-        case TEXTURE_FILTER_BILINEAR:
+        case 4:
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
-
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
+            for (int i = 0; i < stride; i++) cur[i] += prev[i];
+            for (int i = stride; i < size; i++) cur[i] += (unsigned char)GetPaethPredictor(cur[i - stride], prev[i], prev[i - stride]);
         } break;
-        case TEXTURE_FILTER_TRILINEAR:
+        default: return false;
+    }
+
+    // Convert row samples to output format
+    if ((ctx->bitDepth == 8) && (ctx->colorType != 3) && !ctx->transparency) memcpy(row, cur, size);
+    else
+    {
+        static const unsigned char depthScale[9] = { 0, 0xff, 0x55, 0, 0x11, 0, 0, 0, 0x01 };
+        int outChannels = GetPixelDataSize(1, 1, ctx->format);
+
+        for (int x = 0; x < ctx->width; x++)
         {
-            if (texture.mipmaps > 1)
+            unsigned short sample[4] = { 0 };
+            unsigned char *out = row + x*outChannels;
+
+            for (int c = 0; c < ctx->channels; c++)
             {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+                int i = x*ctx->channels + c;
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                if (ctx->bitDepth == 8) sample[c] = cur[i];
+                else if (ctx->bitDepth == 16) sample[c] = (cur[i*2] << 8) | cur[i*2 + 1];
+                else sample[c] = (cur[(i*ctx->bitDepth) >> 3] >> (8 - ctx->bitDepth - ((i*ctx->bitDepth) & 7))) & ((1 << ctx->bitDepth) - 1);
             }
+
+            if (ctx->colorType == 3) memcpy(out, ctx->palette + sample[0]*4, outChannels);
             else
             {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+                for (int c = 0; c < ctx->channels; c++)
+                {
+                    if (ctx->bitDepth == 16) out[c] = (unsigned char)(sample[c] >> 8);
+                    else out[c] = (unsigned char)(sample[c]*depthScale[ctx->bitDepth]);
+                }
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                if (ctx->transparency)
+                {
+                    bool transparent = (sample[0] == ctx->transKey[0]);
+                    if (ctx->colorType == 2) transparent = transparent && (sample[1] == ctx->transKey[1]) && (sample[2] == ctx->transKey[2]);
+
+                    out[ctx->channels] = transparent? 0 : 255;
+                }
             }
-        } break;
-        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
+        }
     }
+
+    ctx->rowCurrent = ctx->rowPrevious;
+    ctx->rowPrevious = cur;
+    ctx->nextRow++;
+
+    return true;
 }
 
-// Set texture wrapping mode
-void SetTextureWrap(Texture2D texture, int wrap)
+// Get bits from DEFLATE stream
+static unsigned int InflateGetBits(ImageStreamContext *ctx, int count)
 {
-    switch (wrap)
+    InflateState *inflate = ctx->inflate;
+
+    while (inflate->bitCount < count)
     {
-        case TEXTURE_WRAP_REPEAT:
-        {
-            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
-        } break;
-        case TEXTURE_WRAP_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
-        } break;
-        case TEXTURE_WRAP_MIRROR_REPEAT:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-        } break;
-        case TEXTURE_WRAP_MIRROR_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
+        int value = ReadPngDataByte(ctx);
+        if (value < 0) value = 0;   // Reading out of data, invalid streams get finished on decoding
+
+        inflate->bits |= (unsigned long long)value << inflate->bitCount;
+        inflate->bitCount += 8;
     }
+
+    unsigned int result = (unsigned int)(inflate->bits & ((1ull << count) - 1));
+    inflate->bits >>= count;
+    inflate->bitCount -= count;
+
+    return result;
 }
 
-//------------------------------------------------------------------------------------
-// Texture drawing functions
-//------------------------------------------------------------------------------------
-// Draw a texture
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+// Build Huffman decoding table from code lengths
+static bool InflateBuildTable(InflateTable *table, const unsigned char *lengths, int count)
 {
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+    unsigned short offsets[16] = { 0 };
+    unsigned int nextCode[16] = { 0 };
+    int left = 1;
+
+    memset(table->counts, 0, sizeof(table->counts));
+    memset(table->fast, 0, sizeof(table->fast));
+
+    for (int i = 0; i < count; i++) table->counts[lengths[i]]++;
+    table->counts[0] = 0;
+
+    // Check codes are not over-subscribed
+    for (int len = 1; len < 16; len++)
+    {
+        left <<= 1;
+        left -= table->counts[len];
+        if (left < 0) return false;
+    }
+
+    for (int len = 1; len < 15; len++) offsets[len + 1] = offsets[len] + table->counts[len];
+    for (int len = 2; len < 16; len++) nextCode[len] = (nextCode[len - 1] + table->counts[len - 1]) << 1;
+
+    for (int i = 0; i < count; i++)
+    {
+        int len = lengths[i];
+        if (len == 0) continue;
+
+        table->symbols[offsets[len]++] = (unsigned short)i;
+
+        unsigned int code = nextCode[len]++;
+
+        if (len <= INFLATE_FAST_BITS)
+        {
+            // Codes are stored bit-reversed in the stream
+            unsigned int reversed = 0;
+            for (int b = 0; b < len; b++) reversed |= ((code >> b) & 1) << (len - 1 - b);
+
+            for (unsigned int j = reversed; j < (1 << INFLATE_FAST_BITS); j += (1 << len)) table->fast[j] = (unsigned short)((i << 4) | len);
+        }
+    }
+
+    return true;
 }
 
-// Draw a texture with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+// Decode one symbol from DEFLATE stream, -1 on invalid code
+static int InflateDecodeSymbol(ImageStreamContext *ctx, const InflateTable *table)
 {
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
+    InflateState *inflate = ctx->inflate;
+
+    if (inflate->bitCount < INFLATE_FAST_BITS)
+    {
+        // Make sure enough bits are available for fast lookup
+        while (inflate->bitCount < INFLATE_FAST_BITS)
+        {
+            int value = ReadPngDataByte(ctx);
+            if (value < 0) value = 0;
+            inflate->bits |= (unsigned long long)value << inflate->bitCount;
+            inflate->bitCount += 8;
+        }
+    }
+
+    int entry = table->fast[inflate->bits & ((1 << INFLATE_FAST_BITS) - 1)];
+
+    if (entry != 0)
+    {
+        inflate->bits >>= (entry & 15);
+        inflate->bitCount -= (entry & 15);
+        return entry >> 4;
+    }
+
+    // Slow path for longer codes, decoding bit-by-bit
+    int base = 0;
+    int offset = 0;
+
+    for (int len = 1; len < 16; len++)
+    {
+        offset = 2*offset + (int)InflateGetBits(ctx, 1);
+        if (offset < table->counts[len]) return table->symbols[base + offset];
+        base += table->counts[len];
+        offset -= table->counts[len];
+    }
+
+    return -1;
 }
 
-// Draw a texture with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+// Read dynamic Huffman codes block header
+static bool InflateReadDynamicTables(ImageStreamContext *ctx)
 {
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+    static const unsigned char order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    InflateState *inflate = ctx->inflate;
+    unsigned char lengths[288 + 32] = { 0 };
 
-    DrawTexturePro(texture, source, dest, origin, rotation, tint);
-}
+    int litCount = (int)InflateGetBits(ctx, 5) + 257;
+    int distCount = (int)InflateGetBits(ctx, 5) + 1;
+    int codeCount = (int)InflateGetBits(ctx, 4) + 4;
 
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
-{
-    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+    if ((litCount > 286) || (distCount > 30)) return false;
 
-    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+    for (int i = 0; i < codeCount; i++) lengths[order[i]] = (unsigned char)InflateGetBits(ctx, 3);
+
+    // Code lengths table is temporarily stored as literals table
+    if (!InflateBuildTable(&inflate->lit, lengths, 19)) return false;
+
+    memset(lengths, 0, 19);
+
+    for (int n = 0; n < (litCount + distCount);)
+    {
+        int symbol = InflateDecodeSymbol(ctx, &inflate->lit);
+        int repeat = 0;
+        unsigned char value = 0;
+
+        if (symbol < 0) return false;
+        else if (symbol < 16) { lengths[n++] = (unsigned char)symbol; continue; }
+        else if (symbol == 16)
+        {
+            if (n == 0) return false;
+            value = lengths[n - 1];
+            repeat = 3 + (int)InflateGetBits(ctx, 2);
+        }
+        else if (symbol == 17) repeat = 3 + (int)InflateGetBits(ctx, 3);
+        else repeat = 11 + (int)InflateGetBits(ctx, 7);
+
+        if ((n + repeat) > (litCount + distCount)) return false;
+
+        memset(lengths + n, value, repeat);
+        n += repeat;
+    }
+
+    if (lengths[256] == 0) return false;    // End-of-block code required
+
+    return (InflateBuildTable(&inflate->lit, lengths, litCount) && InflateBuildTable(&inflate->dist, lengths + litCount, distCount));
 }
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Decode DEFLATE stream data from PNG image data chunks
+// NOTE: Decoding stops as soon as requested output size is reached, it continues on next call
+static int InflateRead(ImageStreamContext *ctx, unsigned char *output, int size)
 {
-    // Check if texture is valid
-    if (texture.id > 0)
+    InflateState *inflate = ctx->inflate;
+    int produced = 0;
+
+    while ((produced < size) && !inflate->finished)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        if (inflate->matchLength > 0)
+        {
+            // Copy back-reference from sliding window
+            while ((inflate->matchLength > 0) && (produced < size))
+            {
+                unsigned char value = inflate->window[(inflate->windowPos - inflate->matchDistance) & 32767];
+                inflate->window[inflate->windowPos] = value;
+                inflate->windowPos = (inflate->windowPos + 1) & 32767;
+                output[produced++] = value;
+                inflate->matchLength--;
+            }
+        }
+        else if (inflate->blockType < 0)
+        {
+            if (inflate->lastBlock) { inflate->finished = true; break; }
 
-        bool flipX = false;
+            inflate->lastBlock = (InflateGetBits(ctx, 1) == 1);
+            int type = (int)InflateGetBits(ctx, 2);
 
-        if (source.width < 0) { flipX = true; source.width *= -1; }
-        if (source.height < 0) source.y -= source.height;
+            if (type == 0)
+            {
+                // Stored block, aligned to byte boundary
+                InflateGetBits(ctx, inflate->bitCount & 7);
+                unsigned int length = InflateGetBits(ctx, 16);
+                unsigned int lengthCheck = InflateGetBits(ctx, 16);
 
-        if (dest.width < 0) dest.width *= -1;
-        if (dest.height < 0) dest.height *= -1;
+                if ((length ^ 0xffff) != lengthCheck) inflate->finished = true;
+                inflate->storedLength = length;
+            }
+            else if (type == 1)
+            {
+                unsigned char lengths[288 + 32] = { 0 };
 
-        Vector2 topLeft = { 0 };
-        Vector2 topRight = { 0 };
-        Vector2 bottomLeft = { 0 };
-        Vector2 bottomRight = { 0 };
+                for (int i = 0; i < 144; i++) lengths[i] = 8;
+                for (int i = 144; i < 256; i++) lengths[i] = 9;
+                for (int i = 256; i < 280; i++) lengths[i] = 7;
+                for (int i = 280; i < 288; i++) lengths[i] = 8;
+                for (int i = 288; i < 288 + 30; i++) lengths[i] = 5;
 
-        // Only calculate rotation if needed
-        if (rotation == 0.0f)
+                InflateBuildTable(&inflate->lit, lengths, 288);
+                InflateBuildTable(&inflate->dist, lengths + 288, 30);
+            }
+            else if ((type == 3) || !InflateReadDynamicTables(ctx)) inflate->finished = true;
+
+            inflate->blockType = type;
+        }
+        else if (inflate->blockType == 0)
         {
-            float x = dest.x - origin.x;
-            float y = dest.y - origin.y;
-            topLeft = (Vector2){ x, y };
-            topRight = (Vector2){ x + dest.width, y };
-            bottomLeft = (Vector2){ x, y + dest.height };
-            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+            if (inflate->storedLength == 0) inflate->blockType = -1;
+            else
+            {
+                unsigned char value = (unsigned char)InflateGetBits(ctx, 8);
+                inflate->window[inflate->windowPos] = value;
+                inflate->windowPos = (inflate->windowPos + 1) & 32767;
+                output[produced++] = value;
+                inflate->storedLength--;
+            }
         }
         else
         {
-            float sinRotation = sinf(rotation*DEG2RAD);
-            float cosRotation = cosf(rotation*DEG2RAD);
-            float x = dest.x;
-            float y = dest.y;
-            float dx = -origin.x;
-            float dy = -origin.y;
-
-            topLeft.x = x + dx*cosRotation - dy*sinRotation;
-            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+            int symbol = InflateDecodeSymbol(ctx, &inflate->lit);
 
-            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
-            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+            if (symbol < 0) inflate->finished = true;
+            else if (symbol < 256)
+            {
+                inflate->window[inflate->windowPos] = (unsigned char)symbol;
+                inflate->windowPos = (inflate->windowPos + 1) & 32767;
+                output[produced++] = (unsigned char)symbol;
+            }
+            else if (symbol == 256) inflate->blockType = -1;
+            else
+            {
+                symbol -= 257;
+                if (symbol >= 29) { inflate->finished = true; break; }
 
-            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
-            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+                int length = deflateLengthBase[symbol] + (int)InflateGetBits(ctx, deflateLengthExtra[symbol]);
+                int distSymbol = InflateDecodeSymbol(ctx, &inflate->dist);
+                if ((distSymbol < 0) || (distSymbol >= 30)) { inflate->finished = true; break; }
 
-            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
-            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+                inflate->matchLength = length;
+                inflate->matchDistance = deflateDistanceBase[distSymbol] + (int)InflateGetBits(ctx, deflateDistanceExtra[distSymbol]);
+            }
         }
+    }
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+    return produced;
+}
+#endif // SUPPORT_FILEFORMAT_PNG
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+#if SUPPORT_FILEFORMAT_QOI
+// Read QOI header
+static bool OpenImageStreamQOI(ImageStreamContext *ctx)
+{
+    unsigned char header[14] = { 0 };
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+    ImageStreamSeek(ctx, 0);
+    if ((ImageStreamReadData(ctx, header, 14) != 14) || (memcmp(header, "qoif", 4) != 0)) return false;
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+    ctx->width = (header[4] << 24) | (header[5] << 16) | (header[6] << 8) | header[7];
+    ctx->height = (header[8] << 24) | (header[9] << 16) | (header[10] << 8) | header[11];
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+    if ((ctx->width <= 0) || (ctx->height <= 0) || ((header[12] != 3) && (header[12] != 4))) return false;
+    if (ctx->width > INT_MAX/header[12]) return false;     // Row size must fit in int
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+    ctx->format = (header[12] == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+    ctx->dataOffset = 14;
 
-        rlEnd();
-        rlSetTexture(0);
+    RewindImageStreamQOI(ctx);
 
-        // NOTE: Vertex position can be transformed using matrices
-        // but the process is way more costly than calculating
-        // the vertex positions manually, like done above
-        // Old implementation is left here for educational purposes,
-        // in case someone wants to do some performance test
-        /*
-        rlSetTexture(texture.id);
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+    return true;
+}
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+// Restart QOI image data decoding
+static void RewindImageStreamQOI(ImageStreamContext *ctx)
+{
+    ImageStreamSeek(ctx, ctx->dataOffset);
+
+    memset(ctx->qoiIndex, 0, sizeof(ctx->qoiIndex));
+    ctx->qoiPixel[0] = 0;
+    ctx->qoiPixel[1] = 0;
+    ctx->qoiPixel[2] = 0;
+    ctx->qoiPixel[3] = 255;
+    ctx->qoiRun = 0;
+    ctx->nextRow = 0;
+}
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                else rlTexCoord2f(source.x/width, source.y/height);
-                rlVertex2f(0.0f, 0.0f);
+// Decode next QOI row
+static bool ReadImageStreamRowQOI(ImageStreamContext *ctx, unsigned char *row)
+{
+    unsigned char *px = ctx->qoiPixel;
+    int channels = (ctx->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 3;
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                rlVertex2f(0.0f, dest.height);
+    for (int x = 0; x < ctx->width; x++)
+    {
+        if (ctx->qoiRun > 0) ctx->qoiRun--;
+        else
+        {
+            int b1 = ImageStreamReadByte(ctx);
+            if (b1 < 0) return false;
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                rlVertex2f(dest.width, dest.height);
+            if (b1 == 0xfe)         // QOI_OP_RGB
+            {
+                for (int c = 0; c < 3; c++) px[c] = (unsigned char)ImageStreamReadByte(ctx);
+            }
+            else if (b1 == 0xff)    // QOI_OP_RGBA
+            {
+                for (int c = 0; c < 4; c++) px[c] = (unsigned char)ImageStreamReadByte(ctx);
+            }
+            else if ((b1 & 0xc0) == 0x00) memcpy(px, ctx->qoiIndex + b1*4, 4);    // QOI_OP_INDEX
+            else if ((b1 & 0xc0) == 0x40)    // QOI_OP_DIFF
+            {
+                px[0] += ((b1 >> 4) & 0x03) - 2;
+                px[1] += ((b1 >> 2) & 0x03) - 2;
+                px[2] += (b1 & 0x03) - 2;
+            }
+            else if ((b1 & 0xc0) == 0x80)    // QOI_OP_LUMA
+            {
+                int b2 = ImageStreamReadByte(ctx);
+                int vg = (b1 & 0x3f) - 32;
+                px[0] += vg - 8 + ((b2 >> 4) & 0x0f);
+                px[1] += vg;
+                px[2] += vg - 8 + (b2 & 0x0f);
+            }
+            else ctx->qoiRun = (b1 & 0x3f);  // QOI_OP_RUN
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                rlVertex2f(dest.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
-        rlSetTexture(0);
-        */
+            memcpy(ctx->qoiIndex + ((px[0]*3 + px[1]*5 + px[2]*7 + px[3]*11)%64)*4, px, 4);
+        }
+
+        memcpy(row + x*channels, px, channels);
     }
+
+    ctx->nextRow++;
+
+    return true;
 }
+#endif // SUPPORT_FILEFORMAT_QOI
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Load resampling contributions, every destination sample reads 'taps' source samples from first[i]
+// NOTE: Box filter (area-average) used for downscaling, bilinear filter for upscaling
+static int LoadResampleWeights(int srcSize, int dstSize, int **first, float **weights)
 {
-    if (texture.id > 0)
+    int taps = (dstSize < srcSize)? ((srcSize + dstSize - 1)/dstSize + 1) : 2;
+    float scale = (float)srcSize/(float)dstSize;
+
+    *first = (int *)RL_MALLOC(dstSize*sizeof(int));
+    *weights = (float *)RL_CALLOC(dstSize*taps, sizeof(float));
+
+    for (int i = 0; i < dstSize; i++)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        float *w = *weights + i*taps;
 
-        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
-        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+        if (dstSize < srcSize)
+        {
+            // Area covered by destination sample over source samples
+            float start = i*scale;
+            float end = start + scale;
+            int s = (int)start;
+            (*first)[i] = s;
 
-        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
-        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+            for (int t = 0; (t < taps) && ((s + t) < srcSize); t++)
+            {
+                float overlap = fminf(end, (float)(s + t + 1)) - fmaxf(start, (float)(s + t));
+                if (overlap > 0.0f) w[t] = overlap/scale;
+            }
+        }
+        else
+        {
+            // Destination sample center mapped into source samples
+            float x = (i + 0.5f)*scale - 0.5f;
+            if (x < 0.0f) x = 0.0f;
+            int s = (int)x;
+            if (s > (srcSize - 1)) s = srcSize - 1;
+            float frac = x - (float)s;
+            (*first)[i] = s;
+
+            if ((s + 1) < srcSize)
+            {
+                w[0] = 1.0f - frac;
+                w[1] = frac;
+            }
+            else w[0] = 1.0f;
+        }
+    }
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+    return taps;
+}
 
-        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+#if SUPPORT_IMAGE_EXPORT && SUPPORT_FILEFORMAT_PNG
+// Compute Adler-32 checksum (zlib streams)
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int dataSize)
+{
+    unsigned int s1 = adler & 0xffff;
+    unsigned int s2 = adler >> 16;
+
+    while (dataSize > 0)
+    {
+        // NOTE: 5552 is the largest block size that can not overflow s2
+        int blockSize = (dataSize < 5552)? dataSize : 5552;
+        dataSize -= blockSize;
+
+        for (int i = 0; i < blockSize; i++)
         {
-            drawCenter = false;
-            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
-            rightBorder = patchWidth - leftBorder;
+            s1 += data[i];
+            s2 += s1;
         }
 
-        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        data += blockSize;
+        s1 %= 65521;
+        s2 %= 65521;
+    }
+
+    return (s2 << 16) | s1;
+}
+
+// Write bits into DEFLATE stream
+static void DeflatePutBits(DeflateWriter *writer, unsigned int value, int count)
+{
+    writer->bits |= (unsigned long long)value << writer->bitCount;
+    writer->bitCount += count;
+
+    while (writer->bitCount >= 8)
+    {
+        writer->output[writer->size++] = (unsigned char)writer->bits;
+        writer->bits >>= 8;
+        writer->bitCount -= 8;
+    }
+}
+
+// Compress data into DEFLATE blocks, not marked as final and byte-aligned at the end (sync flush)
+// NOTE: Level 0 stores data uncompressed, levels 1..9 search longer match chains with fixed Huffman codes,
+// blocks from multiple calls can be concatenated into a single stream
+static int DeflateBlocks(const unsigned char *data, int dataSize, unsigned char *output, int level)
+{
+    DeflateWriter writer = { output, 0, 0, 0 };
+
+    if (level <= 0)
+    {
+        for (int offset = 0; offset < dataSize; offset += 65535)
         {
-            drawMiddle = false;
-            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
-            bottomBorder = patchHeight - topBorder;
+            int length = ((dataSize - offset) < 65535)? (dataSize - offset) : 65535;
+
+            output[writer.size++] = 0x00;   // Stored block header (not final), padded to byte boundary
+            output[writer.size++] = (unsigned char)length;
+            output[writer.size++] = (unsigned char)(length >> 8);
+            output[writer.size++] = (unsigned char)~length;
+            output[writer.size++] = (unsigned char)(~length >> 8);
+            memcpy(output + writer.size, data + offset, length);
+            writer.size += length;
         }
 
-        Vector2 vertA = { 0 };
-        Vector2 vertB = { 0 };
-        Vector2 vertC = { 0 };
-        Vector2 vertD = { 0 };
-        vertA.x = 0.0f;                             // Outer left
-        vertA.y = 0.0f;                             // Outer top
-        vertB.x = leftBorder;                       // Inner left
-        vertB.y = topBorder;                        // Inner top
-        vertC.x = patchWidth  - rightBorder;        // Inner right
-        vertC.y = patchHeight - bottomBorder;       // Inner bottom
-        vertD.x = patchWidth;                       // Outer right
-        vertD.y = patchHeight;                      // Outer bottom
+        return writer.size;
+    }
 
-        Vector2 coordA = { 0 };
-        Vector2 coordB = { 0 };
-        Vector2 coordC = { 0 };
-        Vector2 coordD = { 0 };
-        coordA.x = nPatchInfo.source.x/width;
-        coordA.y = nPatchInfo.source.y/height;
-        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
-        coordB.y = (nPatchInfo.source.y + topBorder)/height;
-        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
-        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
-        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
-        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+    if (level > 9) level = 9;
 
-        rlSetTexture(texture.id);
+    // Fixed Huffman codes, stored bit-reversed for writing
+    unsigned short codes[288] = { 0 };
+    unsigned char lengths[288] = { 0 };
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+    for (int i = 0; i < 288; i++)
+    {
+        unsigned int code = 0;
+
+        if (i < 144) { code = 0x30 + i; lengths[i] = 8; }
+        else if (i < 256) { code = 0x190 + i - 144; lengths[i] = 9; }
+        else if (i < 280) { code = i - 256; lengths[i] = 7; }
+        else { code = 0xc0 + i - 280; lengths[i] = 8; }
+
+        for (int b = 0; b < lengths[i]; b++) codes[i] |= ((code >> b) & 1) << (lengths[i] - 1 - b);
+    }
+
+    int *head = (int *)RL_MALLOC(32768*sizeof(int));
+    int *prev = (int *)RL_MALLOC(32768*sizeof(int));
+    for (int i = 0; i < 32768; i++) head[i] = -1;
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+    int maxChain = 1 << (level - 1);
+    int pos = 0;
 
-                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
-                    {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
-                        {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
-                        }
+    DeflatePutBits(&writer, 0, 1);      // Block not final
+    DeflatePutBits(&writer, 1, 2);      // Block with fixed Huffman codes
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
+    while (pos < dataSize)
+    {
+        int bestLength = 0;
+        int bestDistance = 0;
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
+        if ((pos + 3) <= dataSize)
+        {
+            unsigned int hash = (((data[pos] << 16) | (data[pos + 1] << 8) | data[pos + 2])*2654435761u) >> 17;
+            int maxLength = ((dataSize - pos) < 258)? (dataSize - pos) : 258;
+            int candidate = head[hash];
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+            for (int chain = maxChain; (candidate >= 0) && ((pos - candidate) <= 32768) && (chain > 0); chain--)
+            {
+                if (data[candidate + bestLength] == data[pos + bestLength])
                 {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+                    int length = 0;
+                    while ((length < maxLength) && (data[candidate + length] == data[pos + length])) length++;
+
+                    if (length > bestLength)
                     {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        bestLength = length;
+                        bestDistance = pos - candidate;
+                        if (length == maxLength) break;
                     }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
                 }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+
+                candidate = prev[candidate & 32767];
+            }
+
+            prev[pos & 32767] = head[hash];
+            head[hash] = pos;
+        }
+
+        // Short matches at long distances are more expensive than literals
+        if ((bestLength == 3) && (bestDistance > 4096)) bestLength = 0;
+
+        if (bestLength >= 3)
+        {
+            int lengthCode = 28;
+            while (deflateLengthBase[lengthCode] > bestLength) lengthCode--;
+            int distanceCode = 29;
+            while (deflateDistanceBase[distanceCode] > bestDistance) distanceCode--;
+
+            DeflatePutBits(&writer, codes[257 + lengthCode], lengths[257 + lengthCode]);
+            DeflatePutBits(&writer, bestLength - deflateLengthBase[lengthCode], deflateLengthExtra[lengthCode]);
+
+            unsigned int reversed = 0;
+            for (int b = 0; b < 5; b++) reversed |= ((distanceCode >> b) & 1) << (4 - b);
+            DeflatePutBits(&writer, reversed, 5);
+            DeflatePutBits(&writer, bestDistance - deflateDistanceBase[distanceCode], deflateDistanceExtra[distanceCode]);
+
+            // Register match positions for future matches (skipped on fastest levels)
+            if (level > 2)
+            {
+                for (int i = pos + 1; (i < (pos + bestLength)) && ((i + 3) <= dataSize); i++)
                 {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    unsigned int hash = (((data[i] << 16) | (data[i + 1] << 8) | data[i + 2])*2654435761u) >> 17;
+                    prev[i & 32767] = head[hash];
+                    head[hash] = i;
                 }
-            rlEnd();
-        rlPopMatrix();
+            }
 
-        rlSetTexture(0);
+            pos += bestLength;
+        }
+        else
+        {
+            DeflatePutBits(&writer, codes[data[pos]], lengths[data[pos]]);
+            pos++;
+        }
     }
+
+    DeflatePutBits(&writer, codes[256], lengths[256]);      // End of block
+
+    // Empty stored block to align stream to byte boundary (sync flush)
+    DeflatePutBits(&writer, 0, 3);
+    if (writer.bitCount > 0) DeflatePutBits(&writer, 0, 8 - writer.bitCount);
+    output[writer.size++] = 0x00;
+    output[writer.size++] = 0x00;
+    output[writer.size++] = 0xff;
+    output[writer.size++] = 0xff;
+
+    RL_FREE(head);
+    RL_FREE(prev);
+
+    return writer.size;
 }
 
-// Check if two colors are equal
-bool ColorIsEqual(Color col1, Color col2)
+// Get maximum compressed size for a band of PNG rows
+static int GetPngBandBound(int rowCount, int rowSize)
 {
-    bool result = false;
+    int size = rowCount*(rowSize + 1);
 
-    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
-
-    return result;
+    // NOTE: Fixed Huffman codes use 9 bits per byte in the worst case
+    return size + size/8 + (size/65535 + 1)*5 + 64;
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color Fade(Color color, float alpha)
+// Filter and compress a band of PNG rows, filter is selected per row (minimum sum of absolute differences)
+// NOTE: Previous row is required to filter the first row of the band, NULL for the image first row,
+// rows are not filtered on store-only level (0)
+static int CompressPngBand(const unsigned char *rows, int rowCount, int rowSize, int channels, const unsigned char *previousRow, unsigned char *output, int level, unsigned int *adler)
 {
-    Color result = color;
+    unsigned char *filtered = (unsigned char *)RL_MALLOC(rowCount*(rowSize + 1));
+    unsigned char *candidates = (unsigned char *)RL_MALLOC(5*rowSize);
+    unsigned char *zeroRow = (previousRow == NULL)? (unsigned char *)RL_CALLOC(rowSize, 1) : NULL;
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    for (int y = 0; y < rowCount; y++)
+    {
+        const unsigned char *cur = rows + y*rowSize;
+        const unsigned char *prev = (y > 0)? (rows + (y - 1)*rowSize) : ((previousRow != NULL)? previousRow : zeroRow);
+        unsigned char *line = filtered + y*(rowSize + 1);
 
-    result.a = (unsigned char)(255.0f*alpha);
+        if (level <= 0)
+        {
+            line[0] = 0;
+            memcpy(line + 1, cur, rowSize);
+            continue;
+        }
 
-    return result;
+        // Filter candidates computed in separate loops, simple enough for compiler auto-vectorization
+        unsigned char *none = candidates;
+        unsigned char *sub = candidates + rowSize;
+        unsigned char *up = candidates + 2*rowSize;
+        unsigned char *average = candidates + 3*rowSize;
+        unsigned char *paeth = candidates + 4*rowSize;
+
+        memcpy(none, cur, rowSize);
+        for (int i = 0; i < channels; i++)
+        {
+            sub[i] = cur[i];
+            average[i] = (unsigned char)(cur[i] - (prev[i] >> 1));
+            paeth[i] = (unsigned char)(cur[i] - prev[i]);
+        }
+        for (int i = channels; i < rowSize; i++) sub[i] = (unsigned char)(cur[i] - cur[i - channels]);
+        for (int i = 0; i < rowSize; i++) up[i] = (unsigned char)(cur[i] - prev[i]);
+        for (int i = channels; i < rowSize; i++) average[i] = (unsigned char)(cur[i] - ((cur[i - channels] + prev[i]) >> 1));
+        for (int i = channels; i < rowSize; i++) paeth[i] = (unsigned char)(cur[i] - GetPaethPredictor(cur[i - channels], prev[i], prev[i - channels]));
+
+        int bestFilter = 0;
+        int bestScore = 0x7fffffff;
+
+        for (int filter = 0; filter < 5; filter++)
+        {
+            const signed char *candidate = (const signed char *)(candidates + filter*rowSize);
+            int score = 0;
+
+            for (int i = 0; i < rowSize; i++) score += abs(candidate[i]);
+
+            if (score < bestScore)
+            {
+                bestScore = score;
+                bestFilter = filter;
+            }
+        }
+
+        line[0] = (unsigned char)bestFilter;
+        memcpy(line + 1, candidates + bestFilter*rowSize, rowSize);
+    }
+
+    *adler = ComputeAdler32(*adler, filtered, rowCount*(rowSize + 1));
+    int size = DeflateBlocks(filtered, rowCount*(rowSize + 1), output, level);
+
+    RL_FREE(filtered);
+    RL_FREE(candidates);
+    RL_FREE(zeroRow);
+
+    return size;
 }
 
-// Get hexadecimal value for a Color
-int ColorToInt(Color color)
+// Combine Adler-32 checksums of consecutive data blocks, second block size required
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int dataSize2)
 {
-    int result = 0;
+    unsigned int remainder = (unsigned int)(dataSize2%65521);
+    unsigned int s1 = adler1 & 0xffff;
+    unsigned int s2 = (remainder*s1)%65521;
 
-    result = (int)(((unsigned int)color.r << 24) |
-                   ((unsigned int)color.g << 16) |
-                   ((unsigned int)color.b << 8) |
-                    (unsigned int)color.a);
+    s1 += (adler2 & 0xffff) + 65521 - 1;
+    s2 += (adler1 >> 16) + (adler2 >> 16) + 65521 - remainder;
 
-    return result;
+    if (s1 >= 65521) s1 -= 65521;
+    if (s1 >= 65521) s1 -= 65521;
+    if (s2 >= (65521 << 1)) s2 -= (65521 << 1);
+    if (s2 >= 65521) s2 -= 65521;
+
+    return (s2 << 16) | s1;
 }
 
-// Get color normalized as float [0..1]
-Vector4 ColorNormalize(Color color)
+// Compress PNG bands in range [startBand, endBand), every band stored as an IDAT chunk
+static void CompressPngBands(void *data, int startBand, int endBand)
 {
-    Vector4 result;
+    PngEncoderJob *job = (PngEncoderJob *)data;
 
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+    for (int b = startBand; b < endBand; b++)
+    {
+        int startRow = b*job->bandRows;
+        int rowCount = ((startRow + job->bandRows) > job->height)? (job->height - startRow) : job->bandRows;
+        const unsigned char *rows = job->data + (size_t)startRow*job->rowSize;
 
-    return result;
+        unsigned char *chunk = (unsigned char *)RL_MALLOC(GetPngBandBound(rowCount, job->rowSize) + 14);
+        int dataSize = 0;
+
+        // zlib stream header (DEFLATE, 32KB window) at the beginning of image data
+        if (b == 0) { chunk[8] = 0x78; chunk[9] = 0x01; dataSize = 2; }
+
+        // NOTE: Every band is compressed independently, band checksums combined on stream end
+        job->bandAdlers[b] = 1;
+        dataSize += CompressPngBand(rows, rowCount, job->rowSize, job->channels, (b == 0)? NULL : (rows - job->rowSize), chunk + 8 + dataSize, job->level, &job->bandAdlers[b]);
+
+        job->bands[b] = chunk;
+        job->bandSizes[b] = SetPngChunk(chunk, "IDAT", dataSize);
+    }
 }
 
-// Get color from normalized values [0..1]
-Color ColorFromNormalized(Vector4 normalized)
+// Encode image data (8 bit per channel) into PNG file data, row bands compressed in parallel
+static unsigned char *EncodePNG(const unsigned char *data, int width, int height, int channels, int level, int *dataSize)
 {
-    Color result;
+    static const unsigned char signature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+    static const int colorTypes[5] = { 0, 0, 4, 2, 6 };
+
+    PngEncoderJob job = { 0 };
+    job.data = data;
+    job.height = height;
+    job.channels = channels;
+    job.rowSize = width*channels;
+    job.level = level;
+    job.bandRows = IMAGE_STREAM_BAND_SIZE/job.rowSize;
+    if (job.bandRows < 1) job.bandRows = 1;
+
+    int bandCount = (height + job.bandRows - 1)/job.bandRows;
+    job.bands = (unsigned char **)RL_CALLOC(bandCount, sizeof(unsigned char *));
+    job.bandSizes = (int *)RL_CALLOC(bandCount, sizeof(int));
+    job.bandAdlers = (unsigned int *)RL_CALLOC(bandCount, sizeof(unsigned int));
+
+    RunImageJob(CompressPngBands, &job, bandCount, 1);
+
+    // Signature + IHDR chunk + image data chunks + final IDAT chunk + IEND chunk
+    int fileSize = 8 + 25 + 18 + 12;
+    for (int b = 0; b < bandCount; b++) fileSize += job.bandSizes[b];
+
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(fileSize);
+    unsigned char *chunk = fileData + 8;
+    memcpy(fileData, signature, 8);
+
+    unsigned char *header = chunk + 8;
+    header[0] = (unsigned char)(width >> 24); header[1] = (unsigned char)(width >> 16);
+    header[2] = (unsigned char)(width >> 8); header[3] = (unsigned char)width;
+    header[4] = (unsigned char)(height >> 24); header[5] = (unsigned char)(height >> 16);
+    header[6] = (unsigned char)(height >> 8); header[7] = (unsigned char)height;
+    header[8] = 8;                  // Bit depth
+    header[9] = (unsigned char)colorTypes[channels];
+    header[10] = 0;                 // Compression method: DEFLATE
+    header[11] = 0;                 // Filter method: adaptive
+    header[12] = 0;                 // Interlace method: none
+    chunk += SetPngChunk(chunk, "IHDR", 13);
+
+    unsigned int adler = 1;
+
+    for (int b = 0; b < bandCount; b++)
+    {
+        int startRow = b*job.bandRows;
+        int rowCount = ((startRow + job.bandRows) > height)? (height - startRow) : job.bandRows;
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+        memcpy(chunk, job.bands[b], job.bandSizes[b]);
+        chunk += job.bandSizes[b];
+        adler = CombineAdler32(adler, job.bandAdlers[b], rowCount*(job.rowSize + 1));
 
-    return result;
+        RL_FREE(job.bands[b]);
+    }
+
+    // Final empty DEFLATE block (fixed codes) and zlib stream checksum
+    unsigned char *end = chunk + 8;
+    end[0] = 0x03; end[1] = 0x00;
+    end[2] = (unsigned char)(adler >> 24); end[3] = (unsigned char)(adler >> 16);
+    end[4] = (unsigned char)(adler >> 8); end[5] = (unsigned char)adler;
+    chunk += SetPngChunk(chunk, "IDAT", 6);
+    SetPngChunk(chunk, "IEND", 0);
+
+    RL_FREE(job.bands);
+    RL_FREE(job.bandSizes);
+    RL_FREE(job.bandAdlers);
+
+    *dataSize = fileSize;
+
+    return fileData;
 }
 
-// Get HSV values for a Color
-// NOTE: Hue is returned as degrees [0..360]
-Vector3 ColorToHSV(Color color)
+// Set PNG chunk header and CRC, data must be placed at (chunk + 8)
+static int SetPngChunk(unsigned char *chunk, const char *type, int dataSize)
 {
-    Vector3 hsv = { 0 };
-    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min = 0.0f;
-    float max = 0.0f;
-    float delta = 0.0f;
+    chunk[0] = (unsigned char)(dataSize >> 24);
+    chunk[1] = (unsigned char)(dataSize >> 16);
+    chunk[2] = (unsigned char)(dataSize >> 8);
+    chunk[3] = (unsigned char)dataSize;
+    memcpy(chunk + 4, type, 4);
+
+    unsigned int crc = ComputeCRC32(chunk + 4, dataSize + 4);   // NOTE: Using function provided by [rcore] module
+    chunk[8 + dataSize] = (unsigned char)(crc >> 24);
+    chunk[9 + dataSize] = (unsigned char)(crc >> 16);
+    chunk[10 + dataSize] = (unsigned char)(crc >> 8);
+    chunk[11 + dataSize] = (unsigned char)crc;
+
+    return dataSize + 12;
+}
+#endif // SUPPORT_IMAGE_EXPORT && SUPPORT_FILEFORMAT_PNG
 
-    min = (rgb.x < rgb.y)? rgb.x : rgb.y;
-    min = (min < rgb.z)? min : rgb.z;
+// Check image container (.rli) header and data size
+static bool CheckImageContainer(const unsigned char *fileData, size_t dataSize)
+{
+    if ((fileData == NULL) || (dataSize < sizeof(ImageContainerHeader))) return false;
 
-    max = (rgb.x > rgb.y)? rgb.x : rgb.y;
-    max = (max > rgb.z)? max : rgb.z;
+    const ImageContainerHeader *header = (const ImageContainerHeader *)fileData;
 
-    hsv.z = max; // Value
-    delta = max - min;
+    if ((memcmp(header->id, "rIMG", 4) != 0) || (header->version != IMAGE_CONTAINER_VERSION)) return false;
+    if ((header->width <= 0) || (header->height <= 0) || (header->mipmaps <= 0)) return false;
+    if ((header->format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (header->format > PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) return false;
 
-    if (delta < 0.00001f)
-    {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f; // Undefined, maybe NAN?
-        return hsv;
-    }
+    if (header->dataSize < 0) return false;
 
-    if (max > 0.0f)
+    // Mipmap levels can not exceed the full chain down to 1x1
+    int maxMipmaps = 1;
+    for (int dim = (header->width > header->height)? header->width : header->height; dim > 1; dim /= 2) maxMipmaps++;
+    if (header->mipmaps > maxMipmaps) return false;
+
+    // NOTE: GetPixelDataSize() is computed in int and overflows for huge images,
+    // level sizes are computed in 64-bit, bits per pixel retrieved from a 4x4 block
+    int bpp = GetPixelDataSize(4, 4, header->format)/2;
+    if (bpp <= 0) return false;
+
+    // Pixel data size must match image parameters, including all mipmap levels
+    long long size = 0;
+
+    for (int i = 0, width = header->width, height = header->height; i < header->mipmaps; i++)
     {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max); // Saturation
+        long long levelSize = (long long)width*height;
+        if (levelSize > 4LL*INT_MAX) return false;
+
+        levelSize = levelSize*bpp/8;
+
+        // Most compressed formats works on 4x4 blocks, minimum level size is 8 or 16
+        if ((width < 4) && (height < 4))
+        {
+            if ((header->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (header->format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) levelSize = 8;
+            else if ((header->format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (header->format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) levelSize = 16;
+        }
+
+        size += levelSize;
+        if (size > INT_MAX) return false;
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
     }
-    else
+
+    return ((size == header->dataSize) && ((size_t)size <= (dataSize - sizeof(ImageContainerHeader))));
+}
+
+#if SUPPORT_IMAGE_MMAP
+// Map file data into memory (copy-on-write)
+// NOTE: Mapped pages are shared with other processes mapping the same file until written,
+// NULL is returned if file mapping is not supported by the platform
+static void *MapFileData(const char *fileName, size_t *size)
+{
+    void *mapping = NULL;
+    *size = 0;
+
+#if defined(_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);  // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+    if (file != (void *)(long long)-1)  // INVALID_HANDLE_VALUE
     {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = NAN; // Undefined
-        return hsv;
+        long long fileSize = 0;
+
+        if (GetFileSizeEx(file, &fileSize) && (fileSize > 0))
+        {
+            void *fileMapping = CreateFileMappingA(file, NULL, 0x08, 0, 0, NULL);    // PAGE_WRITECOPY
+
+            if (fileMapping != NULL)
+            {
+                mapping = MapViewOfFile(fileMapping, 0x0001, 0, 0, 0);   // FILE_MAP_COPY
+                if (mapping != NULL) *size = (size_t)fileSize;
+
+                CloseHandle(fileMapping);   // NOTE: File mapping is kept alive by the view
+            }
+        }
+
+        CloseHandle(file);
     }
+#elif defined(__unix__) || defined(__APPLE__)
+    int file = open(fileName, O_RDONLY);
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta; // Between yellow & magenta
-    else
+    if (file >= 0)
     {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta; // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta; // Between magenta & cyan
-    }
+        struct stat fileStat = { 0 };
 
-    hsv.x *= 60.0f; // Convert to degrees
+        if ((fstat(file, &fileStat) == 0) && (fileStat.st_size > 0))
+        {
+            mapping = mmap(NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+            if (mapping == MAP_FAILED) mapping = NULL;
+            else *size = (size_t)fileStat.st_size;
+        }
 
-    return hsv;
+        close(file);    // NOTE: Mapping is kept after closing the file descriptor
+    }
+#else
+    (void)fileName;
+#endif
+
+    return mapping;
 }
 
-// Get a Color from HSV values
-// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
-// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
-// Hue is provided in degrees: [0..360]
-// Saturation/Value are provided normalized: [0.0f..1.0f]
-Color ColorFromHSV(float hue, float saturation, float value)
+// Unmap file data from memory
+static void UnmapFileData(void *mapping, size_t size)
 {
-    Color color = { 0, 0, 0, 255 };
+#if defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(mapping);
+#elif defined(__unix__) || defined(__APPLE__)
+    munmap(mapping, size);
+#else
+    (void)mapping;
+    (void)size;
+#endif
+}
 
-    // Red channel
-    float k = fmodf((5.0f + hue/60.0f), 6);
-    float t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+// Register memory-mapped image data
+static void RegisterImageMapping(void *data, void *mapping, size_t size)
+{
+    LockImageMappings();
 
-    // Green channel
-    k = fmodf((3.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+    if (imageMappingCount >= imageMappingCapacity)
+    {
+        imageMappingCapacity = (imageMappingCapacity > 0)? imageMappingCapacity*2 : 16;
+        imageMappings = (ImageMapping *)RL_REALLOC(imageMappings, imageMappingCapacity*sizeof(ImageMapping));
+    }
 
-    // Blue channel
-    k = fmodf((1.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+    imageMappings[imageMappingCount].data = data;
+    imageMappings[imageMappingCount].mapping = mapping;
+    imageMappings[imageMappingCount].size = size;
+    imageMappingCount++;
 
-    return color;
+    UnlockImageMappings();
 }
 
-// Get color multiplied with another color
-Color ColorTint(Color color, Color tint)
+// Unmap image data if memory-mapped, returns true if unmapped
+static bool UnloadImageMapping(void *data)
 {
-    Color result = color;
+    if (data == NULL) return false;
 
-    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
-    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
-    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
-    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+    ImageMapping unmapped = { 0 };
 
-    result.r = r;
-    result.g = g;
-    result.b = b;
-    result.a = a;
+    LockImageMappings();
 
-    return result;
+    for (int i = 0; i < imageMappingCount; i++)
+    {
+        if (imageMappings[i].data == data)
+        {
+            unmapped = imageMappings[i];
+
+            // Keep registry packed, order is not relevant
+            imageMappings[i] = imageMappings[imageMappingCount - 1];
+            imageMappingCount--;
+
+            if (imageMappingCount == 0)
+            {
+                RL_FREE(imageMappings);
+                imageMappings = NULL;
+                imageMappingCapacity = 0;
+            }
+
+            break;
+        }
+    }
+
+    UnlockImageMappings();
+
+    // File is unmapped out of the lock, it can take some time
+    if (unmapped.data != NULL) UnmapFileData(unmapped.mapping, unmapped.size);
+
+    return (unmapped.data != NULL);
 }
 
-// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
-Color ColorBrightness(Color color, float factor)
+// Lock memory-mapped images registry, it can be accessed from several threads
+// NOTE: Images are loaded/unloaded by the main thread, RunImageJob() workers (i.e. font glyphs rasterization
+// unloads its images) and user threads loading images or image streams
+static void LockImageMappings(void)
 {
-    Color result = color;
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&imageMappingLock);
+    #elif defined(__unix__) || defined(__APPLE__)
+    pthread_mutex_lock(&imageMappingLock);
+    #endif
+#endif
+}
 
-    if (factor > 1.0f) factor = 1.0f;
-    else if (factor < -1.0f) factor = -1.0f;
+// Unlock memory-mapped images registry
+static void UnlockImageMappings(void)
+{
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&imageMappingLock);
+    #elif defined(__unix__) || defined(__APPLE__)
+    pthread_mutex_unlock(&imageMappingLock);
+    #endif
+#endif
+}
+#endif // SUPPORT_IMAGE_MMAP
 
-    float red = (float)color.r;
-    float green = (float)color.g;
-    float blue = (float)color.b;
+// Record image pipeline operation
+static void AddImagePipelineOp(ImagePipeline *pipeline, ImagePipelineOp op)
+{
+    pipeline->ops = RL_REALLOC(pipeline->ops, (pipeline->opCount + 1)*sizeof(ImagePipelineOp));
+    ((ImagePipelineOp *)pipeline->ops)[pipeline->opCount] = op;
+    pipeline->opCount++;
+}
 
-    if (factor < 0.0f)
+// Process image pipeline rows in range [startRow, endRow)
+static void ProcessImagePipelineRows(void *data, int startRow, int endRow)
+{
+    ImagePipelineJob *job = (ImagePipelineJob *)data;
+    Image src = job->src;
+    Image dst = job->dst;
+
+    int srcPixelSize = GetPixelDataSize(1, 1, src.format);
+    int dstPixelSize = GetPixelDataSize(1, 1, dst.format);
+    Color *row = (Color *)RL_MALLOC(dst.width*sizeof(Color));
+    Color *srcRow = NULL;
+    float *accum = NULL;
+
+    if (job->tapsX > 0)
     {
-        factor = 1.0f + factor;
-        red *= factor;
-        green *= factor;
-        blue *= factor;
+        srcRow = (Color *)RL_MALLOC(src.width*sizeof(Color));
+        accum = (float *)RL_MALLOC(dst.width*4*sizeof(float));
     }
-    else
+
+    for (int y = startRow; y < endRow; y++)
     {
-        red = (255 - red)*factor + red;
-        green = (255 - green)*factor + green;
-        blue = (255 - blue)*factor + blue;
-    }
+        // Load row pixels, resampled if required
+        if (job->tapsX > 0)
+        {
+            memset(accum, 0, dst.width*4*sizeof(float));
 
-    result.r = (unsigned char)red;
-    result.g = (unsigned char)green;
-    result.b = (unsigned char)blue;
+            for (int ty = 0; ty < job->tapsY; ty++)
+            {
+                float wy = job->weightsY[y*job->tapsY + ty];
+                if (wy <= 0.0f) continue;
 
-    return result;
-}
+                LoadImagePipelineRow(src, job->firstY[y] + ty, srcRow, srcPixelSize);
 
-// Get color with contrast correction
-// NOTE: Contrast values between -1.0f and 1.0f
-Color ColorContrast(Color color, float contrast)
-{
-    Color result = color;
+                for (int x = 0; x < dst.width; x++)
+                {
+                    const float *wx = job->weightsX + x*job->tapsX;
+                    const Color *pixel = srcRow + job->firstX[x];
+                    float *sum = accum + x*4;
 
-    if (contrast < -1.0f) contrast = -1.0f;
-    else if (contrast > 1.0f) contrast = 1.0f;
+                    for (int tx = 0; tx < job->tapsX; tx++)
+                    {
+                        float w = wx[tx]*wy;
+                        if (w <= 0.0f) continue;
 
-    contrast = (1.0f + contrast);
-    contrast *= contrast;
+                        sum[0] += pixel[tx].r*w;
+                        sum[1] += pixel[tx].g*w;
+                        sum[2] += pixel[tx].b*w;
+                        sum[3] += pixel[tx].a*w;
+                    }
+                }
+            }
 
-    float pR = (float)color.r/255.0f;
-    pR -= 0.5f;
-    pR *= contrast;
-    pR += 0.5f;
-    pR *= 255;
-    if (pR < 0) pR = 0;
-    else if (pR > 255) pR = 255;
+            for (int x = 0; x < dst.width; x++)
+            {
+                row[x].r = (unsigned char)fminf(accum[x*4] + 0.5f, 255.0f);
+                row[x].g = (unsigned char)fminf(accum[x*4 + 1] + 0.5f, 255.0f);
+                row[x].b = (unsigned char)fminf(accum[x*4 + 2] + 0.5f, 255.0f);
+                row[x].a = (unsigned char)fminf(accum[x*4 + 3] + 0.5f, 255.0f);
+            }
+        }
+        else LoadImagePipelineRow(src, y, row, srcPixelSize);
 
-    float pG = (float)color.g/255.0f;
-    pG -= 0.5f;
-    pG *= contrast;
-    pG += 0.5f;
-    pG *= 255;
-    if (pG < 0) pG = 0;
-    else if (pG > 255) pG = 255;
+        // Apply pipeline stages to row pixels
+        for (int s = 0; s < job->stageCount; s++)
+        {
+            const ImagePipelineStage *stage = &job->stages[s];
 
-    float pB = (float)color.b/255.0f;
-    pB -= 0.5f;
-    pB *= contrast;
-    pB += 0.5f;
-    pB *= 255;
-    if (pB < 0) pB = 0;
-    else if (pB > 255) pB = 255;
+            switch (stage->type)
+            {
+                case IMAGE_PIPELINE_OP_LUT:
+                {
+                    for (int x = 0; x < dst.width; x++)
+                    {
+                        row[x].r = stage->lut[0][row[x].r];
+                        row[x].g = stage->lut[1][row[x].g];
+                        row[x].b = stage->lut[2][row[x].b];
+                        row[x].a = stage->lut[3][row[x].a];
+                    }
+                } break;
+                case IMAGE_PIPELINE_OP_GRAYSCALE:
+                {
+                    for (int x = 0; x < dst.width; x++)
+                    {
+                        unsigned char gray = (unsigned char)((((float)row[x].r/255.0f)*0.299f + ((float)row[x].g/255.0f)*0.587f + ((float)row[x].b/255.0f)*0.114f)*255.0f);
+                        row[x].r = gray;
+                        row[x].g = gray;
+                        row[x].b = gray;
+                    }
+                } break;
+                case IMAGE_PIPELINE_OP_REPLACE:
+                {
+                    for (int x = 0; x < dst.width; x++)
+                    {
+                        if ((row[x].r == stage->color.r) && (row[x].g == stage->color.g) &&
+                            (row[x].b == stage->color.b) && (row[x].a == stage->color.a)) row[x] = stage->replace;
+                    }
+                } break;
+                case IMAGE_PIPELINE_OP_PREMULTIPLY:
+                {
+                    for (int x = 0; x < dst.width; x++)
+                    {
+                        if (row[x].a == 0)
+                        {
+                            row[x].r = 0;
+                            row[x].g = 0;
+                            row[x].b = 0;
+                        }
+                        else if (row[x].a < 255)
+                        {
+                            float alpha = (float)row[x].a/255.0f;
+                            row[x].r = (unsigned char)((float)row[x].r*alpha);
+                            row[x].g = (unsigned char)((float)row[x].g*alpha);
+                            row[x].b = (unsigned char)((float)row[x].b*alpha);
+                        }
+                    }
+                } break;
+                default: break;
+            }
+        }
 
-    result.r = (unsigned char)pR;
-    result.g = (unsigned char)pG;
-    result.b = (unsigned char)pB;
+        // Store row pixels in output format
+        unsigned char *dstRow = (unsigned char *)dst.data + (size_t)y*dst.width*dstPixelSize;
 
-    return result;
+        if (dst.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) memcpy(dstRow, row, dst.width*sizeof(Color));
+        else for (int x = 0; x < dst.width; x++) SetPixelColor(dstRow + x*dstPixelSize, row[x], dst.format);
+    }
+
+    RL_FREE(row);
+    RL_FREE(srcRow);
+    RL_FREE(accum);
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color ColorAlpha(Color color, float alpha)
+// Load image row pixels as Color values
+static void LoadImagePipelineRow(Image image, int y, Color *row, int pixelSize)
 {
-    Color result = color;
+    const unsigned char *srcRow = (const unsigned char *)image.data + (size_t)y*image.width*pixelSize;
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
-
-    result.a = (unsigned char)(255.0f*alpha);
-
-    return result;
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(row, srcRow, image.width*sizeof(Color)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int x = 0; x < image.width; x++) row[x] = (Color){ srcRow[x*3], srcRow[x*3 + 1], srcRow[x*3 + 2], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int x = 0; x < image.width; x++) row[x] = (Color){ srcRow[x], srcRow[x], srcRow[x], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int x = 0; x < image.width; x++) row[x] = (Color){ srcRow[x*2], srcRow[x*2], srcRow[x*2], srcRow[x*2 + 1] };
+        } break;
+        default:
+        {
+            for (int x = 0; x < image.width; x++) row[x] = GetPixelColor((void *)(srcRow + x*pixelSize), image.format);
+        } break;
+    }
 }
 
-// Get src alpha-blended into dst color with tint
-Color ColorAlphaBlend(Color dst, Color src, Color tint)
+// Draw text glyphs coverage into image (RGBA8, RGB8, GRAYSCALE), returns false if not supported
+// NOTE: Glyphs are placed as in ImageTextEx() and scaled to fontSize directly, no text image is generated;
+// glyph images must contain coverage in alpha channel (GRAY_ALPHA), as for default font and TTF fonts
+static bool DrawImageTextCoverage(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
-    Color result = WHITE;
+#if SUPPORT_MODULE_RTEXT
+    if ((dst->data == NULL) || (dst->width <= 0) || (dst->height <= 0) || (text == NULL) || (font.glyphs == NULL) || (font.baseSize <= 0)) return false;
+    if ((dst->format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (dst->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) &&
+        (dst->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return false;
+
+    int textLength = (int)strlen(text);
+    if (textLength == 0) return true;
+
+    ImageTextGlyph *glyphs = (ImageTextGlyph *)RL_MALLOC(textLength*sizeof(ImageTextGlyph));
+    int glyphCount = 0;
+    int lineCount = 0;
+    int textOffsetX = 0;            // Glyph position X, font base size
+    int textOffsetY = 0;            // Line position Y, font base size
+    float kerningOffsetX = 0.0f;    // Line kerning adjustments
+    int previous = 0;               // Previous codepoint in line, for kerning
+
+    // Glyphs placement at font base size, same as ImageTextEx()
+    for (int i = 0; i < textLength;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);    // WARNING: Module required: rtext
+        int index = GetGlyphIndex(font, codepoint);                         // WARNING: Module required: rtext
 
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+        if (codepoint == '\n')
+        {
+            textOffsetY += (font.baseSize + font.baseSize/2);
+            textOffsetX = 0;
+            kerningOffsetX = 0.0f;
+            previous = 0;
+            lineCount++;
+        }
+        else
+        {
+            if (previous != 0) kerningOffsetX += GetGlyphKerning(font, previous, codepoint); // WARNING: Module required: rtext
+            previous = codepoint;
 
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) result = dst;
-    else if (src.a == 255) result = src;
-    else
+            if ((codepoint != ' ') && (codepoint != '\t') && (font.recs[index].width > 0) && (font.recs[index].height > 0))
+            {
+                Image image = font.glyphs[index].image;
+
+                // Glyph image must match atlas rectangle size to be drawn as coverage, otherwise fallback to generic drawing
+                if ((image.data == NULL) || (image.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                    (image.width != (int)font.recs[index].width) || (image.height != (int)font.recs[index].height))
+                {
+                    RL_FREE(glyphs);
+                    return false;
+                }
+
+                glyphs[glyphCount].data = (const unsigned char *)image.data;
+                glyphs[glyphCount].width = image.width;
+                glyphs[glyphCount].height = image.height;
+                glyphs[glyphCount].x = (float)(textOffsetX + (int)floorf(kerningOffsetX) + font.glyphs[index].offsetX);
+                glyphs[glyphCount].y = (float)(textOffsetY + font.glyphs[index].offsetY);
+                glyphCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
+            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
+        }
+
+        i += codepointByteCount;
+    }
+
+    // Text box and scaling, same as text image generated by ImageTextEx() and drawn at position
+    // NOTE: Measured text height grows by (fontSize - baseSize) per line when measured at fontSize
+    Vector2 textSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);   // WARNING: Module required: rtext
+    float scaledHeight = textSize.y + (fontSize - (float)font.baseSize)*(lineCount + 1);
+    float scale = (scaledHeight != textSize.y)? scaledHeight/textSize.y : 1.0f;
+
+    ImageTextJob job = { 0 };
+    job.dst = dst;
+    job.glyphs = glyphs;
+    job.glyphCount = glyphCount;
+    job.scale = scale;
+    job.nearest = (font.texture.id == GetFontDefault().texture.id);
+    job.tint = tint;
+    job.tintGray = (unsigned char)(((float)tint.r/255.0f*0.299f + (float)tint.g/255.0f*0.587f + (float)tint.b/255.0f*0.114f)*255.0f);
+
+    // Text box clipped to image
+    int boxX = (int)position.x;
+    int boxY = (int)position.y;
+    int startX = (boxX > 0)? boxX : 0;
+    int startRow = (boxY > 0)? boxY : 0;
+    int endX = boxX + ((scale != 1.0f)? (int)(textSize.x*scale) : (int)textSize.x);
+    int endRow = boxY + ((scale != 1.0f)? (int)(textSize.y*scale) : (int)textSize.y);
+    if (endX > dst->width) endX = dst->width;
+    if (endRow > dst->height) endRow = dst->height;
+
+    // Glyphs placed in destination image, pixels bounds clipped to text box
+    int pixelCount = 0;
+    for (int i = 0; i < glyphCount; i++)
     {
-        unsigned int alpha = (unsigned int)src.a + 1; // Shifting by 8 (dividing by 256), so need to take that excess into account
-        result.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+        ImageTextGlyph *glyph = &glyphs[i];
+        glyph->x = boxX + glyph->x*scale;
+        glyph->y = boxY + glyph->y*scale;
+
+        glyph->x0 = (int)floorf(glyph->x);
+        glyph->y0 = (int)floorf(glyph->y);
+        glyph->x1 = (int)ceilf(glyph->x + glyph->width*scale);
+        glyph->y1 = (int)ceilf(glyph->y + glyph->height*scale);
+        if (glyph->x0 < startX) glyph->x0 = startX;
+        if (glyph->y0 < startRow) glyph->y0 = startRow;
+        if (glyph->x1 > endX) glyph->x1 = endX;
+        if (glyph->y1 > endRow) glyph->y1 = endRow;
+
+        if ((glyph->x1 - glyph->x0) > job.maxWidth) job.maxWidth = glyph->x1 - glyph->x0;
+        if ((glyph->x0 < glyph->x1) && (glyph->y0 < glyph->y1)) pixelCount += (glyph->x1 - glyph->x0)*(glyph->y1 - glyph->y0);
+    }
+
+    if (startRow < endRow)
+    {
+        // Multi-threaded drawing by rows bands for big texts only
+        // NOTE: All glyphs are checked per band, bands count is limited to a few per thread
+        if (pixelCount >= IMAGE_TEXT_JOB_MIN_SIZE)
+        {
+            int bandRows = IMAGE_JOB_BAND_SIZE/GetPixelDataSize(dst->width, 1, dst->format);
+            int minBandRows = (endRow - startRow)/(4*GetImageThreadCount());
+            if (bandRows < minBandRows) bandRows = minBandRows;
+            if (bandRows < 4) bandRows = 4;
 
-        if (result.a > 0)
+            job.startRow = startRow;
+            RunImageJob(DrawImageTextRows, &job, endRow - startRow, bandRows);
+        }
+        else
         {
-            result.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/result.a) >> 8);
-            result.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/result.a) >> 8);
-            result.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/result.a) >> 8);
+            job.startRow = 0;
+            DrawImageTextRows(&job, startRow, endRow);
         }
     }
+
+    RL_FREE(glyphs);
+
+    return true;
+#else
+    return false;
 #endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) result = dst;
-    else if (src.a == 255) result = src;
-    else
+}
+
+#if SUPPORT_MODULE_RTEXT
+// Draw image text rows in range [startRow, endRow), relative to job start row
+// NOTE: All glyphs are processed per rows range in text order, result does not depend on threads
+static void DrawImageTextRows(void *data, int startRow, int endRow)
+{
+    ImageTextJob *job = (ImageTextJob *)data;
+    Image *dst = job->dst;
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    unsigned char *coverage = (unsigned char *)RL_MALLOC(job->maxWidth + 1);
+
+    startRow += job->startRow;
+    endRow += job->startRow;
+
+    for (int i = 0; i < job->glyphCount; i++)
     {
-        Vector4 fdst = ColorNormalize(dst);
-        Vector4 fsrc = ColorNormalize(src);
-        Vector4 ftint = ColorNormalize(tint);
-        Vector4 fout = { 0 };
+        const ImageTextGlyph *glyph = &job->glyphs[i];
 
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+        // Glyph rows clipped to rows range
+        int y0 = (glyph->y0 > startRow)? glyph->y0 : startRow;
+        int y1 = (glyph->y1 < endRow)? glyph->y1 : endRow;
+        int count = glyph->x1 - glyph->x0;
 
-        if (fout.w > 0.0f)
+        if ((count <= 0) || (y0 >= y1)) continue;
+
+        for (int y = y0; y < y1; y++)
         {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+            LoadGlyphCoverageRow(glyph, job->scale, job->nearest, glyph->x0, y, count, coverage);
+            BlendImageCoverageRow((unsigned char *)dst->data + ((size_t)y*dst->width + glyph->x0)*bytesPerPixel, coverage, count, dst->format, job->tint, job->tintGray);
         }
-
-        result = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
     }
-#endif
 
-    return result;
+    RL_FREE(coverage);
 }
 
-// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
-Color ColorLerp(Color color1, Color color2, float factor)
+// Load glyph coverage for destination image row pixels, glyph scaled with nearest-neighbor or bilinear sampling
+static void LoadGlyphCoverageRow(const ImageTextGlyph *glyph, float scale, bool nearest, int x, int y, int count, unsigned char *coverage)
 {
-    Color color = { 0 };
-
-    if (factor < 0.0f) factor = 0.0f;
-    else if (factor > 1.0f) factor = 1.0f;
+    const unsigned char *data = glyph->data;
+    int width = glyph->width;
+    int height = glyph->height;
 
-    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
-    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
-    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
-    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
+    if ((scale == 1.0f) && (glyph->x == floorf(glyph->x)) && (glyph->y == floorf(glyph->y)))
+    {
+        // Fast path: glyph not scaled and aligned to pixels, direct coverage copy
+        int v = y - (int)glyph->y;
+        int u = x - (int)glyph->x;
+        const unsigned char *row = data + ((size_t)v*width + u)*2 + 1;
 
-    return color;
-}
+        for (int i = 0; i < count; i++) coverage[i] = (((u + i) >= 0) && ((u + i) < width) && (v >= 0) && (v < height))? row[i*2] : 0;
+    }
+    else if (nearest)
+    {
+        int v = (int)floorf(((float)y + 0.5f - glyph->y)/scale);
 
-// Get a Color struct from hexadecimal value
-Color GetColor(unsigned int hexValue)
-{
-    Color color;
+        for (int i = 0; i < count; i++)
+        {
+            int u = (int)floorf(((float)(x + i) + 0.5f - glyph->x)/scale);
+            coverage[i] = ((u >= 0) && (u < width) && (v >= 0) && (v < height))? data[((size_t)v*width + u)*2 + 1] : 0;
+        }
+    }
+    else
+    {
+        // Bilinear sampling, 8 bit fixed-point weights, samples out of glyph are empty
+        float fy = ((float)y + 0.5f - glyph->y)/scale - 0.5f;
+        int v = (int)floorf(fy);
+        int wy = (int)((fy - (float)v)*256.0f);
+        const unsigned char *row0 = ((v >= 0) && (v < height))? data + (size_t)v*width*2 + 1 : NULL;
+        const unsigned char *row1 = (((v + 1) >= 0) && ((v + 1) < height))? data + (size_t)(v + 1)*width*2 + 1 : NULL;
+
+        for (int i = 0; i < count; i++)
+        {
+            float fx = ((float)(x + i) + 0.5f - glyph->x)/scale - 0.5f;
+            int u = (int)floorf(fx);
+            int wx = (int)((fx - (float)u)*256.0f);
 
-    color.r = (unsigned char)(hexValue >> 24) & 0xff;
-    color.g = (unsigned char)(hexValue >> 16) & 0xff;
-    color.b = (unsigned char)(hexValue >> 8) & 0xff;
-    color.a = (unsigned char)hexValue & 0xff;
+            int c00 = 0, c10 = 0, c01 = 0, c11 = 0;
+            if (row0 != NULL)
+            {
+                if ((u >= 0) && (u < width)) c00 = row0[u*2];
+                if (((u + 1) >= 0) && ((u + 1) < width)) c10 = row0[(u + 1)*2];
+            }
+            if (row1 != NULL)
+            {
+                if ((u >= 0) && (u < width)) c01 = row1[u*2];
+                if (((u + 1) >= 0) && ((u + 1) < width)) c11 = row1[(u + 1)*2];
+            }
 
-    return color;
+            int top = c00*256 + (c10 - c00)*wx;
+            int bottom = c01*256 + (c11 - c01)*wx;
+            coverage[i] = (unsigned char)((top*256 + (bottom - top)*wy + 32768) >> 16);
+        }
+    }
 }
 
-// Get color from a pixel from certain format
-Color GetPixelColor(void *srcPtr, int format)
+// Blend solid color into image row pixels (RGBA8, RGB8, GRAYSCALE) by coverage
+// NOTE: Opaque pixels are blended with integer lerp (SSE2 if available), other pixels with ColorAlphaBlend()
+static void BlendImageCoverageRow(unsigned char *dst, const unsigned char *coverage, int count, int format, Color tint, unsigned char tintGray)
 {
-    Color color = { 0 };
+    unsigned int tintAlpha = (unsigned int)tint.a + 1;
+    int x = 0;
 
     switch (format)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
         {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
+#if defined(RTEXTURES_SSE2_ENABLED)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+            const __m128i color = _mm_setr_epi16(tint.r, tint.g, tint.b, 255, tint.r, tint.g, tint.b, 255);
+            const __m128i alphaScale = _mm_set1_epi16((short)tintAlpha);
+            const __m128i full = _mm_set1_epi16(256);
+
+            for (; (x + 4) <= count; x += 4)
+            {
+                unsigned int cov4 = (unsigned int)coverage[x] | ((unsigned int)coverage[x + 1] << 8) | ((unsigned int)coverage[x + 2] << 16) | ((unsigned int)coverage[x + 3] << 24);
+                if (cov4 == 0) continue;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+                __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + x*4));
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+                // Not opaque pixels require alpha compositing
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(pixels, alphaMask), alphaMask)) != 0xffff)
+                {
+                    for (int k = x; k < (x + 4); k++) BlendImageCoveragePixel(dst + k*4, (coverage[k]*tintAlpha) >> 8, tint);
+                    continue;
+                }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
+                // Coverage replicated per channel, weight = coverage*alpha + 1 (0 if no coverage)
+                __m128i cov = _mm_cvtsi32_si128((int)cov4);
+                cov = _mm_unpacklo_epi8(cov, cov);
+                cov = _mm_unpacklo_epi8(cov, cov);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
+                __m128i weightLo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(cov, zero), alphaScale), 8);
+                __m128i weightHi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(cov, zero), alphaScale), 8);
+                weightLo = _mm_sub_epi16(weightLo, _mm_cmpgt_epi16(weightLo, zero));
+                weightHi = _mm_sub_epi16(weightHi, _mm_cmpgt_epi16(weightHi, zero));
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+                __m128i dstLo = _mm_unpacklo_epi8(pixels, zero);
+                __m128i dstHi = _mm_unpackhi_epi8(pixels, zero);
+                dstLo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(color, weightLo), _mm_mullo_epi16(dstLo, _mm_sub_epi16(full, weightLo))), 8);
+                dstHi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(color, weightHi), _mm_mullo_epi16(dstHi, _mm_sub_epi16(full, weightHi))), 8);
 
+                _mm_storeu_si128((__m128i *)(dst + x*4), _mm_packus_epi16(dstLo, dstHi));
+            }
+#endif
+            for (; x < count; x++) BlendImageCoveragePixel(dst + x*4, (coverage[x]*tintAlpha) >> 8, tint);
         } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.a = 255;
-
+            for (; x < count; x++)
+            {
+                unsigned int alpha = ((unsigned int)coverage[x]*tintAlpha) >> 8;
+                if (alpha == 0) continue;
+
+                unsigned int weight = alpha + 1;
+                unsigned char *pixel = dst + x*3;
+                pixel[0] = (unsigned char)((tint.r*weight + pixel[0]*(256 - weight)) >> 8);
+                pixel[1] = (unsigned char)((tint.g*weight + pixel[1]*(256 - weight)) >> 8);
+                pixel[2] = (unsigned char)((tint.b*weight + pixel[2]*(256 - weight)) >> 8);
+            }
         } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = 255;
+#if defined(RTEXTURES_SSE2_ENABLED)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i gray = _mm_set1_epi16(tintGray);
+            const __m128i alphaScale = _mm_set1_epi16((short)tintAlpha);
+            const __m128i full = _mm_set1_epi16(256);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+            for (; (x + 16) <= count; x += 16)
+            {
+                __m128i cov = _mm_loadu_si128((const __m128i *)(coverage + x));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(cov, zero)) == 0xffff) continue;
 
-        } break;
-        default: break;
-    }
+                __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + x));
 
-    return color;
-}
+                __m128i weightLo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(cov, zero), alphaScale), 8);
+                __m128i weightHi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(cov, zero), alphaScale), 8);
+                weightLo = _mm_sub_epi16(weightLo, _mm_cmpgt_epi16(weightLo, zero));
+                weightHi = _mm_sub_epi16(weightHi, _mm_cmpgt_epi16(weightHi, zero));
 
-// Set pixel color formatted into destination pointer
-void SetPixelColor(void *dstPtr, Color color, int format)
-{
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+                __m128i dstLo = _mm_unpacklo_epi8(pixels, zero);
+                __m128i dstHi = _mm_unpackhi_epi8(pixels, zero);
+                dstLo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(gray, weightLo), _mm_mullo_epi16(dstLo, _mm_sub_epi16(full, weightLo))), 8);
+                dstHi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(gray, weightHi), _mm_mullo_epi16(dstHi, _mm_sub_epi16(full, weightHi))), 8);
 
-            ((unsigned char *)dstPtr)[0] = gray;
+                _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(dstLo, dstHi));
+            }
+#endif
+            for (; x < count; x++)
+            {
+                unsigned int alpha = ((unsigned int)coverage[x]*tintAlpha) >> 8;
+                if (alpha == 0) continue;
 
+                unsigned int weight = alpha + 1;
+                dst[x] = (unsigned char)((tintGray*weight + dst[x]*(256 - weight)) >> 8);
+            }
         } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+        default: break;
+    }
+}
 
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
+// Blend solid color into RGBA8 pixel with alpha, opaque pixels blended with integer lerp
+static void BlendImageCoveragePixel(unsigned char *pixel, unsigned int alpha, Color color)
+{
+    if (alpha == 0) return;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    if (pixel[3] == 255)
+    {
+        unsigned int weight = alpha + 1;
+        pixel[0] = (unsigned char)((color.r*weight + pixel[0]*(256 - weight)) >> 8);
+        pixel[1] = (unsigned char)((color.g*weight + pixel[1]*(256 - weight)) >> 8);
+        pixel[2] = (unsigned char)((color.b*weight + pixel[2]*(256 - weight)) >> 8);
+    }
+    else
+    {
+        Color result = ColorAlphaBlend((Color){ pixel[0], pixel[1], pixel[2], pixel[3] }, (Color){ color.r, color.g, color.b, (unsigned char)alpha }, WHITE);
+        pixel[0] = result.r;
+        pixel[1] = result.g;
+        pixel[2] = result.b;
+        pixel[3] = result.a;
+    }
+}
+#endif // SUPPORT_MODULE_RTEXT
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+// Run image processing job worker blocks
+static void RunImageJobWorker(void *arg)
+{
+    ImageJobWorker *worker = (ImageJobWorker *)arg;
+    int step = worker->workerCount*worker->blockSize;
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    for (int start = worker->index*worker->blockSize; start < worker->count; start += step)
+    {
+        int end = start + worker->blockSize;
+        if (end > worker->count) end = worker->count;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+        worker->func(worker->data, start, end);
+    }
+}
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+#if SUPPORT_IMAGE_THREADS
+#if defined(_WIN32)
+static unsigned long __stdcall ImageThreadEntry(void *arg)
+{
+    ImageThread *thread = (ImageThread *)arg;
+    thread->func(thread->arg);
+    return 0;
+}
+#elif defined(__unix__) || defined(__APPLE__)
+static void *ImageThreadEntry(void *arg)
+{
+    ImageThread *thread = (ImageThread *)arg;
+    thread->func(thread->arg);
+    return NULL;
+}
+#endif
+#endif
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+// Start image processing thread, returns false if threads are not supported or thread can not be created
+// NOTE: Thread data must be kept valid until thread is joined
+static bool StartImageThread(ImageThread *thread, void (*func)(void *arg), void *arg)
+{
+    thread->func = func;
+    thread->arg = arg;
+    thread->started = false;
+
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+    thread->handle = CreateThread(NULL, 0, ImageThreadEntry, thread, 0, NULL);
+    thread->started = (thread->handle != NULL);
+    #elif defined(__unix__) || defined(__APPLE__)
+    thread->started = (pthread_create(&thread->handle, NULL, ImageThreadEntry, thread) == 0);
+    #endif
+#endif
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    return thread->started;
+}
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+// Wait for image processing thread to finish
+static void JoinImageThread(ImageThread *thread)
+{
+    if (!thread->started) return;
+
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+    WaitForSingleObject(thread->handle, 0xffffffff);    // INFINITE
+    CloseHandle(thread->handle);
+    #elif defined(__unix__) || defined(__APPLE__)
+    pthread_join(thread->handle, NULL);
+    #endif
+#endif
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+    thread->started = false;
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
+// Get number of threads available for image processing
+static int GetImageThreadCount(void)
+{
+    static int threadCount = 0;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
+    if (threadCount == 0)
+    {
+        threadCount = 1;
 
-        } break;
-        default: break;
+#if SUPPORT_IMAGE_THREADS
+    #if defined(_WIN32)
+        threadCount = (int)GetActiveProcessorCount(0xffff);     // ALL_PROCESSOR_GROUPS
+    #elif defined(__unix__) || defined(__APPLE__)
+        threadCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+#endif
+        if (threadCount < 1) threadCount = 1;
+        if (threadCount > IMAGE_MAX_THREADS) threadCount = IMAGE_MAX_THREADS;
     }
+
+    return threadCount;
 }
 
-// Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for Image or Texture data
-int GetPixelDataSize(int width, int height, int format)
+// Run image processing job, range [0, count) is split into blocks processed on worker threads
+// NOTE: Blocks are distributed interleaved between workers, calling thread is also used as a worker,
+// job runs on calling thread only if threads are not supported or can not be created
+// NOTE: Worker threads are started and joined on every call, no threads are kept alive between jobs:
+// module has no initialization point to own a threads pool and idle threads would outlive image processing,
+// threads start cost is small compared to job blocks (rows bands of IMAGE_JOB_BAND_SIZE bytes, PNG bands,
+// glyphs batches), no more workers than blocks are started and single block jobs run on calling thread
+extern void RunImageJob(ImageJobFunc func, void *data, int count, int blockSize)
 {
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+    ImageJobWorker workers[IMAGE_MAX_THREADS] = { 0 };
+    ImageThread threads[IMAGE_MAX_THREADS] = { 0 };
+    int blockCount = (count + blockSize - 1)/blockSize;
+    int workerCount = GetImageThreadCount();
 
-    switch (format)
+    if (workerCount > blockCount) workerCount = blockCount;
+    if (workerCount < 1) workerCount = 1;
+
+    for (int i = 0; i < workerCount; i++)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
-        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
+        workers[i].func = func;
+        workers[i].data = data;
+        workers[i].count = count;
+        workers[i].blockSize = blockSize;
+        workers[i].index = i;
+        workers[i].workerCount = workerCount;
     }
 
-    double bytesPerPixel = (double)bpp/8.0;
-    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+    for (int i = 1; i < workerCount; i++) StartImageThread(&threads[i], RunImageJobWorker, &workers[i]);
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    RunImageJobWorker(&workers[0]);
+
+    for (int i = 1; i < workerCount; i++)
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        if (threads[i].started) JoinImageThread(&threads[i]);
+        else RunImageJobWorker(&workers[i]);
     }
-
-    return dataSize;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-// Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
+// Export image asynchronous task, task data is freed after export
+static void ExportImageTask(void *arg)
 {
-    float result = 0.0f;
+    ImageExportTask *task = (ImageExportTask *)arg;
 
-    union {
-        float fm;
-        unsigned int ui;
-    } uni;
+    bool result = ExportImage(task->image, task->fileName);
 
-    const unsigned int e = (x & 0x7c00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03ff) << 13; // Mantissa
-    uni.fm = (float)m;
-    const unsigned int v = uni.ui >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    uni.ui = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007fe000)); // sign : normalized : denormalized
+    if (result) TRACELOG(LOG_INFO, "FILEIO: [%s] Image asynchronous export finished successfully", task->fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Image asynchronous export failed", task->fileName);
 
-    result = uni.fm;
+    // NOTE: Image copy is never memory-mapped, data is freed directly,
+    // UnloadImage() would look up the memory-mapped images registry from this thread
+    RL_FREE(task->image.data);
+    RL_FREE(task->fileName);
+}
 
-    return result;
+// Get channels count for 8 bit per channel pixel formats, 0 for other formats
+static int GetImageChannels8(int format)
+{
+    int channels = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        default: break;
+    }
+
+    return channels;
 }
 
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
+// Load resampling contributions as fixed-point weights (14 bit), weights of every sample sum 1.0
+// NOTE: Sampling window is kept inside source size, taps out of source get zero weight
+static int LoadResampleWeightsFixed(int srcSize, int dstSize, bool bilinear, int **first, int **weights)
 {
-    unsigned short result = 0;
+    int *floatFirst = NULL;
+    float *floatWeights = NULL;
+    int floatTaps = 0;
 
-    union {
-        float fm;
-        unsigned int ui;
-    } uni;
-    uni.fm = x;
+    if (bilinear)
+    {
+        // Bilinear filtering, two source samples around destination sample center
+        float scale = (float)srcSize/(float)dstSize;
+        floatTaps = 2;
+        floatFirst = (int *)RL_MALLOC(dstSize*sizeof(int));
+        floatWeights = (float *)RL_CALLOC(dstSize*2, sizeof(float));
 
-    const unsigned int b = uni.ui + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7f800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007fffff; // Mantissa; in line below: 0x007ff000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+        for (int i = 0; i < dstSize; i++)
+        {
+            float x = (i + 0.5f)*scale - 0.5f;
+            if (x < 0.0f) x = 0.0f;
+            int s = (int)x;
+            if (s > (srcSize - 1)) s = srcSize - 1;
+            float frac = x - (float)s;
+
+            floatFirst[i] = s;
+            floatWeights[i*2] = 1.0f - frac;
+            floatWeights[i*2 + 1] = ((s + 1) < srcSize)? frac : 0.0f;
+        }
+    }
+    else floatTaps = LoadResampleWeights(srcSize, dstSize, &floatFirst, &floatWeights);
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7c00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007ff000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7fff; // sign : normalized : denormalized : saturate
+    int taps = (floatTaps < srcSize)? floatTaps : srcSize;
+    *first = (int *)RL_MALLOC(dstSize*sizeof(int));
+    *weights = (int *)RL_CALLOC(dstSize*taps, sizeof(int));
 
-    return result;
+    for (int i = 0; i < dstSize; i++)
+    {
+        int start = floatFirst[i];
+        if (start > (srcSize - taps)) start = srcSize - taps;
+        (*first)[i] = start;
+
+        int *w = *weights + i*taps;
+        int sum = 0;
+        int largest = 0;
+
+        for (int t = 0; t < floatTaps; t++)
+        {
+            int index = floatFirst[i] + t - start;
+
+            if ((floatWeights[i*floatTaps + t] > 0.0f) && (index < taps))
+            {
+                w[index] = (int)(floatWeights[i*floatTaps + t]*(1 << 14) + 0.5f);
+                sum += w[index];
+                if (w[index] > w[largest]) largest = index;
+            }
+        }
+
+        w[largest] += (1 << 14) - sum;     // Rounding error adjustment, weights must sum 1.0
+    }
+
+    RL_FREE(floatFirst);
+    RL_FREE(floatWeights);
+
+    return taps;
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Resize rows of 8 bit per channel image in range [startRow, endRow)
+static void ResizeImageRowsFixed(void *data, int startRow, int endRow)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    ImageResizeJob *job = (ImageResizeJob *)data;
+    int channels = job->channels;
+    int srcRowSize = job->srcWidth*channels;
+    int dstRowSize = job->dstWidth*channels;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    if (job->factor > 0)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        // Integer downscale factor: box filter averaging factor*factor source pixels
+        // NOTE: Source rows are summed vertically first (contiguous data), then pixels summed horizontally
+        int factor = job->factor;
+        int count = factor*factor;
+        unsigned short *column = (unsigned short *)RL_MALLOC(srcRowSize*sizeof(unsigned short));
+
+        for (int y = startRow; y < endRow; y++)
         {
-            switch (image.format)
+            const unsigned char *src = job->src + (size_t)y*factor*srcRowSize;
+            for (int i = 0; i < srcRowSize; i++) column[i] = src[i];
+
+            for (int ty = 1; ty < factor; ty++)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                src += srcRowSize;
+                for (int i = 0; i < srcRowSize; i++) column[i] += src[i];
+            }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+            unsigned char *dst = job->dst + (size_t)y*dstRowSize;
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            if ((factor == 2) && (channels == 4))
+            {
+                for (int x = 0; x < job->dstWidth; x++)
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                    for (int c = 0; c < 4; c++) dst[x*4 + c] = (unsigned char)((column[x*8 + c] + column[x*8 + 4 + c] + 2) >> 2);
+                }
+            }
+            else if ((factor == 2) && (channels == 1))
+            {
+                for (int x = 0; x < job->dstWidth; x++) dst[x] = (unsigned char)((column[x*2] + column[x*2 + 1] + 2) >> 2);
+            }
+            else
+            {
+                for (int x = 0; x < job->dstWidth; x++)
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+                    for (int c = 0; c < channels; c++)
+                    {
+                        unsigned int sum = 0;
+                        for (int tx = 0; tx < factor; tx++) sum += column[(x*factor + tx)*channels + c];
+                        dst[x*channels + c] = (unsigned char)((sum + count/2)/count);
+                    }
+                }
+            }
+        }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        RL_FREE(column);
+        return;
+    }
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    // Generic resampling: horizontal pass per source row (cached), vertical pass per destination row
+    // NOTE: Horizontal results keep 7 fractional bits, vertical accumulation fits in 32 bit
+    int slots = job->tapsY;
+    int *rows = (int *)RL_MALLOC(slots*dstRowSize*sizeof(int));
+    int *rowIndex = (int *)RL_MALLOC(slots*sizeof(int));
+    int *sum = (int *)RL_MALLOC(dstRowSize*sizeof(int));
+    for (int i = 0; i < slots; i++) rowIndex[i] = -1;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+    for (int y = startRow; y < endRow; y++)
+    {
+        memset(sum, 0, dstRowSize*sizeof(int));
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+        for (int ty = 0; ty < job->tapsY; ty++)
+        {
+            int wy = job->weightsY[y*job->tapsY + ty];
+            if (wy == 0) continue;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+            int sy = job->firstY[y] + ty;
+            int *row = rows + (sy%slots)*dstRowSize;
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+            if (rowIndex[sy%slots] != sy)
+            {
+                const unsigned char *src = job->src + (size_t)sy*srcRowSize;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                for (int x = 0; x < job->dstWidth; x++)
                 {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+                    const unsigned char *pixel = src + job->firstX[x]*channels;
+                    const int *wx = job->weightsX + x*job->tapsX;
+                    int value[4] = { 0 };
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                    if (channels == 4)
+                    {
+                        for (int tx = 0; tx < job->tapsX; tx++)
+                        {
+                            for (int c = 0; c < 4; c++) value[c] += wx[tx]*pixel[tx*4 + c];
+                        }
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+                        for (int c = 0; c < 4; c++) row[x*4 + c] = (value[c] + (1 << 6)) >> 7;
+                    }
+                    else
+                    {
+                        for (int tx = 0; tx < job->tapsX; tx++)
+                        {
+                            for (int c = 0; c < channels; c++) value[c] += wx[tx]*pixel[tx*channels + c];
+                        }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+                        for (int c = 0; c < channels; c++) row[x*channels + c] = (value[c] + (1 << 6)) >> 7;
+                    }
+                }
 
-                    k += 4;
-                } break;
-                default: break;
+                rowIndex[sy%slots] = sy;
             }
+
+            for (int i = 0; i < dstRowSize; i++) sum[i] += wy*row[i];
+        }
+
+        unsigned char *dst = job->dst + (size_t)y*dstRowSize;
+        for (int i = 0; i < dstRowSize; i++)
+        {
+            int value = (sum[i] + (1 << 20)) >> 21;
+            dst[i] = (unsigned char)((value > 255)? 255 : value);
         }
     }
 
-    return pixels;
+    RL_FREE(rows);
+    RL_FREE(rowIndex);
+    RL_FREE(sum);
+}
+
+// Resize 8 bit per channel image data, box filtering or bilinear filtering
+static void ResizeImageFixed(const unsigned char *src, int srcWidth, int srcHeight, unsigned char *dst, int dstWidth, int dstHeight, int channels, bool bilinear)
+{
+    ImageResizeJob job = { 0 };
+    job.src = src;
+    job.dst = dst;
+    job.srcWidth = srcWidth;
+    job.srcHeight = srcHeight;
+    job.dstWidth = dstWidth;
+    job.dstHeight = dstHeight;
+    job.channels = channels;
+
+    // NOTE: Integer factor path sums source rows in 16 bit, factor is limited to keep factor*255 in range
+    if (!bilinear && ((srcWidth%dstWidth) == 0) && ((srcHeight%dstHeight) == 0) && ((srcWidth/dstWidth) == (srcHeight/dstHeight)) &&
+        (srcWidth > dstWidth) && ((srcWidth/dstWidth) <= 0xffff/255))
+    {
+        job.factor = srcWidth/dstWidth;
+    }
+    else
+    {
+        job.tapsX = LoadResampleWeightsFixed(srcWidth, dstWidth, bilinear, &job.firstX, &job.weightsX);
+        job.tapsY = LoadResampleWeightsFixed(srcHeight, dstHeight, bilinear, &job.firstY, &job.weightsY);
+    }
+
+    // Process rows in bands sized to keep working set in cache
+    int bandRows = IMAGE_JOB_BAND_SIZE/(srcWidth*channels);
+    if (bandRows < 4) bandRows = 4;
+
+    RunImageJob(ResizeImageRowsFixed, &job, dstHeight, bandRows);
+
+    RL_FREE(job.firstX);
+    RL_FREE(job.firstY);
+    RL_FREE(job.weightsX);
+    RL_FREE(job.weightsY);
 }
 
 #endif // SUPPORT_MODULE_RTEXTURES